@@ -88,6 +88,10 @@
 
 #define ECS_LOC_LNG_MAX_CHAINE_GMSH  2048 /* Max file line length */
 
+/* Taille du tampon de lecture par paquets des éléments (format binaire) */
+
+#define ECS_LOC_TAILLE_BUF_ELT_GMSH  1048576 /* Bytes per read chunk */
+
 typedef int gmsh_int_t;
 
 /*============================================================================
@@ -1132,6 +1136,51 @@ ecs_loc_pre_gmsh__lit_nodes_v4(ecs_maillage_t   *maillage,
                              som_val_coord);
 }
 
+/*----------------------------------------------------------------------------
+ *  Redimensionnement des tableaux de connectivité d'une entité pour
+ *   pouvoir y ajouter `nbr_elt_ajout' éléments et `nbr_val_ajout' numéros
+ *   de sommets; la croissance est géométrique (facteur 1.5) de manière à
+ *   ne pas réallouer à chaque élément, sans surdimensionner les tableaux
+ *   au pire cas de toutes les dimensions confondues.
+ *
+ *  La fonction renvoie `true' si la taille max en éléments a été modifiée,
+ *   auquel cas l'appelant doit redimensionner ses tableaux par élément
+ *   (couleurs ou familles) à `*nbr_max_elt'.
+ *----------------------------------------------------------------------------*/
+
+static bool
+ecs_loc_pre_gmsh__redim_ent(size_t        nbr_elt,
+                            size_t        nbr_elt_ajout,
+                            size_t        nbr_val_ajout,
+                            size_t       *nbr_max_elt,
+                            size_t       *nbr_max_val,
+                            ecs_size_t  **elt_pos_som,
+                            ecs_int_t   **elt_val_som)
+{
+  bool  redim_elt = false;
+
+  size_t  nbr_val = (*elt_pos_som)[nbr_elt] - 1;
+
+  if (nbr_elt + nbr_elt_ajout > *nbr_max_elt) {
+    size_t  nbr_max = *nbr_max_elt + *nbr_max_elt/2;
+    if (nbr_max < nbr_elt + nbr_elt_ajout)
+      nbr_max = nbr_elt + nbr_elt_ajout;
+    *nbr_max_elt = nbr_max;
+    ECS_REALLOC(*elt_pos_som, nbr_max + 1, ecs_size_t);
+    redim_elt = true;
+  }
+
+  if (nbr_val + nbr_val_ajout > *nbr_max_val) {
+    size_t  nbr_max = *nbr_max_val + *nbr_max_val/2;
+    if (nbr_max < nbr_val + nbr_val_ajout)
+      nbr_max = nbr_val + nbr_val_ajout;
+    *nbr_max_val = nbr_max;
+    ECS_REALLOC(*elt_val_som, nbr_max, ecs_int_t);
+  }
+
+  return redim_elt;
+}
+
 /*----------------------------------------------------------------------------
  *  Lecture de la table de connectivité
  *----------------------------------------------------------------------------*/
@@ -1164,7 +1213,6 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
   ecs_int_t   nbr_tag_elt;
 
   gmsh_int_t  header[3];
-  gmsh_int_t  data[100];
 
   int         type_gmsh;
   ecs_int_t   nbr_nod_elt_gmsh;
@@ -1187,6 +1235,11 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
   ecs_int_t   *elt_val_som_ent    [ECS_N_ENTMAIL]; /* Numeros des sommets   */
   ecs_int_t   *elt_val_color_ent  [ECS_N_ENTMAIL]; /* Couleurs              */
 
+  size_t       nbr_max_elt_ent    [ECS_N_ENTMAIL]; /* Taille allouée (elts) */
+  size_t       nbr_max_val_ent    [ECS_N_ENTMAIL]; /* Taille allouée (som)  */
+
+  unsigned char  *buf_elt = NULL;                  /* Tampon de lecture     */
+
   ecs_int_t cpt_are   = 0;
   ecs_int_t cpt_point = 0;
 
@@ -1223,27 +1276,24 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
   }
 
   /*
-    On surdimensionne les tableaux de lecture des éléments; on les
-    redimensionnera à la fin.
+    Les tableaux de lecture des éléments sont agrandis au fur et à mesure
+    de la lecture (par bloc d'éléments en binaire), plutôt que d'être
+    surdimensionnés au pire cas (toutes dimensions confondues) pour
+    chaque entité; on les redimensionnera à la fin.
   */
 
   for (ient = ECS_ENTMAIL_FAC; ient < ECS_N_ENTMAIL; ient++) {
 
-    ECS_MALLOC(elt_val_color_ent[ient],   nbr_elt, ecs_int_t);
-    ECS_MALLOC(elt_pos_som_ent[ient],     nbr_elt + 1, ecs_size_t);
+    nbr_max_elt_ent[ient] = 0;
+    nbr_max_val_ent[ient] = 0;
+
+    elt_val_color_ent[ient] = NULL;
+    elt_val_som_ent[ient] = NULL;
+    ECS_MALLOC(elt_pos_som_ent[ient], 1, ecs_size_t);
 
     elt_pos_som_ent[ient][0] = 1;
   }
 
-  /*
-    Plus "gros" élément linéaire disponible :
-    - quadrangle (4 sommets) pour les faces
-    - hexaèdre (8 sommets) pour les cellules.
-  */
-
-  ECS_MALLOC(elt_val_som_ent[ECS_ENTMAIL_FAC], nbr_elt * 4, ecs_int_t);
-  ECS_MALLOC(elt_val_som_ent[ECS_ENTMAIL_CEL], nbr_elt * 8, ecs_int_t);
-
 
   /* Boucle de lecture des éléments */
   /*================================*/
@@ -1385,6 +1435,16 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
 
       ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
 
+      if (ecs_loc_pre_gmsh__redim_ent(cpt_elt_ent[ent_num],
+                                      1,
+                                      nbr_som_elt,
+                                      &(nbr_max_elt_ent[ent_num]),
+                                      &(nbr_max_val_ent[ent_num]),
+                                      &(elt_pos_som_ent[ent_num]),
+                                      &(elt_val_som_ent[ent_num])))
+        ECS_REALLOC(elt_val_color_ent[ent_num], nbr_max_elt_ent[ent_num],
+                    ecs_int_t);
+
       /* Position des numéros de sommets du prochain élément */
 
       elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1] =
@@ -1448,11 +1508,15 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
 
     ecs_file_set_type(fic_maillage, ECS_FILE_TYPE_BINARY);
 
+    ECS_MALLOC(buf_elt, ECS_LOC_TAILLE_BUF_ELT_GMSH, unsigned char);
+
     nbr_elt_lus = 0;
     nbr_elt_tot = nbr_elt;
 
     while (nbr_elt_lus != nbr_elt_tot) {
 
+      size_t  nbr_val_elt, nbr_elt_paq, nbr_elt_paq_max;
+
       ecs_file_read(&header, sizeof(gmsh_int_t), 3, fic_maillage);
 
       type_gmsh   = header[0];
@@ -1469,90 +1533,135 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
       nbr_nod_elt_gmsh = ecs_gmsh_elt_liste_c[type_gmsh - 1].nbr_som;
       nbr_som_elt      = ecs_fic_elt_typ_liste_c[type_ecs].nbr_som;
 
-      for (ind_elt = 0; ind_elt < nbr_elt; ind_elt++) {
+      /* Les éléments d'un bloc sont lus par paquets, de taille limitée
+         par celle du tampon de lecture */
+
+      nbr_val_elt = 1 + nbr_tag_elt + nbr_nod_elt_gmsh;
+      nbr_elt_paq_max =   ECS_LOC_TAILLE_BUF_ELT_GMSH
+                        / (nbr_val_elt * sizeof(gmsh_int_t));
+
+      if (nbr_elt_paq_max < 1)
+        ecs_error(__FILE__, __LINE__, 0,
+                  _("Error reading a Gmsh mesh file:\n"
+                    "\"%s\": %d tags per element is too large."),
+                  ecs_file_get_name(fic_maillage), (int)nbr_tag_elt);
+
+      if (type_gmsh == GMSH_POINT1 || type_gmsh == GMSH_SEG2 ||
+          type_gmsh == GMSH_SEG3)
+        ent_num = ECS_ENTMAIL_NONE;
+      else {
+
+        /* Identification de l'entité concernée et dimensionnement
+           des tableaux pour l'ensemble du bloc */
+
+        ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
+
+        if (ecs_loc_pre_gmsh__redim_ent(cpt_elt_ent[ent_num],
+                                        nbr_elt,
+                                        nbr_elt * nbr_som_elt,
+                                        &(nbr_max_elt_ent[ent_num]),
+                                        &(nbr_max_val_ent[ent_num]),
+                                        &(elt_pos_som_ent[ent_num]),
+                                        &(elt_val_som_ent[ent_num])))
+          ECS_REALLOC(elt_val_color_ent[ent_num], nbr_max_elt_ent[ent_num],
+                      ecs_int_t);
+
+      }
+
+      for (ind_elt = 0; ind_elt < nbr_elt; ind_elt += nbr_elt_paq) {
+
+        nbr_elt_paq = nbr_elt - ind_elt;
+        if (nbr_elt_paq > nbr_elt_paq_max)
+          nbr_elt_paq = nbr_elt_paq_max;
 
-        ecs_file_read(&data, sizeof(gmsh_int_t),
-                      1 + nbr_tag_elt + nbr_nod_elt_gmsh, fic_maillage);
+        ecs_file_read(buf_elt, sizeof(gmsh_int_t),
+                      nbr_elt_paq * nbr_val_elt, fic_maillage);
 
         if (type_gmsh == GMSH_POINT1) {
-          cpt_point += 1;
+          cpt_point += nbr_elt_paq;
           continue;
         }
         else if (type_gmsh == GMSH_SEG2 || type_gmsh == GMSH_SEG3) {
-          cpt_are += 1;
+          cpt_are += nbr_elt_paq;
           continue;
         }
 
-        /* Par défaut, Gmsh écrit des fichiers avec 2 "tags",
-           le premier correspondant à un numéro d'entité physique,
-           le second à une entité géométrique élémentaire;
-           on associe le premier à une couleur */
+        for (size_t ind_paq = 0; ind_paq < nbr_elt_paq; ind_paq++) {
 
-        label    = data[0];
-        coul_elt = data[1];
+          const gmsh_int_t  *data
+            = (const gmsh_int_t *)buf_elt + ind_paq*nbr_val_elt;
 
-        /* Lecture des numéros des sommets de l'élément courant */
+          /* Par défaut, Gmsh écrit des fichiers avec 2 "tags",
+             le premier correspondant à un numéro d'entité physique,
+             le second à une entité géométrique élémentaire;
+             on associe le premier à une couleur */
 
-        for (ind_nod_elt = 0; ind_nod_elt < nbr_nod_elt_gmsh; ind_nod_elt++)
-          num_nod_elt_gmsh[ind_nod_elt] = data[1 + nbr_tag_elt + ind_nod_elt];
+          coul_elt = data[1];
 
-        /* Stockage des valeurs avant transfert dans la structure `maillage' */
-        /*===================================================================*/
+          /* Lecture des numéros des sommets de l'élément courant */
 
-        /* Identification de l'entité concernée */
+          for (ind_nod_elt = 0; ind_nod_elt < nbr_nod_elt_gmsh; ind_nod_elt++)
+            num_nod_elt_gmsh[ind_nod_elt]
+              = data[1 + nbr_tag_elt + ind_nod_elt];
 
-        ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
+          /* Stockage des valeurs avant transfert dans la structure
+             `maillage' */
+          /*======================================================*/
 
-        /* Position des numéros de sommets du prochain élément */
+          /* Position des numéros de sommets du prochain élément */
 
-        elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1] =
-          elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] + nbr_som_elt;
+          elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1] =
+            elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] + nbr_som_elt;
 
-        /* Connectivité de l'élément par ses numéros de sommets */
+          /* Connectivité de l'élément par ses numéros de sommets */
 
-        for (ind_som_elt = 0; ind_som_elt < nbr_som_elt; ind_som_elt++) {
+          for (ind_som_elt = 0; ind_som_elt < nbr_som_elt; ind_som_elt++) {
 
-          elt_val_som_ent
-            [ent_num]
-            [elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] - 1 + ind_som_elt]
-            = num_nod_elt_gmsh
-            [ecs_gmsh_elt_liste_c[type_gmsh - 1].num_som[ind_som_elt] - 1];
+            elt_val_som_ent
+              [ent_num]
+              [elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] - 1 + ind_som_elt]
+              = num_nod_elt_gmsh
+              [ecs_gmsh_elt_liste_c[type_gmsh - 1].num_som[ind_som_elt] - 1];
 
-        }
+          }
 
-        /* Couleur (tag) de l'élément lu */
+          /* Couleur (tag) de l'élément lu */
 
-        icoul = 0;
-        while (icoul < cpt_coul_ent[ent_num]           &&
-               val_coul_ent[ent_num][icoul] != coul_elt)
-          icoul++;
+          icoul = 0;
+          while (icoul < cpt_coul_ent[ent_num]           &&
+                 val_coul_ent[ent_num][icoul] != coul_elt)
+            icoul++;
 
-        if (icoul == cpt_coul_ent[ent_num]) {
+          if (icoul == cpt_coul_ent[ent_num]) {
 
-          /* La valeur de la couleur n'a pas encore été stockée */
+            /* La valeur de la couleur n'a pas encore été stockée */
 
-          ECS_REALLOC(val_coul_ent[ent_num]    , cpt_coul_ent[ent_num] + 1,
-                      ecs_int_t);
-          ECS_REALLOC(cpt_elt_coul_ent[ent_num], cpt_coul_ent[ent_num] + 1,
-                      ecs_size_t);
-          cpt_elt_coul_ent[ent_num][icoul] = 0;
-          val_coul_ent[ent_num][icoul] = coul_elt;
-          cpt_coul_ent[ent_num]++;
+            ECS_REALLOC(val_coul_ent[ent_num]    , cpt_coul_ent[ent_num] + 1,
+                        ecs_int_t);
+            ECS_REALLOC(cpt_elt_coul_ent[ent_num], cpt_coul_ent[ent_num] + 1,
+                        ecs_size_t);
+            cpt_elt_coul_ent[ent_num][icoul] = 0;
+            val_coul_ent[ent_num][icoul] = coul_elt;
+            cpt_coul_ent[ent_num]++;
 
-        }
+          }
 
-        cpt_elt_coul_ent[ent_num][icoul]++;
-        elt_val_color_ent[ent_num][cpt_elt_ent[ent_num]] = icoul + 1;
+          cpt_elt_coul_ent[ent_num][icoul]++;
+          elt_val_color_ent[ent_num][cpt_elt_ent[ent_num]] = icoul + 1;
 
-        /* Incrémentation du nombre d'éléments lus */
+          /* Incrémentation du nombre d'éléments lus */
 
-        cpt_elt_ent[ent_num]++;
+          cpt_elt_ent[ent_num]++;
+
+        }
 
       }
 
       nbr_elt_lus += nbr_elt;
     }
 
+    ECS_FREE(buf_elt);
+
     ecs_file_set_type(fic_maillage, ECS_FILE_TYPE_TEXT);
 
     ecs_file_gets(chaine, 2, fic_maillage, num_ligne);
@@ -1598,13 +1707,15 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
                   elt_pos_som_ent[ient][cpt_elt_ent[ient]] - 1, ecs_int_t);
       ECS_REALLOC(elt_val_color_ent[ient]  ,
                   cpt_elt_ent[ient]        , ecs_int_t);
-    }
 
-    ecs_maillage_pre__label_en_indice
-      (nbr_som,
-       elt_pos_som_ent[ient][cpt_elt_ent[ient]] - 1,
-       *som_val_label,
-       elt_val_som_ent[ient]);
+      ecs_maillage_pre__label_en_indice
+        (nbr_som,
+         elt_pos_som_ent[ient][cpt_elt_ent[ient]] - 1,
+         *som_val_label,
+         elt_val_som_ent[ient]);
+    }
+    else
+      ECS_FREE(elt_pos_som_ent[ient]);
   }
 
   ECS_FREE(*som_val_label);
@@ -1667,6 +1778,11 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
   ecs_int_t   *elt_val_som_ent    [ECS_N_ENTMAIL]; /* Numeros des sommets   */
   int         *elt_val_fam_ent    [ECS_N_ENTMAIL]; /* Groupes (familles)    */
 
+  size_t       nbr_max_elt_ent    [ECS_N_ENTMAIL]; /* Taille allouée (elts) */
+  size_t       nbr_max_val_ent    [ECS_N_ENTMAIL]; /* Taille allouée (som)  */
+
+  unsigned char  *buf_elt = NULL;                  /* Tampon de lecture     */
+
   ecs_int_t  ind_elt = 0;
   ecs_int_t  cpt_are   = 0;
   ecs_int_t  cpt_point = 0;
@@ -1723,27 +1839,24 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
   }
 
   /*
-    On surdimensionne les tableaux de lecture des éléments; on les
-    redimensionnera à la fin.
+    Les tableaux de lecture des éléments sont dimensionnés bloc d'entité
+    par bloc d'entité (le nombre d'éléments de chaque bloc étant connu),
+    plutôt que d'être surdimensionnés au pire cas (toutes dimensions
+    confondues) pour chaque entité; on les redimensionnera à la fin.
   */
 
   for (ient = ECS_ENTMAIL_FAC; ient < ECS_N_ENTMAIL; ient++) {
 
-    ECS_MALLOC(elt_val_fam_ent[ient], nbr_elt, int);
-    ECS_MALLOC(elt_pos_som_ent[ient], nbr_elt + 1, ecs_size_t);
+    nbr_max_elt_ent[ient] = 0;
+    nbr_max_val_ent[ient] = 0;
+
+    elt_val_fam_ent[ient] = NULL;
+    elt_val_som_ent[ient] = NULL;
+    ECS_MALLOC(elt_pos_som_ent[ient], 1, ecs_size_t);
 
     elt_pos_som_ent[ient][0] = 1;
   }
 
-  /*
-    Plus "gros" élément linéaire disponible :
-    - quadrangle (4 sommets) pour les faces
-    - hexaèdre (8 sommets) pour les cellules.
-  */
-
-  ECS_MALLOC(elt_val_som_ent[ECS_ENTMAIL_FAC], nbr_elt * 4, ecs_int_t);
-  ECS_MALLOC(elt_val_som_ent[ECS_ENTMAIL_CEL], nbr_elt * 8, ecs_int_t);
-
 
   /* Boucle de lecture des éléments */
   /*================================*/
@@ -1790,6 +1903,27 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
       nbr_nod_elt_gmsh = ecs_gmsh_elt_liste_c[type_gmsh - 1].nbr_som;
       nbr_som_elt      = ecs_fic_elt_typ_liste_c[type_ecs].nbr_som;
 
+      if (type_gmsh == GMSH_POINT1 || type_gmsh == GMSH_SEG2 ||
+          type_gmsh == GMSH_SEG3)
+        ent_num = ECS_ENTMAIL_NONE;
+      else {
+
+        /* Identification de l'entité concernée et dimensionnement
+           des tableaux pour l'ensemble du bloc */
+
+        ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
+
+        if (ecs_loc_pre_gmsh__redim_ent(cpt_elt_ent[ent_num],
+                                        n_ent_elt,
+                                        n_ent_elt * nbr_som_elt,
+                                        &(nbr_max_elt_ent[ent_num]),
+                                        &(nbr_max_val_ent[ent_num]),
+                                        &(elt_pos_som_ent[ent_num]),
+                                        &(elt_val_som_ent[ent_num])))
+          ECS_REALLOC(elt_val_fam_ent[ent_num], nbr_max_elt_ent[ent_num], int);
+
+      }
+
       for (unsigned long be = 0; be < n_ent_elt; be++, ind_elt++) {
 
         if (ligne_decodee == false)
@@ -1839,10 +1973,6 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
         /* Stockage des valeurs avant transfert dans la structure `maillage' */
         /*===================================================================*/
 
-        /* Identification de l'entité concernée */
-
-        ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
-
         /* Position des numéros de sommets du prochain élément */
 
         elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1] =
@@ -1887,6 +2017,8 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
   }
   else {
 
+    ECS_MALLOC(buf_elt, ECS_LOC_TAILLE_BUF_ELT_GMSH, unsigned char);
+
     nbr_elt_lus = 0;
 
     for (unsigned long eb = 0; eb < n_ent_blocks; eb++) {
@@ -1894,6 +2026,8 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
       int tag_ent = -1;
       unsigned long n_ent_elt = 0;
 
+      size_t  nbr_val_elt, taille_val, nbr_elt_paq, nbr_elt_paq_max;
+
       int buf_i[3];
 
       ecs_file_read(buf_i, sizeof(int), 3, fic_maillage);
@@ -1927,89 +2061,106 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
       nbr_nod_elt_gmsh = ecs_gmsh_elt_liste_c[type_gmsh - 1].nbr_som;
       nbr_som_elt      = ecs_fic_elt_typ_liste_c[type_ecs].nbr_som;
 
-      for (unsigned long be = 0; be < n_ent_elt; be++, ind_elt++) {
+      if (type_gmsh == GMSH_POINT1 || type_gmsh == GMSH_SEG2 ||
+          type_gmsh == GMSH_SEG3)
+        ent_num = ECS_ENTMAIL_NONE;
+      else {
 
-        if (version_fmt_gmsh < 41) {
+        /* Identification de l'entité concernée et dimensionnement
+           des tableaux pour l'ensemble du bloc */
 
-          int  data[100];
+        ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
 
-          ecs_file_read(&data, sizeof(int),
-                        1 + nbr_nod_elt_gmsh, fic_maillage);
+        if (ecs_loc_pre_gmsh__redim_ent(cpt_elt_ent[ent_num],
+                                        n_ent_elt,
+                                        n_ent_elt * nbr_som_elt,
+                                        &(nbr_max_elt_ent[ent_num]),
+                                        &(nbr_max_val_ent[ent_num]),
+                                        &(elt_pos_som_ent[ent_num]),
+                                        &(elt_val_som_ent[ent_num])))
+          ECS_REALLOC(elt_val_fam_ent[ent_num], nbr_max_elt_ent[ent_num], int);
 
-          if (type_gmsh == GMSH_POINT1) {
-            cpt_point += 1;
-            continue;
-          }
-          else if (type_gmsh == GMSH_SEG2 || type_gmsh == GMSH_SEG3) {
-            cpt_are += 1;
-            continue;
-          }
+      }
 
-          /* Lecture des numéros des sommets de l'élément courant */
+      /* Les éléments d'un bloc sont lus par paquets, de taille limitée
+         par celle du tampon de lecture */
 
-          for (ind_nod_elt = 0; ind_nod_elt < nbr_nod_elt_gmsh; ind_nod_elt++)
-            num_nod_elt_gmsh[ind_nod_elt] = data[1 + ind_nod_elt];
+      nbr_val_elt = 1 + nbr_nod_elt_gmsh;
+      taille_val = (version_fmt_gmsh < 41) ? sizeof(int) : sizeof(size_t);
+      nbr_elt_paq_max = ECS_LOC_TAILLE_BUF_ELT_GMSH / (nbr_val_elt*taille_val);
 
-        }
-        else {
+      for (unsigned long be = 0; be < n_ent_elt; be += nbr_elt_paq) {
 
-          size_t  data[100];
+        nbr_elt_paq = n_ent_elt - be;
+        if (nbr_elt_paq > nbr_elt_paq_max)
+          nbr_elt_paq = nbr_elt_paq_max;
 
-          ecs_file_read(&data, sizeof(size_t),
-                        1 + nbr_nod_elt_gmsh, fic_maillage);
+        ecs_file_read(buf_elt, taille_val,
+                      nbr_elt_paq * nbr_val_elt, fic_maillage);
 
-          if (type_gmsh == GMSH_POINT1) {
-            cpt_point += 1;
-            continue;
-          }
-          else if (type_gmsh == GMSH_SEG2 || type_gmsh == GMSH_SEG3) {
-            cpt_are += 1;
-            continue;
-          }
+        ind_elt += nbr_elt_paq;
 
-          /* Lecture des numéros des sommets de l'élément courant */
+        if (type_gmsh == GMSH_POINT1) {
+          cpt_point += nbr_elt_paq;
+          continue;
+        }
+        else if (type_gmsh == GMSH_SEG2 || type_gmsh == GMSH_SEG3) {
+          cpt_are += nbr_elt_paq;
+          continue;
+        }
 
-          for (ind_nod_elt = 0; ind_nod_elt < nbr_nod_elt_gmsh; ind_nod_elt++)
-            num_nod_elt_gmsh[ind_nod_elt] = data[1 + ind_nod_elt];
+        for (size_t ind_paq = 0; ind_paq < nbr_elt_paq; ind_paq++) {
 
-        }
+          /* Lecture des numéros des sommets de l'élément courant */
 
-        /* Stockage des valeurs avant transfert dans la structure `maillage' */
-        /*===================================================================*/
+          if (version_fmt_gmsh < 41) {
+            const int  *data = (const int *)buf_elt + ind_paq*nbr_val_elt;
+            for (ind_nod_elt = 0; ind_nod_elt < nbr_nod_elt_gmsh; ind_nod_elt++)
+              num_nod_elt_gmsh[ind_nod_elt] = data[1 + ind_nod_elt];
+          }
+          else {
+            const size_t  *data = (const size_t *)buf_elt + ind_paq*nbr_val_elt;
+            for (ind_nod_elt = 0; ind_nod_elt < nbr_nod_elt_gmsh; ind_nod_elt++)
+              num_nod_elt_gmsh[ind_nod_elt] = data[1 + ind_nod_elt];
+          }
 
-        /* Identification de l'entité concernée */
+          /* Stockage des valeurs avant transfert dans la structure
+             `maillage' */
+          /*======================================================*/
 
-        ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
+          /* Position des numéros de sommets du prochain élément */
 
-        /* Position des numéros de sommets du prochain élément */
+          elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1]
+            = elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] + nbr_som_elt;
 
-        elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1]
-          = elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] + nbr_som_elt;
+          /* Connectivité de l'élément par ses numéros de sommets */
 
-        /* Connectivité de l'élément par ses numéros de sommets */
+          for (ind_som_elt = 0; ind_som_elt < nbr_som_elt; ind_som_elt++) {
 
-        for (ind_som_elt = 0; ind_som_elt < nbr_som_elt; ind_som_elt++) {
+            elt_val_som_ent
+              [ent_num]
+              [elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] - 1 + ind_som_elt]
+              = num_nod_elt_gmsh
+              [ecs_gmsh_elt_liste_c[type_gmsh - 1].num_som[ind_som_elt] - 1];
 
-          elt_val_som_ent
-            [ent_num]
-            [elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] - 1 + ind_som_elt]
-            = num_nod_elt_gmsh
-            [ecs_gmsh_elt_liste_c[type_gmsh - 1].num_som[ind_som_elt] - 1];
+          }
 
-        }
+          elt_val_fam_ent[ent_num][cpt_elt_ent[ent_num]]
+            = tag_ent + fam_shift[ent_num];
 
-        elt_val_fam_ent[ent_num][cpt_elt_ent[ent_num]]
-          = tag_ent + fam_shift[ent_num];
+          /* Incrémentation du nombre d'éléments lus */
 
-        /* Incrémentation du nombre d'éléments lus */
+          cpt_elt_ent[ent_num]++;
 
-        cpt_elt_ent[ent_num]++;
+        }
 
       }
 
       nbr_elt_lus += n_ent_elt;
     }
 
+    ECS_FREE(buf_elt);
+
     ecs_file_set_type(fic_maillage, ECS_FILE_TYPE_TEXT);
 
     ecs_file_gets(chaine, 2, fic_maillage, num_ligne);
@@ -2053,13 +2204,15 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
       ECS_REALLOC(elt_val_som_ent[ient],
                   elt_pos_som_ent[ient][cpt_elt_ent[ient]] - 1, ecs_int_t);
       ECS_REALLOC(elt_val_fam_ent[ient], cpt_elt_ent[ient], int);
-    }
 
-    ecs_maillage_pre__label_en_indice
-      (nbr_som,
-       elt_pos_som_ent[ient][cpt_elt_ent[ient]] - 1,
-       *som_val_label,
-       elt_val_som_ent[ient]);
+      ecs_maillage_pre__label_en_indice
+        (nbr_som,
+         elt_pos_som_ent[ient][cpt_elt_ent[ient]] - 1,
+         *som_val_label,
+         elt_val_som_ent[ient]);
+    }
+    else
+      ECS_FREE(elt_pos_som_ent[ient]);
   }
 
   ECS_FREE(*som_val_label);
@@ -801,10 +801,6 @@ cs_balance_by_zone_compute(const char      *scalar_name,
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -1448,6 +1444,10 @@ cs_balance_by_zone_compute(const char      *scalar_name,
     cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
     cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
 
+    cs_real_t diipf[3], djjpf[3];
+    cs_mesh_quantities_i_face_sup_vectors(fvq, f_id_sel, c_id1, c_id2,
+                                          diipf, djjpf);
+
     cs_real_t beta = blencp;
     /* Beta blending coefficient ensuring positivity of the scalar */
     if (isstpp == 2) {
@@ -1508,8 +1508,8 @@ cs_balance_by_zone_compute(const char      *scalar_name,
                             i_face_cog[f_id_sel],
                             hybrid_coef_ii,
                             hybrid_coef_jj,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
+                            diipf,
+                            djjpf,
                             grad[c_id1],
                             grad[c_id2],
                             grad[ic],
@@ -1743,10 +1743,6 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
   const cs_real_3_t *restrict b_face_cog
     = (const cs_real_3_t *restrict)fvq->b_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -2052,6 +2048,10 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
     cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
 
+    cs_real_t diipf[3], djjpf[3];
+    cs_mesh_quantities_i_face_sup_vectors(fvq, f_id_sel, c_id1, c_id2,
+                                          diipf, djjpf);
+
     cs_real_2_t bi_bterms = {0.,0.};
     cs_real_3_t grad = {0, 0, 0};
 
@@ -2063,8 +2063,8 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     cs_real_t p_rho_id2 = pressure[c_id2] / rho[c_id2];
 
     cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
+                            diipf,
+                            djjpf,
                             grad,
                             grad,
                             p_rho_id1,
@@ -2127,8 +2127,8 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     cs_real_t u2_id2 = _CS_MODULE2_2(velocity[c_id2]);
 
     cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
+                            diipf,
+                            djjpf,
                             grad,
                             grad,
                             u2_id1,
@@ -2183,8 +2183,8 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     cs_real_t gx_id2 = - _CS_DOT_PRODUCT(gravity, i_face_cog[f_id_sel]);
 
     cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
+                            diipf,
+                            djjpf,
                             grad,
                             grad,
                             gx_id1,
@@ -2521,10 +2521,6 @@ cs_flux_through_surface(const char         *scalar_name,
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -2976,6 +2972,10 @@ cs_flux_through_surface(const char         *scalar_name,
     cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
     cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
 
+    cs_real_t diipf[3], djjpf[3];
+    cs_mesh_quantities_i_face_sup_vectors(fvq, f_id_sel, c_id1, c_id2,
+                                          diipf, djjpf);
+
     cs_real_t beta = blencp;
     /* Beta blending coefficient ensuring positivity of the scalar */
     if (isstpp == 2) {
@@ -3036,8 +3036,8 @@ cs_flux_through_surface(const char         *scalar_name,
                             i_face_cog[f_id_sel],
                             hybrid_coef_ii,
                             hybrid_coef_jj,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
+                            diipf,
+                            djjpf,
                             grad[c_id1],
                             grad[c_id2],
                             grad[ic],
@@ -55,6 +55,7 @@
 #include "cs_log.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_field.h"
 #include "cs_field_operator.h"
 #include "cs_field_pointer.h"
@@ -145,10 +146,6 @@ _beta_limiter_denom(const int              f_id,
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
 
   /* Get option from the field */
   cs_field_t *f = cs_field_by_id(f_id);
@@ -299,6 +296,10 @@ _beta_limiter_denom(const int              f_id,
         cs_lnum_t ii = i_face_cells[face_id][0];
         cs_lnum_t jj = i_face_cells[face_id][1];
 
+        cs_real_t diipf[3], djjpf[3];
+        cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                              diipf, djjpf);
+
         cs_real_t pi = pvar[ii];
         cs_real_t pj = pvar[jj];
         cs_real_t pia = pvara[ii];
@@ -376,8 +377,8 @@ _beta_limiter_denom(const int              f_id,
                            i_face_cog[face_id],
                            hybrid_coef_ii,
                            hybrid_coef_jj,
-                           diipf[face_id],
-                           djjpf[face_id],
+                           diipf,
+                           djjpf,
                            grdpa[ii], /* Std gradient when needed */
                            grdpa[jj], /* Std gradient when needed */
                            grdpa[ii], /* Upwind gradient when needed */
@@ -401,8 +402,8 @@ _beta_limiter_denom(const int              f_id,
                                               of blending function */
                            hybrid_coef_jj, /* FIXME use previous values
                                               of blending function */
-                           diipf[face_id],
-                           djjpf[face_id],
+                           diipf,
+                           djjpf,
                            grdpaa[ii], /* Std gradient when needed */
                            grdpaa[jj], /* Std gradient when needed */
                            grdpaa[ii], /* Upwind gradient when needed */
@@ -578,6 +579,43 @@ _beta_limiter_num(const int           f_id,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Gather interior face fluxes to cells (cell-based gather mode).
+ *
+ * For each cell, face contributions are summed in the cell -> faces
+ * adjacency order (increasing face ids), so the result is the same as
+ * that of a serial face-based scatter.
+ *
+ * parameters:
+ *   m           <-- pointer to mesh
+ *   c2f         <-- cell -> faces adjacency (interior faces first)
+ *   i_flux      <-- interior face fluxes (contributions to i and j)
+ *   rhs         <-> right hand side
+ *----------------------------------------------------------------------------*/
+
+static void
+_gather_i_face_fluxes(const cs_mesh_t        *m,
+                      const cs_adjacency_t   *c2f,
+                      const cs_real_2_t       i_flux[],
+                      cs_real_t     *restrict rhs)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
+      const cs_lnum_t f_id = c2f->ids[i];
+      if (f_id >= n_i_faces)
+        continue;
+      if (c2f->sgn[i] > 0)
+        rhs[c_id] -= i_flux[f_id][0];
+      else
+        rhs[c_id] += i_flux[f_id][1];
+    }
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1637,8 +1675,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const int n_i_groups = m->i_face_numbering->n_groups;
-  const int n_i_threads = m->i_face_numbering->n_threads;
+  int n_i_groups = m->i_face_numbering->n_groups;
+  int n_i_threads = m->i_face_numbering->n_threads;
   const int n_b_groups = m->b_face_numbering->n_groups;
   const int n_b_threads = m->b_face_numbering->n_threads;
   const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
@@ -1658,10 +1696,6 @@ cs_convection_diffusion_scalar(int                       idtvar,
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -1697,6 +1731,22 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
   cs_real_t  *v_slope_test = cs_get_v_slope_test(f_id,  var_cal_opt);
 
+  /* In cell-based gather mode, interior face fluxes are computed by
+     a face-parallel loop, then gathered by cells */
+
+  const cs_adjacency_t *c2f = (v_slope_test == NULL) ?
+    cs_mesh_adjacencies_gather_c2f(m) : NULL;
+  cs_real_2_t *i_flux = NULL;
+
+  if (c2f != NULL) {
+    const cs_numbering_t *i_gather_num
+      = cs_glob_mesh_adjacencies->i_face_gather_numbering;
+    n_i_groups = i_gather_num->n_groups;
+    n_i_threads = i_gather_num->n_threads;
+    i_group_index = i_gather_num->group_index;
+    BFT_MALLOC(i_flux, m->n_i_faces, cs_real_2_t);
+  }
+
   /* Internal coupling variables */
   cs_real_t *pvar_local = NULL;
   cs_real_t *pvar_distant = NULL;
@@ -1952,6 +2002,10 @@ cs_convection_diffusion_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -1969,8 +2023,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
             cs_i_cd_steady_upwind(bldfrp,
                                   relaxp,
-                                  diipf[face_id],
-                                  djjpf[face_id],
+                                  diipf,
+                                  djjpf,
                                   grad[ii],
                                   grad[jj],
                                   _pvar[ii],
@@ -2009,8 +2063,14 @@ cs_convection_diffusion_scalar(int                       idtvar,
                            i_visc[face_id],
                            fluxij);
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+            if (i_flux != NULL) {
+              i_flux[face_id][0] = fluxij[0];
+              i_flux[face_id][1] = fluxij[1];
+            }
+            else {
+              rhs[ii] -= fluxij[0];
+              rhs[jj] += fluxij[1];
+            }
 
           }
         }
@@ -2029,6 +2089,10 @@ cs_convection_diffusion_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -2045,8 +2109,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
               bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
 
             cs_i_cd_unsteady_upwind(bldfrp,
-                                    diipf[face_id],
-                                    djjpf[face_id],
+                                    diipf,
+                                    djjpf,
                                     grad[ii],
                                     grad[jj],
                                     _pvar[ii],
@@ -2079,8 +2143,14 @@ cs_convection_diffusion_scalar(int                       idtvar,
                            i_visc[face_id],
                            fluxij);
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+            if (i_flux != NULL) {
+              i_flux[face_id][0] = fluxij[0];
+              i_flux[face_id][1] = fluxij[1];
+            }
+            else {
+              rhs[ii] -= fluxij[0];
+              rhs[jj] += fluxij[1];
+            }
 
           }
         }
@@ -2111,6 +2181,10 @@ cs_convection_diffusion_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_2_t fluxij = {0.,0.};
 
             cs_real_t pifri, pjfri, pifrj, pjfrj;
@@ -2129,8 +2203,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
                            cell_cen[ii],
                            cell_cen[jj],
                            i_face_cog[face_id],
-                           diipf[face_id],
-                           djjpf[face_id],
+                           diipf,
+                           djjpf,
                            grad[ii],
                            grad[jj],
                            gradup[ii],
@@ -2171,8 +2245,14 @@ cs_convection_diffusion_scalar(int                       idtvar,
                            i_visc[face_id],
                            fluxij);
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+            if (i_flux != NULL) {
+              i_flux[face_id][0] = fluxij[0];
+              i_flux[face_id][1] = fluxij[1];
+            }
+            else {
+              rhs[ii] -= fluxij[0];
+              rhs[jj] += fluxij[1];
+            }
 
           }
         }
@@ -2191,6 +2271,10 @@ cs_convection_diffusion_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_t beta = blencp;
 
             cs_real_t pif, pjf;
@@ -2226,8 +2310,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
                               i_face_cog[face_id],
                               hybrid_coef_ii,
                               hybrid_coef_jj,
-                              diipf[face_id],
-                              djjpf[face_id],
+                              diipf,
+                              djjpf,
                               grad[ii],
                               grad[jj],
                               gradup[ii],
@@ -2302,8 +2386,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
               cs_real_t recoi, recoj;
 
               cs_i_compute_quantities(bldfrp,
-                                      diipf[face_id],
-                                      djjpf[face_id],
+                                      diipf,
+                                      djjpf,
                                       grad[ii],
                                       grad[jj],
                                       _pvar[ii],
@@ -2323,8 +2407,14 @@ cs_convection_diffusion_scalar(int                       idtvar,
                            i_visc[face_id],
                            fluxij);
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+            if (i_flux != NULL) {
+              i_flux[face_id][0] = fluxij[0];
+              i_flux[face_id][1] = fluxij[1];
+            }
+            else {
+              rhs[ii] -= fluxij[0];
+              rhs[jj] += fluxij[1];
+            }
 
           }
         }
@@ -2355,6 +2445,10 @@ cs_convection_diffusion_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_2_t fluxij = {0., 0.};
 
             bool upwind_switch = false;
@@ -2380,8 +2474,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
                                       cell_cen[jj],
                                       i_face_normal[face_id],
                                       i_face_cog[face_id],
-                                      diipf[face_id],
-                                      djjpf[face_id],
+                                      diipf,
+                                      djjpf,
                                       i_massflux[face_id],
                                       grad[ii],
                                       grad[jj],
@@ -2437,8 +2531,14 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
             }
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+            if (i_flux != NULL) {
+              i_flux[face_id][0] = fluxij[0];
+              i_flux[face_id][1] = fluxij[1];
+            }
+            else {
+              rhs[ii] -= fluxij[0];
+              rhs[jj] += fluxij[1];
+            }
 
           }
         }
@@ -2457,6 +2557,10 @@ cs_convection_diffusion_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             bool upwind_switch = false;
 
             cs_real_2_t fluxij = {0.,0.};
@@ -2482,8 +2586,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
                                         cell_cen[jj],
                                         i_face_normal[face_id],
                                         i_face_cog[face_id],
-                                        diipf[face_id],
-                                        djjpf[face_id],
+                                        diipf,
+                                        djjpf,
                                         i_massflux[face_id],
                                         grad[ii],
                                         grad[jj],
@@ -2532,8 +2636,14 @@ cs_convection_diffusion_scalar(int                       idtvar,
               }
             }
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+            if (i_flux != NULL) {
+              i_flux[face_id][0] = fluxij[0];
+              i_flux[face_id][1] = fluxij[1];
+            }
+            else {
+              rhs[ii] -= fluxij[0];
+              rhs[jj] += fluxij[1];
+            }
 
           }
         }
@@ -2544,6 +2654,11 @@ cs_convection_diffusion_scalar(int                       idtvar,
   } /* iupwin */
 
 
+  if (i_flux != NULL) {
+    _gather_i_face_fluxes(m, c2f, (const cs_real_2_t *)i_flux, rhs);
+    BFT_FREE(i_flux);
+  }
+
   if (iwarnp >= 2 && iconvp == 1) {
 
     /* Sum number of clippings */
@@ -3093,10 +3208,6 @@ cs_face_convection_scalar(int                       idtvar,
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -3365,6 +3476,10 @@ cs_face_convection_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -3380,8 +3495,8 @@ cs_face_convection_scalar(int                       idtvar,
 
             cs_i_cd_steady_upwind(bldfrp,
                                   relaxp,
-                                  diipf[face_id],
-                                  djjpf[face_id],
+                                  diipf,
+                                  djjpf,
                                   grad[ii],
                                   grad[jj],
                                   _pvar[ii],
@@ -3428,6 +3543,10 @@ cs_face_convection_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -3442,8 +3561,8 @@ cs_face_convection_scalar(int                       idtvar,
               bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
 
             cs_i_cd_unsteady_upwind(bldfrp,
-                                    diipf[face_id],
-                                    djjpf[face_id],
+                                    diipf,
+                                    djjpf,
                                     grad[ii],
                                     grad[jj],
                                     _pvar[ii],
@@ -3496,6 +3615,10 @@ cs_face_convection_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_t pifri, pjfri, pifrj, pjfrj;
             cs_real_t pip, pjp, pipr, pjpr;
 
@@ -3512,8 +3635,8 @@ cs_face_convection_scalar(int                       idtvar,
                            cell_cen[ii],
                            cell_cen[jj],
                            i_face_cog[face_id],
-                           diipf[face_id],
-                           djjpf[face_id],
+                           diipf,
+                           djjpf,
                            grad[ii],
                            grad[jj],
                            gradup[ii],
@@ -3562,6 +3685,10 @@ cs_face_convection_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_t beta = blencp;
 
             cs_real_t pif, pjf;
@@ -3595,8 +3722,8 @@ cs_face_convection_scalar(int                       idtvar,
                                i_face_cog[face_id],
                                hybrid_coef_ii,
                                hybrid_coef_jj,
-                               diipf[face_id],
-                               djjpf[face_id],
+                               diipf,
+                               djjpf,
                                grad[ii],
                                grad[jj],
                                gradup[ii],
@@ -3696,6 +3823,10 @@ cs_face_convection_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             bool upwind_switch = false;
             cs_real_t pifri, pjfri, pifrj, pjfrj;
             cs_real_t pip, pjp, pipr, pjpr;
@@ -3719,8 +3850,8 @@ cs_face_convection_scalar(int                       idtvar,
                                       cell_cen[jj],
                                       i_face_normal[face_id],
                                       i_face_cog[face_id],
-                                      diipf[face_id],
-                                      djjpf[face_id],
+                                      diipf,
+                                      djjpf,
                                       i_massflux[face_id],
                                       grad[ii],
                                       grad[jj],
@@ -3784,6 +3915,10 @@ cs_face_convection_scalar(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             bool upwind_switch = false;
 
             cs_real_t pif, pjf;
@@ -3807,8 +3942,8 @@ cs_face_convection_scalar(int                       idtvar,
                                         cell_cen[jj],
                                         i_face_normal[face_id],
                                         i_face_cog[face_id],
-                                        diipf[face_id],
-                                        djjpf[face_id],
+                                        diipf,
+                                        djjpf,
                                         i_massflux[face_id],
                                         grad[ii],
                                         grad[jj],
@@ -4219,10 +4354,6 @@ cs_convection_diffusion_vector(int                         idtvar,
     = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -4459,6 +4590,10 @@ cs_convection_diffusion_vector(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -4499,8 +4634,8 @@ cs_convection_diffusion_vector(int                         idtvar,
 
             cs_i_cd_steady_upwind_vector(bldfrp,
                                          relaxp,
-                                         diipf[face_id],
-                                         djjpf[face_id],
+                                         diipf,
+                                         djjpf,
                                          (const cs_real_3_t *)grad[ii],
                                          (const cs_real_3_t *)grad[jj],
                                          _pi,
@@ -4563,6 +4698,10 @@ cs_convection_diffusion_vector(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -4597,8 +4736,8 @@ cs_convection_diffusion_vector(int                         idtvar,
               bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
 
             cs_i_cd_unsteady_upwind_vector(bldfrp,
-                                           diipf[face_id],
-                                           djjpf[face_id],
+                                           diipf,
+                                           djjpf,
                                            (const cs_real_3_t *)grad[ii],
                                            (const cs_real_3_t *)grad[jj],
                                            _pi,
@@ -4666,6 +4805,10 @@ cs_convection_diffusion_vector(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_t fluxi[3], fluxj[3] ;
             for (int isou =  0; isou < 3; isou++) {
               fluxi[isou] = 0;
@@ -4706,8 +4849,8 @@ cs_convection_diffusion_vector(int                         idtvar,
                                   cell_cen[ii],
                                   cell_cen[jj],
                                   i_face_cog[face_id],
-                                  diipf[face_id],
-                                  djjpf[face_id],
+                                  diipf,
+                                  djjpf,
                                   (const cs_real_3_t *)grad[ii],
                                   (const cs_real_3_t *)grad[jj],
                                   _pi,
@@ -4769,6 +4912,10 @@ cs_convection_diffusion_vector(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_t fluxi[3], fluxj[3] ;
             for (int isou =  0; isou < 3; isou++) {
               fluxi[isou] = 0;
@@ -4816,8 +4963,8 @@ cs_convection_diffusion_vector(int                         idtvar,
                                     i_face_cog[face_id],
                                     hybrid_coef_ii,
                                     hybrid_coef_jj,
-                                    diipf[face_id],
-                                    djjpf[face_id],
+                                    diipf,
+                                    djjpf,
                                     (const cs_real_3_t *)grad[ii],
                                     (const cs_real_3_t *)grad[jj],
                                     _pi,
@@ -4885,6 +5032,10 @@ cs_convection_diffusion_vector(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_t fluxi[3], fluxj[3] ;
             for (int isou =  0; isou < 3; isou++) {
               fluxi[isou] = 0;
@@ -4932,8 +5083,8 @@ cs_convection_diffusion_vector(int                         idtvar,
                                              cell_cen[jj],
                                              i_face_normal[face_id],
                                              i_face_cog[face_id],
-                                             diipf[face_id],
-                                             djjpf[face_id],
+                                             diipf,
+                                             djjpf,
                                              i_massflux[face_id],
                                              (const cs_real_3_t *)grad[ii],
                                              (const cs_real_3_t *)grad[jj],
@@ -4998,6 +5149,10 @@ cs_convection_diffusion_vector(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_t fluxi[3], fluxj[3] ;
             for (int isou =  0; isou < 3; isou++) {
               fluxi[isou] = 0;
@@ -5040,8 +5195,8 @@ cs_convection_diffusion_vector(int                         idtvar,
                                                cell_cen[jj],
                                                i_face_normal[face_id],
                                                i_face_cog[face_id],
-                                               diipf[face_id],
-                                               djjpf[face_id],
+                                               diipf,
+                                               djjpf,
                                                i_massflux[face_id],
                                                (const cs_real_3_t *)grad[ii],
                                                (const cs_real_3_t *)grad[jj],
@@ -5898,10 +6053,6 @@ cs_convection_diffusion_tensor(int                         idtvar,
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -6087,6 +6238,10 @@ cs_convection_diffusion_tensor(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -6106,8 +6261,8 @@ cs_convection_diffusion_tensor(int                         idtvar,
 
             cs_i_cd_steady_upwind_tensor(bldfrp,
                                          relaxp,
-                                         diipf[face_id],
-                                         djjpf[face_id],
+                                         diipf,
+                                         djjpf,
                                          (const cs_real_3_t *)grad[ii],
                                          (const cs_real_3_t *)grad[jj],
                                          _pvar[ii],
@@ -6170,6 +6325,10 @@ cs_convection_diffusion_tensor(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -6188,8 +6347,8 @@ cs_convection_diffusion_tensor(int                         idtvar,
               bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
 
             cs_i_cd_unsteady_upwind_tensor(bldfrp,
-                                           diipf[face_id],
-                                           djjpf[face_id],
+                                           diipf,
+                                           djjpf,
                                            (const cs_real_3_t *)grad[ii],
                                            (const cs_real_3_t *)grad[jj],
                                            _pvar[ii],
@@ -6259,6 +6418,10 @@ cs_convection_diffusion_tensor(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             double fluxi[6], fluxj[6] ;
             for (int isou =  0; isou < 6; isou++) {
               fluxi[isou] = 0;
@@ -6280,8 +6443,8 @@ cs_convection_diffusion_tensor(int                         idtvar,
                                   cell_cen[ii],
                                   cell_cen[jj],
                                   i_face_cog[face_id],
-                                  diipf[face_id],
-                                  djjpf[face_id],
+                                  diipf,
+                                  djjpf,
                                   (const cs_real_3_t *)grad[ii],
                                   (const cs_real_3_t *)grad[jj],
                                   _pvar[ii],
@@ -6343,6 +6506,10 @@ cs_convection_diffusion_tensor(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             double fluxi[6], fluxj[6] ;
             for (int isou =  0; isou < 6; isou++) {
               fluxi[isou] = 0;
@@ -6363,8 +6530,8 @@ cs_convection_diffusion_tensor(int                         idtvar,
                                     cell_cen[ii],
                                     cell_cen[jj],
                                     i_face_cog[face_id],
-                                    diipf[face_id],
-                                    djjpf[face_id],
+                                    diipf,
+                                    djjpf,
                                     (const cs_real_3_t *)grad[ii],
                                     (const cs_real_3_t *)grad[jj],
                                     _pvar[ii],
@@ -6430,6 +6597,10 @@ cs_convection_diffusion_tensor(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             double fluxi[6], fluxj[6] ;
             for (int isou =  0; isou < 6; isou++) {
               fluxi[isou] = 0;
@@ -6458,8 +6629,8 @@ cs_convection_diffusion_tensor(int                         idtvar,
                                              cell_cen[jj],
                                              i_face_normal[face_id],
                                              i_face_cog[face_id],
-                                             diipf[face_id],
-                                             djjpf[face_id],
+                                             diipf,
+                                             djjpf,
                                              i_massflux[face_id],
                                              (const cs_real_3_t *)grad[ii],
                                              (const cs_real_3_t *)grad[jj],
@@ -6524,6 +6695,10 @@ cs_convection_diffusion_tensor(int                         idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             double fluxi[6], fluxj[6] ;
             for (int isou =  0; isou < 6; isou++) {
               fluxi[isou] = 0;
@@ -6551,8 +6726,8 @@ cs_convection_diffusion_tensor(int                         idtvar,
                                                cell_cen[jj],
                                                i_face_normal[face_id],
                                                i_face_cog[face_id],
-                                               diipf[face_id],
-                                               djjpf[face_id],
+                                               diipf,
+                                               djjpf,
                                                i_massflux[face_id],
                                                (const cs_real_3_t *)grad[ii],
                                                (const cs_real_3_t *)grad[jj],
@@ -6867,10 +7042,6 @@ cs_convection_diffusion_thermal(int                       idtvar,
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -7150,6 +7321,10 @@ cs_convection_diffusion_thermal(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -7167,8 +7342,8 @@ cs_convection_diffusion_thermal(int                       idtvar,
 
             cs_i_cd_steady_upwind(bldfrp,
                                   relaxp,
-                                  diipf[face_id],
-                                  djjpf[face_id],
+                                  diipf,
+                                  djjpf,
                                   grad[ii],
                                   grad[jj],
                                   _pvar[ii],
@@ -7227,6 +7402,10 @@ cs_convection_diffusion_thermal(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             /* in parallel, face will be counted by one and only one rank */
             if (ii < n_cells) {
               n_upwind++;
@@ -7243,8 +7422,8 @@ cs_convection_diffusion_thermal(int                       idtvar,
               bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
 
             cs_i_cd_unsteady_upwind(bldfrp,
-                                    diipf[face_id],
-                                    djjpf[face_id],
+                                    diipf,
+                                    djjpf,
                                     grad[ii],
                                     grad[jj],
                                     _pvar[ii],
@@ -7309,6 +7488,10 @@ cs_convection_diffusion_thermal(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_2_t fluxij = {0.,0.};
 
             cs_real_t pifri, pjfri, pifrj, pjfrj;
@@ -7327,8 +7510,8 @@ cs_convection_diffusion_thermal(int                       idtvar,
                            cell_cen[ii],
                            cell_cen[jj],
                            i_face_cog[face_id],
-                           diipf[face_id],
-                           djjpf[face_id],
+                           diipf,
+                           djjpf,
                            grad[ii],
                            grad[jj],
                            gradup[ii],
@@ -7389,6 +7572,10 @@ cs_convection_diffusion_thermal(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_t beta = blencp;
 
             cs_real_t pif, pjf;
@@ -7420,8 +7607,8 @@ cs_convection_diffusion_thermal(int                       idtvar,
                                i_face_cog[face_id],
                                hybrid_coef_ii,
                                hybrid_coef_jj,
-                               diipf[face_id],
-                               djjpf[face_id],
+                               diipf,
+                               djjpf,
                                grad[ii],
                                grad[jj],
                                gradup[ii],
@@ -7492,8 +7679,8 @@ cs_convection_diffusion_thermal(int                       idtvar,
               cs_real_t recoi, recoj;
 
               cs_i_compute_quantities(bldfrp,
-                                      diipf[face_id],
-                                      djjpf[face_id],
+                                      diipf,
+                                      djjpf,
                                       grad[ii],
                                       grad[jj],
                                       _pvar[ii],
@@ -7516,8 +7703,8 @@ cs_convection_diffusion_thermal(int                       idtvar,
                                i_face_cog[face_id],
                                hybrid_coef_ii,
                                hybrid_coef_jj,
-                               diipf[face_id],
-                               djjpf[face_id],
+                               diipf,
+                               djjpf,
                                grad[ii],
                                grad[jj],
                                gradup[ii],
@@ -7590,6 +7777,10 @@ cs_convection_diffusion_thermal(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_2_t fluxij = {0.,0.};
 
             cs_real_t pifri, pjfri, pifrj, pjfrj;
@@ -7616,8 +7807,8 @@ cs_convection_diffusion_thermal(int                       idtvar,
                                       cell_cen[jj],
                                       i_face_normal[face_id],
                                       i_face_cog[face_id],
-                                      diipf[face_id],
-                                      djjpf[face_id],
+                                      diipf,
+                                      djjpf,
                                       i_massflux[face_id],
                                       grad[ii],
                                       grad[jj],
@@ -7693,6 +7884,10 @@ cs_convection_diffusion_thermal(int                       idtvar,
             cs_lnum_t ii = i_face_cells[face_id][0];
             cs_lnum_t jj = i_face_cells[face_id][1];
 
+            cs_real_t diipf[3], djjpf[3];
+            cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                  diipf, djjpf);
+
             cs_real_2_t fluxij = {0.,0.};
 
             bool upwind_switch = false;
@@ -7718,8 +7913,8 @@ cs_convection_diffusion_thermal(int                       idtvar,
                                         cell_cen[jj],
                                         i_face_normal[face_id],
                                         i_face_cog[face_id],
-                                        diipf[face_id],
-                                        djjpf[face_id],
+                                        diipf,
+                                        djjpf,
                                         i_massflux[face_id],
                                         grad[ii],
                                         grad[jj],
@@ -8949,10 +9144,6 @@ cs_anisotropic_left_diffusion_vector(int                         idtvar,
   const cs_real_3_t *restrict i_face_normal
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_t *restrict i_dist = fvq->i_dist;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -9092,6 +9283,10 @@ cs_anisotropic_left_diffusion_vector(int                         idtvar,
           cs_lnum_t ii = i_face_cells[face_id][0];
           cs_lnum_t jj = i_face_cells[face_id][1];
 
+          cs_real_t diipf[3], djjpf[3];
+          cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                diipf, djjpf);
+
           cs_real_t pip[3], pjp[3], pipr[3], pjpr[3];
 
           cs_real_t bldfrp = (cs_real_t) ircflp;
@@ -9116,13 +9311,13 @@ cs_anisotropic_left_diffusion_vector(int                         idtvar,
             cs_real_t pja = pvara[jj][isou];
 
             /* reconstruction only if IRCFLP = 1 */
-            pip[isou] = pi + bldfrp * (cs_math_3_dot_product(dpvf, diipf[face_id]));
-            pjp[isou] = pj + bldfrp * (cs_math_3_dot_product(dpvf, djjpf[face_id]));
+            pip[isou] = pi + bldfrp * (cs_math_3_dot_product(dpvf, diipf));
+            pjp[isou] = pj + bldfrp * (cs_math_3_dot_product(dpvf, djjpf));
 
             pipr[isou] = pi /relaxp - (1.-relaxp)/relaxp * pia
-                         + bldfrp * (cs_math_3_dot_product(dpvf, diipf[face_id]));
+                         + bldfrp * (cs_math_3_dot_product(dpvf, diipf));
             pjpr[isou] = pj /relaxp - (1.-relaxp)/relaxp * pja
-                         + bldfrp * (cs_math_3_dot_product(dpvf, djjpf[face_id]));
+                         + bldfrp * (cs_math_3_dot_product(dpvf, djjpf));
 
           }
 
@@ -9157,6 +9352,10 @@ cs_anisotropic_left_diffusion_vector(int                         idtvar,
           cs_lnum_t ii = i_face_cells[face_id][0];
           cs_lnum_t jj = i_face_cells[face_id][1];
 
+          cs_real_t diipf[3], djjpf[3];
+          cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                diipf, djjpf);
+
           cs_real_t pip[3], pjp[3];
 
           cs_real_t bldfrp = (cs_real_t) ircflp;
@@ -9177,8 +9376,8 @@ cs_anisotropic_left_diffusion_vector(int                         idtvar,
             cs_real_t pi = _pvar[ii][isou];
             cs_real_t pj = _pvar[jj][isou];
 
-            pip[isou] = pi + bldfrp * (cs_math_3_dot_product(dpvf, diipf[face_id]));
-            pjp[isou] = pj + bldfrp * (cs_math_3_dot_product(dpvf, djjpf[face_id]));
+            pip[isou] = pi + bldfrp * (cs_math_3_dot_product(dpvf, diipf));
+            pjp[isou] = pj + bldfrp * (cs_math_3_dot_product(dpvf, djjpf));
 
           }
 
@@ -10817,10 +11016,6 @@ cs_face_diffusion_potential(const int                 f_id,
     = (const cs_lnum_t *restrict)m->b_face_cells;
   const cs_real_t *restrict i_dist = fvq->i_dist;
   const cs_real_t *restrict i_f_face_surf = fvq->i_f_face_surf;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -11002,6 +11197,10 @@ cs_face_diffusion_potential(const int                 f_id,
           cs_lnum_t ii = i_face_cells[face_id][0];
           cs_lnum_t jj = i_face_cells[face_id][1];
 
+          cs_real_t diipf[3], djjpf[3];
+          cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                diipf, djjpf);
+
           double dpxf = 0.5*(  visel[ii]*grad[ii][0]
                              + visel[jj]*grad[jj][0]);
           double dpyf = 0.5*(  visel[ii]*grad[ii][1]
@@ -11010,9 +11209,9 @@ cs_face_diffusion_potential(const int                 f_id,
                              + visel[jj]*grad[jj][2]);
 
           /*---> Dij = IJ - (IJ.N) N = II' - JJ' */
-          double dijx = diipf[face_id][0] - djjpf[face_id][0];
-          double dijy = diipf[face_id][1] - djjpf[face_id][1];
-          double dijz = diipf[face_id][2] - djjpf[face_id][2];
+          double dijx = diipf[0] - djjpf[0];
+          double dijy = diipf[1] - djjpf[1];
+          double dijz = diipf[2] - djjpf[2];
 
           i_massflux[face_id] =  i_massflux[face_id]
                                + i_visc[face_id]*(pvar[ii] - pvar[jj])
@@ -11656,10 +11855,6 @@ cs_diffusion_potential(const int                 f_id,
     = (const cs_lnum_t *restrict)m->b_face_cells;
   const cs_real_t *restrict i_dist = fvq->i_dist;
   const cs_real_t *restrict i_f_face_surf = fvq->i_f_face_surf;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -11859,14 +12054,18 @@ cs_diffusion_potential(const int                 f_id,
           cs_lnum_t ii = i_face_cells[face_id][0];
           cs_lnum_t jj = i_face_cells[face_id][1];
 
+          cs_real_t diipf[3], djjpf[3];
+          cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                                diipf, djjpf);
+
           double i_massflux = i_visc[face_id]*(pvar[ii] - pvar[jj]);
 
           if (mass_flux_rec_type == 0) {
 
             /*---> Dij = IJ - (IJ.N) N = II' - JJ' */
-            double dijx = diipf[face_id][0] - djjpf[face_id][0];
-            double dijy = diipf[face_id][1] - djjpf[face_id][1];
-            double dijz = diipf[face_id][2] - djjpf[face_id][2];
+            double dijx = diipf[0] - djjpf[0];
+            double dijy = diipf[1] - djjpf[1];
+            double dijz = diipf[2] - djjpf[2];
 
             double dpxf = 0.5*(  visel[ii]*grad[ii][0]
                                + visel[jj]*grad[jj][0]);
@@ -11880,8 +12079,8 @@ cs_diffusion_potential(const int                 f_id,
           }
           else {
             i_massflux += i_visc[face_id]*
-                          ( cs_math_3_dot_product(grad[ii], diipf[face_id])
-                          - cs_math_3_dot_product(grad[jj], djjpf[face_id]));
+                          ( cs_math_3_dot_product(grad[ii], diipf)
+                          - cs_math_3_dot_product(grad[jj], djjpf));
           }
 
           diverg[ii] += i_massflux;
@@ -58,6 +58,7 @@
 #include "cs_gradient.h"
 #include "cs_gradient_perio.h"
 #include "cs_ext_neighborhood.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parameters.h"
 #include "cs_porous_model.h"
@@ -441,8 +442,6 @@ cs_mass_flux(const cs_mesh_t          *m,
 
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
 
   char var_name[64];
 
@@ -796,9 +795,12 @@ cs_mass_flux(const cs_mesh_t          *m,
           cs_lnum_t ii = i_face_cells[face_id][0];
           cs_lnum_t jj = i_face_cells[face_id][1];
 
-          double dofx = dofij[face_id][0];
-          double dofy = dofij[face_id][1];
-          double dofz = dofij[face_id][2];
+          cs_real_t dofij[3];
+          cs_mesh_quantities_i_face_dofij(fvq, face_id, ii, jj, dofij);
+
+          double dofx = dofij[0];
+          double dofy = dofij[1];
+          double dofz = dofij[2];
 
           cs_real_t w_i = weight[face_id] * i_f_face_factor[is_p*face_id][0];
           cs_real_t w_j = (1. - weight[face_id]) * i_f_face_factor[is_p*face_id][1];
@@ -976,8 +978,6 @@ cs_tensor_face_flux(const cs_mesh_t          *m,
     = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
 
   /* Local variables */
 
@@ -1306,6 +1306,9 @@ cs_tensor_face_flux(const cs_mesh_t          *m,
           cs_lnum_t ii = i_face_cells[face_id][0];
           cs_lnum_t jj = i_face_cells[face_id][1];
 
+          cs_real_t dofij[3];
+          cs_mesh_quantities_i_face_dofij(fvq, face_id, ii, jj, dofij);
+
           cs_real_t w_i = weight[face_id];
           cs_real_t w_j = (1. - weight[face_id]);
 
@@ -1315,9 +1318,9 @@ cs_tensor_face_flux(const cs_mesh_t          *m,
             /* Non-reconstructed face value */
             f_mass_var[isou] = w_i * c_mass_var[ii][isou] + w_j * c_mass_var[jj][isou]
               /* Reconstruction: face gradient times OF */
-              + 0.5*(c_grad_mvar[ii][isou][0] +c_grad_mvar[jj][isou][0])*dofij[face_id][0]
-              + 0.5*(c_grad_mvar[ii][isou][1] +c_grad_mvar[jj][isou][1])*dofij[face_id][1]
-              + 0.5*(c_grad_mvar[ii][isou][2] +c_grad_mvar[jj][isou][2])*dofij[face_id][2];
+              + 0.5*(c_grad_mvar[ii][isou][0] +c_grad_mvar[jj][isou][0])*dofij[0]
+              + 0.5*(c_grad_mvar[ii][isou][1] +c_grad_mvar[jj][isou][1])*dofij[1]
+              + 0.5*(c_grad_mvar[ii][isou][2] +c_grad_mvar[jj][isou][2])*dofij[2];
 
           cs_math_sym_33_3_product_add(f_mass_var,
                                        i_f_face_normal[face_id],
@@ -1450,6 +1453,28 @@ cs_divergence(const cs_mesh_t          *m,
               _("invalid value of init"));
   }
 
+  /* Cell-based gather of interior and boundary face fluxes
+     (no face coloring required) */
+
+  const cs_adjacency_t *c2f = cs_mesh_adjacencies_gather_c2f(m);
+
+  if (c2f != NULL) {
+
+    const cs_lnum_t n_i_faces = m->n_i_faces;
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      for (cs_lnum_t j = c2f->idx[cell_id]; j < c2f->idx[cell_id+1]; j++) {
+        cs_lnum_t face_id = c2f->ids[j];
+        if (face_id < n_i_faces)
+          diverg[cell_id] += c2f->sgn[j] * i_massflux[face_id];
+        else
+          diverg[cell_id] += b_massflux[face_id - n_i_faces];
+      }
+    }
+
+    return;
+  }
 
   /*==========================================================================
     2. Integration on internal faces
@@ -1658,10 +1683,6 @@ cs_ext_force_flux(const cs_mesh_t          *m,
     = (const cs_real_3_t *restrict)fvq->b_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
 
   /*Additional terms due to porosity */
   cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
@@ -1773,6 +1794,10 @@ cs_ext_force_flux(const cs_mesh_t          *m,
       cs_lnum_t ii = i_face_cells[face_id][0];
       cs_lnum_t jj = i_face_cells[face_id][1];
 
+      cs_real_t diipf[3], djjpf[3];
+      cs_mesh_quantities_i_face_sup_vectors(fvq, face_id, ii, jj,
+                                            diipf, djjpf);
+
       cs_real_2_t poro = {
         i_poro_duq_0[is_p*face_id],
         i_poro_duq_1[is_p*face_id]
@@ -1797,12 +1822,12 @@ cs_ext_force_flux(const cs_mesh_t          *m,
                                               - poro[1]
                                               )
                             + surfn/i_dist[face_id]*0.5
-                             *( (djjpf[face_id][0]-diipf[face_id][0])*( viselx[ii]*frcxt[ii][0]
-                                                                       +viselx[jj]*frcxt[jj][0] )
-                               +(djjpf[face_id][1]-diipf[face_id][1])*( visely[ii]*frcxt[ii][1]
-                                                                       +visely[jj]*frcxt[jj][1] )
-                               +(djjpf[face_id][2]-diipf[face_id][2])*( viselz[ii]*frcxt[ii][2]
-                                                                       +viselz[jj]*frcxt[jj][2] )
+                             *( (djjpf[0]-diipf[0])*( viselx[ii]*frcxt[ii][0]
+                                                     +viselx[jj]*frcxt[jj][0] )
+                               +(djjpf[1]-diipf[1])*( visely[ii]*frcxt[ii][1]
+                                                     +visely[jj]*frcxt[jj][1] )
+                               +(djjpf[2]-diipf[2])*( viselz[ii]*frcxt[ii][2]
+                                                     +viselz[jj]*frcxt[jj][2] )
                               );
 
     }
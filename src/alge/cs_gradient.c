@@ -125,6 +125,17 @@ typedef struct _cs_gradient_info_t {
 
 } cs_gradient_info_t;
 
+/* Precomputed cell to neighbor-cell least-squares operator */
+
+typedef struct {
+
+  cs_lnum_t     *idx;              /* Row index (size: n_cells + 1) */
+  cs_lnum_t     *ids;              /* Neighbor cell ids (size: idx[n_cells]) */
+  cs_real_3_t   *w;                /* Weights d_ij / |d_ij|^2 of neighbor
+                                      cell differences */
+
+} cs_gradient_lsq_op_t;
+
 /* Structure associated to gradient quantities management */
 
 typedef struct {
@@ -142,6 +153,10 @@ typedef struct {
   cs_real_33_t  *cocg_lsq_ext;     /* Interleaved cocg matrix for least
                                       squares gradients with ext. neighbors */
 
+  cs_gradient_lsq_op_t  *lsq_op;      /* Least squares neighbor operator */
+  cs_gradient_lsq_op_t  *lsq_op_ext;  /* Least squares neighbor operator
+                                         with ext. neighbors */
+
 } cs_gradient_quantities_t;
 
 /*============================================================================
@@ -173,6 +188,10 @@ static int _gradient_stat_id = -1;
 static int                        _n_gradient_quantities = 0;
 static cs_gradient_quantities_t  *_gradient_quantities = NULL;
 
+/* Use precomputed operator for least-squares gradient right-hand sides */
+
+static bool _lsq_op_cache = false;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -233,6 +252,27 @@ cs_f_gradient_weighted_s(int               f_id,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Destroy a least-squares neighbor operator.
+ *
+ * \param[in, out]  op  pointer to operator pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_lsq_op_destroy(cs_gradient_lsq_op_t  **op)
+{
+  cs_gradient_lsq_op_t  *_op = *op;
+
+  if (_op != NULL) {
+    BFT_FREE(_op->idx);
+    BFT_FREE(_op->ids);
+    BFT_FREE(_op->w);
+    BFT_FREE(*op);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return a gradient quantities structure, adding one if needed
@@ -258,6 +298,8 @@ _gradient_quantities_get(int id)
       gq->cocg_lsq = NULL;
       gq->cocgb_s_lsq_ext = NULL;
       gq->cocg_lsq_ext = NULL;
+      gq->lsq_op = NULL;
+      gq->lsq_op_ext = NULL;
     }
 
     _n_gradient_quantities = id+1;
@@ -286,6 +328,9 @@ _gradient_quantities_destroy(void)
     BFT_FREE(gq->cocgb_s_lsq_ext);
     BFT_FREE(gq->cocg_lsq_ext);
 
+    _lsq_op_destroy(&(gq->lsq_op));
+    _lsq_op_destroy(&(gq->lsq_op_ext));
+
   }
 
   BFT_FREE(_gradient_quantities);
@@ -1202,6 +1247,43 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
   BFT_FREE(buf);
 }
 
+/*----------------------------------------------------------------------------
+ * Return the number of cache blocking tiles usable to fuse face and cell
+ * loops tile by tile.
+ *
+ * Tiles are usable if cells, interior faces and boundary faces share the
+ * same tiles and faces are not numbered for threads (as faces of a tile
+ * may contribute to cells of the following tiles, tiles are handled
+ * in order).
+ *
+ * parameters:
+ *   m  <-- pointer to associated mesh structure
+ *
+ * returns:
+ *   number of usable tiles, or 0
+ *----------------------------------------------------------------------------*/
+
+static int
+_n_fused_tiles(const cs_mesh_t  *m)
+{
+  const cs_numbering_t *c_num = m->cell_numbering;
+  const cs_numbering_t *i_num = m->i_face_numbering;
+  const cs_numbering_t *b_num = m->b_face_numbering;
+
+  if (c_num == NULL || i_num == NULL || b_num == NULL)
+    return 0;
+
+  if (i_num->n_threads > 1 || b_num->n_threads > 1)
+    return 0;
+
+  if (   c_num->n_tiles < 1
+      || i_num->n_tiles != c_num->n_tiles
+      || b_num->n_tiles != c_num->n_tiles)
+    return 0;
+
+  return c_num->n_tiles;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize gradient and right-hand side for scalar gradient reconstruction.
  *
@@ -1244,6 +1326,7 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
 {
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
   const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
   const int n_i_groups = m->i_face_numbering->n_groups;
   const int n_i_threads = m->i_face_numbering->n_threads;
   const int n_b_groups = m->b_face_numbering->n_groups;
@@ -1274,6 +1357,8 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
   const cs_real_3_t *restrict b_face_cog
     = (const cs_real_3_t *restrict)fvq->b_face_cog;
 
+  const cs_adjacency_t *c2f = cs_mesh_adjacencies_gather_c2f(m);
+
   bool  *coupled_faces = (cpl == NULL) ?
     NULL : (bool *)cpl->coupled_faces;
 
@@ -1306,6 +1391,84 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
       grad[cell_id][j] = 0.0;
   }
 
+  /* Cache blocking tiles: face and cell loops are fused tile by tile;
+     cells of a tile are complete once its faces are handled, as
+     interior faces belong to the tile of their lowest adjacent cell */
+
+  const int n_tiles = (hyd_p_flag == 0 && cpl == NULL && c2f == NULL) ?
+    _n_fused_tiles(m) : 0;
+
+  if (n_tiles > 0) {
+
+    const cs_lnum_t *c_tile_index = m->cell_numbering->tile_index;
+    const cs_lnum_t *i_tile_index = m->i_face_numbering->tile_index;
+    const cs_lnum_t *b_tile_index = m->b_face_numbering->tile_index;
+
+    for (int t_id = 0; t_id < n_tiles; t_id++) {
+
+      /* Contribution from interior faces */
+
+      for (cs_lnum_t f_id = i_tile_index[t_id];
+           f_id < i_tile_index[t_id+1];
+           f_id++) {
+
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
+
+        cs_real_t ktpond = (c_weight == NULL) ?
+           weight[f_id] :              /* no cell weighting */
+           weight[f_id] * c_weight[ii] /* cell weighting active */
+             / (      weight[f_id] * c_weight[ii]
+               + (1.0-weight[f_id])* c_weight[jj]);
+
+        cs_real_t pfaci = (1.0-ktpond) * (pvar[jj] - pvar[ii]);
+        cs_real_t pfacj =     -ktpond  * (pvar[jj] - pvar[ii]);
+
+        for (cs_lnum_t j = 0; j < 3; j++) {
+          grad[ii][j] += pfaci * i_f_face_normal[f_id][j];
+          grad[jj][j] -= pfacj * i_f_face_normal[f_id][j];
+        }
+
+      }
+
+      /* Contribution from boundary faces */
+
+      for (cs_lnum_t f_id = b_tile_index[t_id];
+           f_id < b_tile_index[t_id+1];
+           f_id++) {
+
+        cs_lnum_t ii = b_face_cells[f_id];
+
+        cs_real_t pfac =   inc*coefap[f_id]
+                         + (coefbp[f_id]-1.0)*pvar[ii];
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          grad[ii][j] += pfac * b_f_face_normal[f_id][j];
+
+      }
+
+      /* Cells of this tile */
+
+      for (cs_lnum_t cell_id = c_tile_index[t_id];
+           cell_id < c_tile_index[t_id+1];
+           cell_id++) {
+        cs_real_t dvol;
+        if (has_dc * c_disable_flag[has_dc * cell_id] == 0)
+          dvol = 1. / cell_f_vol[cell_id];
+        else
+          dvol = 0.;
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          grad[cell_id][j] *= dvol;
+      }
+
+    } /* loop on tiles */
+
+    _sync_scalar_gradient_halo(m, CS_HALO_EXTENDED, idimtr, grad);
+
+    return;
+  }
+
   /* Case with hydrostatic pressure */
   /*--------------------------------*/
 
@@ -1423,14 +1586,18 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
 
     /* Contribution from interior faces */
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+    if (c2f != NULL) {
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      /* Cell-based gather: each cell sums its own face contributions */
 
-        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             f_id++) {
+#     pragma omp parallel for if(n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+        for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
+
+          const cs_lnum_t f_id = c2f->ids[i];
+          if (f_id >= n_i_faces)
+            continue;
 
           cs_lnum_t ii = i_face_cells[f_id][0];
           cs_lnum_t jj = i_face_cells[f_id][1];
@@ -1441,27 +1608,65 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
                / (      weight[f_id] * c_weight[ii]
                  + (1.0-weight[f_id])* c_weight[jj]);
 
-          /*
-             Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
-                                      + (1-\alpha_\ij) \varia_\cellj\f$
-                     but for the cell \f$ \celli \f$ we remove
-                     \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-                     and for the cell \f$ \cellj \f$ we remove
-                     \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
-          */
-          cs_real_t pfaci = (1.0-ktpond) * (pvar[jj] - pvar[ii]);
-          cs_real_t pfacj =     -ktpond  * (pvar[jj] - pvar[ii]);
-
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            grad[ii][j] += pfaci * i_f_face_normal[f_id][j];
-            grad[jj][j] -= pfacj * i_f_face_normal[f_id][j];
+          if (c2f->sgn[i] > 0) {
+            cs_real_t pfaci = (1.0-ktpond) * (pvar[jj] - pvar[ii]);
+            for (cs_lnum_t j = 0; j < 3; j++)
+              grad[c_id][j] += pfaci * i_f_face_normal[f_id][j];
+          }
+          else {
+            cs_real_t pfacj =     -ktpond  * (pvar[jj] - pvar[ii]);
+            for (cs_lnum_t j = 0; j < 3; j++)
+              grad[c_id][j] -= pfacj * i_f_face_normal[f_id][j];
           }
 
-        } /* loop on faces */
+        } /* loop on cell faces */
 
-      } /* loop on threads */
+      } /* loop on cells */
 
-    } /* loop on thread groups */
+    }
+    else {
+
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+          for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+               f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+               f_id++) {
+
+            cs_lnum_t ii = i_face_cells[f_id][0];
+            cs_lnum_t jj = i_face_cells[f_id][1];
+
+            cs_real_t ktpond = (c_weight == NULL) ?
+               weight[f_id] :              /* no cell weighting */
+               weight[f_id] * c_weight[ii] /* cell weighting active */
+                 / (      weight[f_id] * c_weight[ii]
+                   + (1.0-weight[f_id])* c_weight[jj]);
+
+            /*
+               Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
+                                        + (1-\alpha_\ij) \varia_\cellj\f$
+                       but for the cell \f$ \celli \f$ we remove
+                       \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
+                       and for the cell \f$ \cellj \f$ we remove
+                       \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
+            */
+            cs_real_t pfaci = (1.0-ktpond) * (pvar[jj] - pvar[ii]);
+            cs_real_t pfacj =     -ktpond  * (pvar[jj] - pvar[ii]);
+
+            for (cs_lnum_t j = 0; j < 3; j++) {
+              grad[ii][j] += pfaci * i_f_face_normal[f_id][j];
+              grad[jj][j] -= pfacj * i_f_face_normal[f_id][j];
+            }
+
+          } /* loop on faces */
+
+        } /* loop on threads */
+
+      } /* loop on thread groups */
+
+    }
 
     /* Contribution from coupled faces */
     if (cpl != NULL)
@@ -1553,8 +1758,6 @@ _compute_cell_cocg_it(const cs_mesh_t               *m,
   const cs_real_t *restrict cell_vol = fvq->cell_vol;
   const cs_real_3_t *restrict i_face_normal
     = (const cs_real_3_t *restrict)fvq->i_face_normal;
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
 
   cs_real_33_t *restrict cocg = gq->cocg_it;
 
@@ -1587,12 +1790,15 @@ _compute_cell_cocg_it(const cs_mesh_t               *m,
     cs_lnum_t cell_id1 = i_face_cells[f_id][0];
     cs_lnum_t cell_id2 = i_face_cells[f_id][1];
 
+    cs_real_t dofij[3];
+    cs_mesh_quantities_i_face_dofij(fvq, f_id, cell_id1, cell_id2, dofij);
+
     dvol1 = 1./cell_vol[cell_id1];
     dvol2 = 1./cell_vol[cell_id2];
 
     for (i = 0; i < 3; i++) {
 
-      pfac = -0.5*dofij[f_id][i];
+      pfac = -0.5*dofij[i];
 
       for (j = 0; j < 3; j++) {
         vecfac = pfac*i_face_normal[f_id][j];
@@ -1698,8 +1904,6 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
     = (const cs_real_3_t *restrict)fvq->b_face_cog;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
 
   cs_real_3_t *rhs;
 
@@ -1794,6 +1998,9 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
             cs_lnum_t c_id1 = i_face_cells[f_id][0];
             cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
+            cs_real_t dofij[3];
+            cs_mesh_quantities_i_face_dofij(fvq, f_id, c_id1, c_id2, dofij);
+
             cs_real_t ktpond = (c_weight == NULL) ?
               weight[f_id] :                     // no cell weighting
               weight[f_id]  * c_weight[c_id1] // cell weighting active
@@ -1836,9 +2043,9 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
                    + (i_face_cog[f_id][2]-cell_cen[c_id2][2])
                     *((1.0 - ktpond)*f_ext[c_id2][2]-(1.-weight[f_id])*fexd[2])
                    + (1.0 - ktpond)*poro[1]
-               + ( dofij[f_id][0] * (grad[c_id1][0]+grad[c_id2][0])
-                 + dofij[f_id][1] * (grad[c_id1][1]+grad[c_id2][1])
-                 + dofij[f_id][2] * (grad[c_id1][2]+grad[c_id2][2]))*0.5;
+               + ( dofij[0] * (grad[c_id1][0]+grad[c_id2][0])
+                 + dofij[1] * (grad[c_id1][1]+grad[c_id2][1])
+                 + dofij[2] * (grad[c_id1][2]+grad[c_id2][2]))*0.5;
 
             cs_real_t pfacj = pfaci;
 
@@ -1921,6 +2128,9 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
             cs_lnum_t c_id1 = i_face_cells[f_id][0];
             cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
+            cs_real_t dofij[3];
+            cs_mesh_quantities_i_face_dofij(fvq, f_id, c_id1, c_id2, dofij);
+
             /*
                Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
                                         + (1-\alpha_\ij) \varia_\cellj\f$
@@ -1932,9 +2142,9 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
 
             /* Reconstruction part */
             cs_real_t pfaci
-              = 0.5 * (  dofij[f_id][0] * (grad[c_id1][0]+grad[c_id2][0])
-                       + dofij[f_id][1] * (grad[c_id1][1]+grad[c_id2][1])
-                       + dofij[f_id][2] * (grad[c_id1][2]+grad[c_id2][2]));
+              = 0.5 * (  dofij[0] * (grad[c_id1][0]+grad[c_id2][0])
+                       + dofij[1] * (grad[c_id1][1]+grad[c_id2][1])
+                       + dofij[2] * (grad[c_id1][2]+grad[c_id2][2]));
             cs_real_t pfacj = pfaci;
 
             cs_real_t ktpond = (c_weight == NULL) ?
@@ -2338,6 +2548,223 @@ _get_cell_cocg_lsq(const cs_mesh_t               *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build cell to neighbor-cell operator for least squares gradients.
+ *
+ * For each local cell i, neighbors j (through interior faces and optionally
+ * the extended neighborhood) are stored with the weight d_ij / |d_ij|^2,
+ * so that the geometric right-hand side contribution is obtained as
+ * sum_j w_ij (p_j - p_i), in the same manner as a sparse matrix-vector
+ * product.
+ *
+ * parameters:
+ *   m         <--  mesh
+ *   extended  <--  use extended neighborhood
+ *   fvq       <--  mesh quantities
+ *
+ * returns:
+ *   pointer to newly created operator
+ *----------------------------------------------------------------------------*/
+
+static cs_gradient_lsq_op_t *
+_lsq_op_create(const cs_mesh_t             *m,
+               bool                         extended,
+               const cs_mesh_quantities_t  *fvq)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+
+  cs_gradient_lsq_op_t *op;
+  BFT_MALLOC(op, 1, cs_gradient_lsq_op_t);
+
+  /* Count neighbors */
+
+  cs_lnum_t *idx;
+  BFT_MALLOC(idx, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells + 1; c_id++)
+    idx[c_id] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t ii = i_face_cells[f_id][0];
+    cs_lnum_t jj = i_face_cells[f_id][1];
+    if (ii < n_cells)
+      idx[ii+1] += 1;
+    if (jj < n_cells)
+      idx[jj+1] += 1;
+  }
+
+  if (extended) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      idx[c_id+1] += cell_cells_idx[c_id+1] - cell_cells_idx[c_id];
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    idx[c_id+1] += idx[c_id];
+
+  /* Fill structure; interior face neighbors are added first, in face order,
+     followed by extended neighbors. */
+
+  cs_lnum_t *ids, *count;
+  cs_real_3_t *w;
+  BFT_MALLOC(ids, idx[n_cells], cs_lnum_t);
+  BFT_MALLOC(w, idx[n_cells], cs_real_3_t);
+  BFT_MALLOC(count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    count[c_id] = idx[c_id];
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+    cs_lnum_t ii = i_face_cells[f_id][0];
+    cs_lnum_t jj = i_face_cells[f_id][1];
+
+    cs_real_t dc[3];
+    for (cs_lnum_t ll = 0; ll < 3; ll++)
+      dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+    cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+    if (ii < n_cells) {
+      cs_lnum_t k = count[ii]++;
+      ids[k] = jj;
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        w[k][ll] = dc[ll] * ddc;
+    }
+    if (jj < n_cells) {
+      cs_lnum_t k = count[jj]++;
+      ids[k] = ii;
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        w[k][ll] = - dc[ll] * ddc;
+    }
+
+  }
+
+  if (extended) {
+
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        cs_lnum_t jj = cell_cells_lst[cidx];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        cs_lnum_t k = count[ii]++;
+        ids[k] = jj;
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          w[k][ll] = dc[ll] * ddc;
+
+      }
+    }
+
+  }
+
+  BFT_FREE(count);
+
+  op->idx = idx;
+  op->ids = ids;
+  op->w = w;
+
+  return op;
+}
+
+/*----------------------------------------------------------------------------
+ * Return precomputed least squares neighbor operator if available.
+ *
+ * The operator is built on first use, and only if its use is enabled
+ * (see cs_gradient_set_lsq_operator_cache) and no internal coupling
+ * is present.
+ *
+ * parameters:
+ *   m          <--  mesh
+ *   halo_type  <--  halo type
+ *   fvq        <--  mesh quantities
+ *   ce         <--  coupling entity, or NULL
+ *
+ * returns:
+ *   pointer to operator, or NULL if not applicable
+ *----------------------------------------------------------------------------*/
+
+static const cs_gradient_lsq_op_t *
+_get_lsq_op(const cs_mesh_t               *m,
+            cs_halo_type_t                 halo_type,
+            const cs_mesh_quantities_t    *fvq,
+            const cs_internal_coupling_t  *ce)
+{
+  if (_lsq_op_cache == false || ce != NULL)
+    return NULL;
+
+  cs_gradient_quantities_t  *gq = _gradient_quantities_get(0);
+
+  bool extended = (   halo_type == CS_HALO_EXTENDED
+                   && m->cell_cells_idx) ? true : false;
+
+  if (extended) {
+    if (gq->lsq_op_ext == NULL)
+      gq->lsq_op_ext = _lsq_op_create(m, true, fvq);
+    return gq->lsq_op_ext;
+  }
+  else {
+    if (gq->lsq_op == NULL)
+      gq->lsq_op = _lsq_op_create(m, false, fvq);
+    return gq->lsq_op;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add neighborhood contribution to right-hand side of least squares
+ * gradient of a strided variable, using precomputed operator.
+ *
+ * The right-hand side is interleaved as rhs[c_id][i][j], with i the
+ * variable component (< stride) and j the gradient direction (< 3).
+ *
+ * parameters:
+ *   op        <--  least squares neighbor operator
+ *   n_cells   <--  number of local cells
+ *   stride    <--  variable stride
+ *   pvar      <--  variable (with synchronized halo)
+ *   rhs       <->  right-hand side
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_op_strided_rhs(const cs_gradient_lsq_op_t  *op,
+                    cs_lnum_t                    n_cells,
+                    cs_lnum_t                    stride,
+                    const cs_real_t    *restrict pvar,
+                    cs_real_t          *restrict rhs)
+{
+  const cs_lnum_t *restrict idx = op->idx;
+  const cs_lnum_t *restrict ids = op->ids;
+  const cs_real_3_t *restrict w = (const cs_real_3_t *restrict)op->w;
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_real_t *pi = pvar + c_id*stride;
+    cs_real_t *_rhs = rhs + c_id*stride*3;
+    for (cs_lnum_t k = idx[c_id]; k < idx[c_id+1]; k++) {
+      const cs_real_t *pj = pvar + ids[k]*stride;
+      for (cs_lnum_t i = 0; i < stride; i++) {
+        cs_real_t pfac = pj[i] - pi[i];
+        for (cs_lnum_t j = 0; j < 3; j++)
+          _rhs[i*3 + j] += w[k][j] * pfac;
+      }
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1).
@@ -2428,6 +2855,10 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
                      &cocg,
                      &cocgb);
 
+  const cs_gradient_lsq_op_t *lsq_op = NULL;
+  if (c_weight == NULL)
+    lsq_op = _get_lsq_op(m, halo_type, fvq, cpl);
+
   int        g_id, t_id;
 
   /*Additional terms due to porosity */
@@ -2532,95 +2963,125 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   if (hyd_p_flag == 0) {
 
-    /* Contribution from interior faces */
+    if (lsq_op != NULL) {
 
-    for (g_id = 0; g_id < n_i_groups; g_id++) {
+      /* Contribution from interior faces and extended neighborhood,
+         using precomputed operator */
 
-#     pragma omp parallel for
-      for (t_id = 0; t_id < n_i_threads; t_id++) {
+      const cs_lnum_t *restrict op_idx = lsq_op->idx;
+      const cs_lnum_t *restrict op_ids = lsq_op->ids;
+      const cs_real_3_t *restrict op_w
+        = (const cs_real_3_t *restrict)lsq_op->w;
 
-        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             f_id++) {
+#     pragma omp parallel for if(n_cells > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+        cs_real_t pi = pvar[ii];
+        cs_real_t fctb[3] = {0., 0., 0.};
+        for (cs_lnum_t k = op_idx[ii]; k < op_idx[ii+1]; k++) {
+          cs_real_t pfac = pvar[op_ids[k]] - pi;
+          fctb[0] += op_w[k][0] * pfac;
+          fctb[1] += op_w[k][1] * pfac;
+          fctb[2] += op_w[k][2] * pfac;
+        }
+        rhsv[ii][0] = fctb[0];
+        rhsv[ii][1] = fctb[1];
+        rhsv[ii][2] = fctb[2];
+      }
 
-          cs_lnum_t ii = i_face_cells[f_id][0];
-          cs_lnum_t jj = i_face_cells[f_id][1];
+    }
+    else {
 
-          cs_real_t pond = weight[f_id];
+      /* Contribution from interior faces */
 
-          cs_real_t pfac, dc[3], fctb[4];
+      for (g_id = 0; g_id < n_i_groups; g_id++) {
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+#       pragma omp parallel for
+        for (t_id = 0; t_id < n_i_threads; t_id++) {
 
-          if (c_weight != NULL) {
-            /* (P_j - P_i) / ||d||^2 */
-            pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+               f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+               f_id++) {
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              fctb[ll] = dc[ll] * pfac;
+            cs_lnum_t ii = i_face_cells[f_id][0];
+            cs_lnum_t jj = i_face_cells[f_id][1];
 
-            cs_real_t denom = 1. / (  pond       *c_weight[ii]
-                                    + (1. - pond)*c_weight[jj]);
+            cs_real_t pond = weight[f_id];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
+            cs_real_t pfac, dc[3], fctb[4];
 
             for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
-          }
-          else {
-            /* (P_j - P_i) / ||d||^2 */
-            pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              fctb[ll] = dc[ll] * pfac;
+            if (c_weight != NULL) {
+              /* (P_j - P_i) / ||d||^2 */
+              pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                     / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] += fctb[ll];
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                fctb[ll] = dc[ll] * pfac;
+
+              cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                      + (1. - pond)*c_weight[jj]);
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
+            }
+            else {
+              /* (P_j - P_i) / ||d||^2 */
+              pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                     / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                fctb[ll] = dc[ll] * pfac;
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] += fctb[ll];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] += fctb[ll];
-          }
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] += fctb[ll];
+            }
 
-        } /* loop on faces */
+          } /* loop on faces */
 
-      } /* loop on threads */
+        } /* loop on threads */
 
-    } /* loop on thread groups */
+      } /* loop on thread groups */
 
-    /* Contribution from extended neighborhood */
+      /* Contribution from extended neighborhood */
 
-    if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
+      if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
 
-#     pragma omp parallel for
-      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
-        for (cs_lnum_t cidx = cell_cells_idx[ii];
-             cidx < cell_cells_idx[ii+1];
-             cidx++) {
+#       pragma omp parallel for
+        for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+          for (cs_lnum_t cidx = cell_cells_idx[ii];
+               cidx < cell_cells_idx[ii+1];
+               cidx++) {
 
-          cs_lnum_t jj = cell_cells_lst[cidx];
+            cs_lnum_t jj = cell_cells_lst[cidx];
 
-          cs_real_t pfac, dc[3], fctb[4];
+            cs_real_t pfac, dc[3], fctb[4];
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
-          pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                 / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+            pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            fctb[ll] = dc[ll] * pfac;
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              fctb[ll] = dc[ll] * pfac;
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[ii][ll] += fctb[ll];
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[ii][ll] += fctb[ll];
 
+          }
         }
-      }
 
-    } /* End for extended neighborhood */
+      } /* End for extended neighborhood */
+
+    }
 
     /* Contribution from coupled faces */
 
@@ -2876,6 +3337,296 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   BFT_FREE(rhsv);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalars using least-squares
+ * reconstruction for non-orthogonal meshes (nswrgp > 1).
+ *
+ * This is equivalent to calling _lsq_scalar_gradient for each scalar,
+ * without hydrostatic pressure, cell weighting, or internal coupling,
+ * but values are interleaved so that each face adjacency is traversed
+ * only once for all scalars, and halos are synchronized in a single
+ * exchange.
+ *
+ * Boundary cell cocg matrices are recomputed locally for each scalar
+ * (when requested), and the saved cocg array is updated with those of
+ * the last scalar. Operations are the same as in _lsq_scalar_gradient,
+ * so results are bit for bit identical.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   madj           <-- pointer to mesh adjacencies structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   n_vars         <-- number of scalars
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *                      for each scalar
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *                      for each scalar
+ *   pvar           <-- interleaved variables (pvar[c_id*n_vars + v_id])
+ *   grad           --> interleaved gradients (grad[c_id*n_vars + v_id])
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t               *m,
+                           const cs_mesh_adjacencies_t   *madj,
+                           const cs_mesh_quantities_t    *fvq,
+                           cs_halo_type_t                 halo_type,
+                           bool                           recompute_cocg,
+                           cs_real_t                      inc,
+                           int                            n_vars,
+                           const cs_real_t               *coefap[],
+                           const cs_real_t               *coefbp[],
+                           const cs_real_t      *restrict pvar,
+                           cs_real_3_t          *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+  const cs_lnum_t *restrict cell_b_faces_idx
+    = (const cs_lnum_t *restrict)madj->cell_b_faces_idx;
+  const cs_lnum_t *restrict cell_b_faces
+    = (const cs_lnum_t *restrict)madj->cell_b_faces;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  const cs_lnum_t n_v = n_vars;
+
+  cs_real_33_t   *restrict cocgb = NULL;
+  cs_real_33_t   *restrict cocg = NULL;
+
+  _get_cell_cocg_lsq(m,
+                     halo_type,
+                     fvq,
+                     NULL,
+                     &cocg,
+                     &cocgb);
+
+  const cs_gradient_lsq_op_t *lsq_op = _get_lsq_op(m, halo_type, fvq, NULL);
+
+  /* Compute Right-Hand Side (in gradient array) */
+  /*---------------------------------------------*/
+
+# pragma omp parallel for if(n_cells_ext*n_v > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells_ext*n_v; i++) {
+    grad[i][0] = 0.0;
+    grad[i][1] = 0.0;
+    grad[i][2] = 0.0;
+  }
+
+  if (lsq_op != NULL) {
+
+    /* Contribution from interior faces and extended neighborhood,
+       using precomputed operator */
+
+    _lsq_op_strided_rhs(lsq_op,
+                        n_cells,
+                        n_v,
+                        pvar,
+                        (cs_real_t *)grad);
+
+  }
+  else {
+
+    /* Contribution from interior faces */
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
+
+          cs_lnum_t ii = i_face_cells[f_id][0];
+          cs_lnum_t jj = i_face_cells[f_id][1];
+
+          cs_real_t dc[3];
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+          cs_real_t ddc = dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2];
+
+          for (cs_lnum_t v_id = 0; v_id < n_v; v_id++) {
+
+            /* (P_j - P_i) / ||d||^2 */
+            cs_real_t pfac = (pvar[jj*n_v + v_id] - pvar[ii*n_v + v_id]) / ddc;
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++) {
+              grad[ii*n_v + v_id][ll] += dc[ll] * pfac;
+              grad[jj*n_v + v_id][ll] += dc[ll] * pfac;
+            }
+
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+    /* Contribution from extended neighborhood */
+
+    if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
+
+#     pragma omp parallel for
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+        for (cs_lnum_t cidx = cell_cells_idx[ii];
+             cidx < cell_cells_idx[ii+1];
+             cidx++) {
+
+          cs_lnum_t jj = cell_cells_lst[cidx];
+
+          cs_real_t dc[3];
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+          cs_real_t ddc = dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2];
+
+          for (cs_lnum_t v_id = 0; v_id < n_v; v_id++) {
+
+            cs_real_t pfac = (pvar[jj*n_v + v_id] - pvar[ii*n_v + v_id]) / ddc;
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              grad[ii*n_v + v_id][ll] += dc[ll] * pfac;
+
+          }
+
+        }
+      }
+
+    } /* End for extended neighborhood */
+
+  }
+
+  /* Contribution from boundary faces, and computation of gradient
+     (with updated cocg if required) for boundary cells */
+
+# pragma omp parallel for if(m->n_b_cells > CS_THR_MIN)
+  for (cs_lnum_t b_c_id = 0; b_c_id < m->n_b_cells; b_c_id++) {
+
+    cs_lnum_t c_id = m->b_cells[b_c_id];
+
+    const cs_lnum_t s_id = cell_b_faces_idx[c_id];
+    const cs_lnum_t e_id = cell_b_faces_idx[c_id+1];
+
+    for (cs_lnum_t v_id = 0; v_id < n_v; v_id++) {
+
+      const cs_lnum_t i = c_id*n_v + v_id;
+
+      cs_real_t _cocg[3][3];
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++) {
+        for (cs_lnum_t mm = 0; mm < 3; mm++)
+          _cocg[ll][mm] = (recompute_cocg) ?
+            cocgb[b_c_id][ll][mm] : cocg[c_id][ll][mm];
+      }
+
+      for (cs_lnum_t j = s_id; j < e_id; j++) {
+
+        cs_lnum_t f_id = cell_b_faces[j];
+
+        cs_real_t unddij = 1. / b_dist[f_id];
+        cs_real_t udbfs = 1. / b_face_surf[f_id];
+        cs_real_t umcbdd = (1. - coefbp[v_id][f_id]) * unddij;
+
+        cs_real_t dsij[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dsij[ll] =   udbfs * b_face_normal[f_id][ll]
+                     + umcbdd*diipb[f_id][ll];
+
+        cs_real_t pfac =   (coefap[v_id][f_id]*inc + (coefbp[v_id][f_id] -1.)
+                         * pvar[i]) * unddij;
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          grad[i][ll] += dsij[ll] * pfac;
+
+        if (recompute_cocg) {
+          /* Same operations as in _lsq_scalar_gradient */
+          cs_real_t umcbdd_c = (1. - coefbp[v_id][f_id]) / b_dist[f_id];
+          cs_real_t dddij[3];
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dddij[ll] =   udbfs * b_face_normal[f_id][ll]
+                        + umcbdd_c * diipb[f_id][ll];
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            for (cs_lnum_t mm = 0; mm < 3; mm++)
+              _cocg[ll][mm] += dddij[ll]*dddij[mm];
+          }
+        }
+
+      }
+
+      if (recompute_cocg) {
+        cs_math_33_inv_cramer_sym_in_place(_cocg);
+        /* Saved cocg matches the last scalar, as with successive calls
+           to _lsq_scalar_gradient */
+        if (v_id == n_v - 1) {
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            for (cs_lnum_t mm = 0; mm < 3; mm++)
+              cocg[c_id][ll][mm] = _cocg[ll][mm];
+          }
+        }
+      }
+
+      cs_real_t r[3] = {grad[i][0], grad[i][1], grad[i][2]};
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        grad[i][ll] =   _cocg[ll][0] *r[0]
+                      + _cocg[ll][1] *r[1]
+                      + _cocg[ll][2] *r[2];
+
+    }
+
+  }
+
+  /* Compute gradient for other cells */
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    if (cell_b_faces_idx[c_id+1] > cell_b_faces_idx[c_id])
+      continue;
+
+    for (cs_lnum_t v_id = 0; v_id < n_v; v_id++) {
+      const cs_lnum_t i = c_id*n_v + v_id;
+      cs_real_t r[3] = {grad[i][0], grad[i][1], grad[i][2]};
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        grad[i][ll] =   cocg[c_id][ll][0] *r[0]
+                      + cocg[c_id][ll][1] *r[1]
+                      + cocg[c_id][ll][2] *r[2];
+    }
+
+  }
+
+  /* Synchronize halos */
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD,
+                             (cs_real_t *)grad, 3*n_vars);
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1) in the anisotropic case.
@@ -3188,8 +3939,6 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
   const cs_real_3_t *restrict b_face_cog
     = (const cs_real_3_t *restrict)fvq->b_face_cog;
 
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
@@ -3249,6 +3998,9 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
           cs_lnum_t c_id1 = i_face_cells[f_id][0];
           cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
+          cs_real_t dofij[3];
+          cs_mesh_quantities_i_face_dofij(fvq, f_id, c_id1, c_id2, dofij);
+
           cs_real_t ktpond = (c_weight == NULL) ?
              weight[f_id] :              /* no cell weighting */
              weight[f_id] * c_weight[c_id1] /* cell weighting active */
@@ -3301,9 +4053,9 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
                  * ( (cell_cen[c_id2][0]-i_face_cog[f_id][0])*fexd[0]
                    + (cell_cen[c_id2][1]-i_face_cog[f_id][1])*fexd[1]
                    + (cell_cen[c_id2][2]-i_face_cog[f_id][2])*fexd[2])
-              + (  dofij[f_id][0] * (r_grad[c_id1][0]+r_grad[c_id2][0])
-                 + dofij[f_id][1] * (r_grad[c_id1][1]+r_grad[c_id2][1])
-                 + dofij[f_id][2] * (r_grad[c_id1][2]+r_grad[c_id2][2])) * 0.5;
+              + (  dofij[0] * (r_grad[c_id1][0]+r_grad[c_id2][0])
+                 + dofij[1] * (r_grad[c_id1][1]+r_grad[c_id2][1])
+                 + dofij[2] * (r_grad[c_id1][2]+r_grad[c_id2][2])) * 0.5;
 
           for (cs_lnum_t j = 0; j < 3; j++) {
             grad[c_id1][j] += (pfaci + rfac) * i_f_face_normal[f_id][j];
@@ -3386,6 +4138,9 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
           cs_lnum_t c_id1 = i_face_cells[f_id][0];
           cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
+          cs_real_t dofij[3];
+          cs_mesh_quantities_i_face_dofij(fvq, f_id, c_id1, c_id2, dofij);
+
           cs_real_t ktpond = (c_weight == NULL) ?
              weight[f_id] :              /* no cell weighting */
              weight[f_id] * c_weight[c_id1] /* cell weighting active */
@@ -3405,9 +4160,9 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
           cs_real_t pfacj =     -ktpond  * (c_var[c_id2] - c_var[c_id1]);
           /* Reconstruction part */
           cs_real_t rfac = 0.5 *
-                    (dofij[f_id][0]*(r_grad[c_id1][0]+r_grad[c_id2][0])
-                    +dofij[f_id][1]*(r_grad[c_id1][1]+r_grad[c_id2][1])
-                    +dofij[f_id][2]*(r_grad[c_id1][2]+r_grad[c_id2][2]));
+                    (dofij[0]*(r_grad[c_id1][0]+r_grad[c_id2][0])
+                    +dofij[1]*(r_grad[c_id1][1]+r_grad[c_id2][1])
+                    +dofij[2]*(r_grad[c_id1][2]+r_grad[c_id2][2]));
 
           for (cs_lnum_t j = 0; j < 3; j++) {
             grad[c_id1][j] += (pfaci + rfac) * i_f_face_normal[f_id][j];
@@ -4988,8 +5743,6 @@ _reconstruct_vector_gradient(const cs_mesh_t              *m,
     = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
   const cs_real_33_t *restrict corr_grad_lin
     = (const cs_real_33_t *restrict)fvq->corr_grad_lin;
 
@@ -5023,6 +5776,9 @@ _reconstruct_vector_gradient(const cs_mesh_t              *m,
         cs_lnum_t c_id1 = i_face_cells[f_id][0];
         cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
+        cs_real_t dofij[3];
+        cs_mesh_quantities_i_face_dofij(fvq, f_id, c_id1, c_id2, dofij);
+
         cs_real_t pond = weight[f_id];
 
         cs_real_t ktpond = (c_weight == NULL) ?
@@ -5046,12 +5802,12 @@ _reconstruct_vector_gradient(const cs_mesh_t              *m,
           cs_real_t pfacj = - ktpond * (pvar[c_id2][i] - pvar[c_id1][i]);
 
           /* Reconstruction part */
-          cs_real_t rfac = 0.5 * (  dofij[f_id][0]*(  r_grad[c_id1][i][0]
-                                                    + r_grad[c_id2][i][0])
-                                  + dofij[f_id][1]*(  r_grad[c_id1][i][1]
-                                                    + r_grad[c_id2][i][1])
-                                  + dofij[f_id][2]*(  r_grad[c_id1][i][2]
-                                                    + r_grad[c_id2][i][2]));
+          cs_real_t rfac = 0.5 * (  dofij[0]*(  r_grad[c_id1][i][0]
+                                              + r_grad[c_id2][i][0])
+                                  + dofij[1]*(  r_grad[c_id1][i][1]
+                                              + r_grad[c_id2][i][1])
+                                  + dofij[2]*(  r_grad[c_id1][i][2]
+                                              + r_grad[c_id2][i][2]));
 
           for (cs_lnum_t j = 0; j < 3; j++) {
             grad[c_id1][i][j] += (pfaci + rfac) * i_f_face_normal[f_id][j];
@@ -5231,8 +5987,6 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
     = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
 
   int gq_id = (cpl == NULL) ? 0 : cpl->id+1;
   cs_gradient_quantities_t  *gq = _gradient_quantities_get(gq_id);
@@ -5284,6 +6038,10 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 
             cs_lnum_t c_id1 = i_face_cells[f_id][0];
             cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+            cs_real_t dofij[3];
+            cs_mesh_quantities_i_face_dofij(fvq, f_id, c_id1, c_id2, dofij);
+
             cs_real_t pond = weight[f_id];
 
             cs_real_t ktpond = (c_weight == NULL) ?
@@ -5306,11 +6064,11 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
               /* Reconstruction part */
               cs_real_t
               pfaci = 0.5 * ( ( grad[c_id1][i][0] + grad[c_id2][i][0])
-                              * dofij[f_id][0]
+                              * dofij[0]
                             + ( grad[c_id1][i][1] + grad[c_id2][i][1])
-                              * dofij[f_id][1]
+                              * dofij[1]
                             + ( grad[c_id1][i][2] + grad[c_id2][i][2])
-                              * dofij[f_id][2]
+                              * dofij[2]
                             );
               cs_real_t pfacj = pfaci;
 
@@ -5517,8 +6275,6 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
     = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
 
   cs_gradient_quantities_t  *gq = _gradient_quantities_get(0);
 
@@ -5566,6 +6322,10 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
 
             cs_lnum_t c_id1 = i_face_cells[f_id][0];
             cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+            cs_real_t dofij[3];
+            cs_mesh_quantities_i_face_dofij(fvq, f_id, c_id1, c_id2, dofij);
+
             cs_real_t pond = weight[f_id];
 
             /*
@@ -5582,11 +6342,11 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
               /* Reconstruction part */
               cs_real_t
               pfaci = 0.5 * ( ( grad[c_id1][i][0] + grad[c_id2][i][0])
-                              * dofij[f_id][0]
+                              * dofij[0]
                             + ( grad[c_id1][i][1] + grad[c_id2][i][1])
-                              * dofij[f_id][1]
+                              * dofij[1]
                             + ( grad[c_id1][i][2] + grad[c_id2][i][2])
-                              * dofij[f_id][2]
+                              * dofij[2]
                             );
               cs_real_t pfacj = pfaci;
 
@@ -6218,91 +6978,111 @@ _lsq_vector_gradient(const cs_mesh_t               *m,
         rhs[c_id][i][j] = 0.0;
   }
 
-  /* Contribution from interior faces */
+  const cs_gradient_lsq_op_t *lsq_op = NULL;
+  if (c_weight == NULL)
+    lsq_op = _get_lsq_op(m, halo_type, fvq, cpl);
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  if (lsq_op != NULL) {
 
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+    /* Contribution from interior faces and extended neighborhood,
+       using precomputed operator */
 
-      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           f_id++) {
+    _lsq_op_strided_rhs(lsq_op,
+                        n_cells,
+                        3,
+                        (const cs_real_t *)pvar,
+                        (cs_real_t *)rhs);
 
-        cs_lnum_t c_id1 = i_face_cells[f_id][0];
-        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+  }
+  else {
+
+    /* Contribution from interior faces */
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
+
+          cs_lnum_t c_id1 = i_face_cells[f_id][0];
+          cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-        cs_real_t  dc[3], fctb[3];
+          cs_real_t  dc[3], fctb[3];
 
-        for (cs_lnum_t i = 0; i < 3; i++)
-          dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
 
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        if (c_weight != NULL) {
-          cs_real_t pond = weight[f_id];
-          cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
-                                  + (1. - pond)*c_weight[c_id2]);
+          if (c_weight != NULL) {
+            cs_real_t pond = weight[f_id];
+            cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
+                                    + (1. - pond)*c_weight[c_id2]);
 
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+            for (cs_lnum_t i = 0; i < 3; i++) {
+              cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[c_id1][i][j] += c_weight[c_id2] * denom * fctb[j];
-              rhs[c_id2][i][j] += c_weight[c_id1] * denom * fctb[j];
+              for (cs_lnum_t j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[c_id1][i][j] += c_weight[c_id2] * denom * fctb[j];
+                rhs[c_id2][i][j] += c_weight[c_id1] * denom * fctb[j];
+              }
             }
           }
-        }
-        else {
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+          else {
+            for (cs_lnum_t i = 0; i < 3; i++) {
+              cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[c_id1][i][j] += fctb[j];
-              rhs[c_id2][i][j] += fctb[j];
+              for (cs_lnum_t j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[c_id1][i][j] += fctb[j];
+                rhs[c_id2][i][j] += fctb[j];
+              }
             }
           }
-        }
 
-      } /* loop on faces */
+        } /* loop on faces */
 
-    } /* loop on threads */
+      } /* loop on threads */
 
-  } /* loop on thread groups */
+    } /* loop on thread groups */
 
-  /* Contribution from extended neighborhood */
+    /* Contribution from extended neighborhood */
 
-  if (halo_type == CS_HALO_EXTENDED) {
+    if (halo_type == CS_HALO_EXTENDED) {
 
-#   pragma omp parallel for
-    for (cs_lnum_t c_id1 = 0; c_id1 < n_cells; c_id1++) {
-      for (cs_lnum_t cidx = cell_cells_idx[c_id1];
-           cidx < cell_cells_idx[c_id1+1];
-           cidx++) {
+#     pragma omp parallel for
+      for (cs_lnum_t c_id1 = 0; c_id1 < n_cells; c_id1++) {
+        for (cs_lnum_t cidx = cell_cells_idx[c_id1];
+             cidx < cell_cells_idx[c_id1+1];
+             cidx++) {
 
-        cs_lnum_t c_id2 = cell_cells_lst[cidx];
+          cs_lnum_t c_id2 = cell_cells_lst[cidx];
 
-        cs_real_t dc[3];
+          cs_real_t dc[3];
 
-        for (cs_lnum_t i = 0; i < 3; i++)
-          dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
 
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        for (cs_lnum_t i = 0; i < 3; i++) {
+          for (cs_lnum_t i = 0; i < 3; i++) {
 
-          cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            rhs[c_id1][i][j] += dc[j] * pfac;
+            for (cs_lnum_t j = 0; j < 3; j++) {
+              rhs[c_id1][i][j] += dc[j] * pfac;
+            }
           }
         }
       }
-    }
 
-  } /* End for extended neighborhood */
+    } /* End for extended neighborhood */
+
+  }
 
   /* Contribution from coupled faces */
 
@@ -6864,89 +7644,109 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
         rhs[c_id][i][j] = 0.0;
   }
 
-  /* Contribution from interior faces */
+  const cs_gradient_lsq_op_t *lsq_op = NULL;
+  if (c_weight == NULL)
+    lsq_op = _get_lsq_op(m, halo_type, fvq, NULL);
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  if (lsq_op != NULL) {
 
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+    /* Contribution from interior faces and extended neighborhood,
+       using precomputed operator */
 
-      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           f_id++) {
+    _lsq_op_strided_rhs(lsq_op,
+                        n_cells,
+                        6,
+                        (const cs_real_t *)pvar,
+                        (cs_real_t *)rhs);
 
-        cs_lnum_t c_id1 = i_face_cells[f_id][0];
-        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+  }
+  else {
 
-        cs_real_3_t dc, fctb;
-        for (cs_lnum_t i = 0; i < 3; i++)
-          dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+    /* Contribution from interior faces */
 
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-        if (c_weight != NULL) {
-          cs_real_t pond = weight[f_id];
-          cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
-                                  + (1. - pond)*c_weight[c_id2]);
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-          for (cs_lnum_t i = 0; i < 6; i++) {
-            cs_real_t pfac =  (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
 
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[c_id1][i][j] += c_weight[c_id2] * denom * fctb[j];
-              rhs[c_id2][i][j] += c_weight[c_id1] * denom * fctb[j];
+          cs_lnum_t c_id1 = i_face_cells[f_id][0];
+          cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+          cs_real_3_t dc, fctb;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+          if (c_weight != NULL) {
+            cs_real_t pond = weight[f_id];
+            cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
+                                    + (1. - pond)*c_weight[c_id2]);
+
+            for (cs_lnum_t i = 0; i < 6; i++) {
+              cs_real_t pfac =  (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+
+              for (cs_lnum_t j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[c_id1][i][j] += c_weight[c_id2] * denom * fctb[j];
+                rhs[c_id2][i][j] += c_weight[c_id1] * denom * fctb[j];
+              }
             }
           }
-        }
-        else {
-          for (cs_lnum_t i = 0; i < 6; i++) {
-            cs_real_t pfac =  (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+          else {
+            for (cs_lnum_t i = 0; i < 6; i++) {
+              cs_real_t pfac =  (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[c_id1][i][j] += fctb[j];
-              rhs[c_id2][i][j] += fctb[j];
+              for (cs_lnum_t j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[c_id1][i][j] += fctb[j];
+                rhs[c_id2][i][j] += fctb[j];
+              }
             }
           }
-        }
 
-      } /* loop on faces */
+        } /* loop on faces */
 
-    } /* loop on threads */
+      } /* loop on threads */
 
-  } /* loop on thread groups */
+    } /* loop on thread groups */
 
-  /* Contribution from extended neighborhood */
+    /* Contribution from extended neighborhood */
 
-  if (halo_type == CS_HALO_EXTENDED) {
+    if (halo_type == CS_HALO_EXTENDED) {
 
-#   pragma omp parallel for
-    for (cs_lnum_t c_id1 = 0; c_id1 < n_cells; c_id1++) {
-      for (cs_lnum_t cidx = cell_cells_idx[c_id1];
-           cidx < cell_cells_idx[c_id1+1];
-           cidx++) {
+#     pragma omp parallel for
+      for (cs_lnum_t c_id1 = 0; c_id1 < n_cells; c_id1++) {
+        for (cs_lnum_t cidx = cell_cells_idx[c_id1];
+             cidx < cell_cells_idx[c_id1+1];
+             cidx++) {
 
-        cs_lnum_t c_id2 = cell_cells_lst[cidx];
+          cs_lnum_t c_id2 = cell_cells_lst[cidx];
 
-        cs_real_3_t dc;
-        for (cs_lnum_t i = 0; i < 3; i++)
-          dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+          cs_real_3_t dc;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
 
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        for (cs_lnum_t i = 0; i < 6; i++) {
+          for (cs_lnum_t i = 0; i < 6; i++) {
 
-          cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            rhs[c_id1][i][j] += dc[j] * pfac;
+            for (cs_lnum_t j = 0; j < 3; j++) {
+              rhs[c_id1][i][j] += dc[j] * pfac;
+            }
           }
         }
       }
-    }
 
-  } /* End for extended neighborhood */
+    } /* End for extended neighborhood */
+
+  }
 
   /* Contribution from boundary faces */
 
@@ -8887,9 +9687,50 @@ cs_gradient_free_quantities(void)
     BFT_FREE(gq->cocgb_s_lsq_ext);
     BFT_FREE(gq->cocg_lsq_ext);
 
+    _lsq_op_destroy(&(gq->lsq_op));
+    _lsq_op_destroy(&(gq->lsq_op_ext));
+
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query whether least-squares gradients use a precomputed
+ *         cell-to-neighbor operator.
+ *
+ * \return  true if the precomputed operator is used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_get_lsq_operator_cache(void)
+{
+  return _lsq_op_cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set whether least-squares gradients should use a precomputed
+ *         cell-to-neighbor operator.
+ *
+ * When active, the geometric weights of the interior and extended
+ * neighborhood contributions to least-squares gradient right-hand sides
+ * are assembled once per mesh in a cell-based (CSR-like) structure, and
+ * applied using a gather loop instead of the face-based scatter loops.
+ * This trades additional memory for faster gradient computations on
+ * static meshes. It is not used with cell weighting, hydrostatic pressure
+ * handling, or internal coupling, for which the standard path is kept.
+ *
+ * \param[in]  use_cache  true to use the precomputed operator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_lsq_operator_cache(bool  use_cache)
+{
+  _lsq_op_cache = use_cache;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -9015,6 +9856,252 @@ cs_gradient_scalar(const char                    *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields sharing the same
+ *         gradient options.
+ *
+ * For least-squares gradients, variables are interleaved so that face
+ * adjacencies are traversed only once for all fields, and halos are
+ * synchronized using a single strided exchange. Other gradient types
+ * (or meshes with rotation periodicity) fall back to successive calls
+ * to \ref cs_gradient_scalar.
+ *
+ * Hydrostatic pressure, cell weighting and internal coupling are not
+ * handled here; \ref cs_gradient_scalar should be used for those cases.
+ *
+ * \param[in]       n_fields       number of fields
+ * \param[in]       var_name       variable names
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       bc_coeff_a     boundary condition term a for each field,
+ *                                 or NULL
+ * \param[in]       bc_coeff_b     boundary condition term b for each field,
+ *                                 or NULL
+ * \param[in, out]  var            gradient's base variable for each field
+ * \param[out]      grad           gradient for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(int                    n_fields,
+                         const char            *var_name[],
+                         cs_gradient_type_t     gradient_type,
+                         cs_halo_type_t         halo_type,
+                         int                    inc,
+                         bool                   recompute_cocg,
+                         int                    n_r_sweeps,
+                         int                    verbosity,
+                         cs_gradient_limit_t    clip_mode,
+                         double                 epsilon,
+                         double                 clip_coeff,
+                         const cs_real_t       *bc_coeff_a[],
+                         const cs_real_t       *bc_coeff_b[],
+                         cs_real_t             *var[],
+                         cs_real_3_t           *grad[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+
+  if (n_fields < 1)
+    return;
+
+  /* Fallback to separate computations when batching is not handled */
+
+  if (   n_fields == 1
+      || gradient_type != CS_GRADIENT_LSQ
+      || mesh->have_rotation_perio) {
+
+    for (int v_id = 0; v_id < n_fields; v_id++)
+      cs_gradient_scalar(var_name[v_id],
+                         gradient_type,
+                         halo_type,
+                         inc,
+                         recompute_cocg,
+                         n_r_sweeps,
+                         0,             /* tr_dim */
+                         0,             /* hyd_p_flag */
+                         1,             /* w_stride */
+                         verbosity,
+                         clip_mode,
+                         epsilon,
+                         clip_coeff,
+                         NULL,          /* f_ext */
+                         (bc_coeff_a != NULL) ? bc_coeff_a[v_id] : NULL,
+                         (bc_coeff_b != NULL) ? bc_coeff_b[v_id] : NULL,
+                         var[v_id],
+                         NULL,          /* c_weight */
+                         NULL,          /* cpl */
+                         grad[v_id]);
+
+    return;
+  }
+
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_v = n_fields;
+
+  cs_timer_t t0, t1;
+
+  t0 = cs_timer_time();
+
+  cs_gradient_info_t **gradient_info;
+  BFT_MALLOC(gradient_info, n_fields, cs_gradient_info_t *);
+
+  for (int v_id = 0; v_id < n_fields; v_id++)
+    gradient_info[v_id] = _find_or_add_system(var_name[v_id], gradient_type);
+
+  /* Use Neumann BC's as default if not provided */
+
+  const cs_real_t **_bc_coeff_a, **_bc_coeff_b;
+  cs_real_t *bc_coeff_0 = NULL, *bc_coeff_1 = NULL;
+
+  BFT_MALLOC(_bc_coeff_a, n_fields, const cs_real_t *);
+  BFT_MALLOC(_bc_coeff_b, n_fields, const cs_real_t *);
+
+  for (int v_id = 0; v_id < n_fields; v_id++) {
+    _bc_coeff_a[v_id] = (bc_coeff_a != NULL) ? bc_coeff_a[v_id] : NULL;
+    _bc_coeff_b[v_id] = (bc_coeff_b != NULL) ? bc_coeff_b[v_id] : NULL;
+    if (_bc_coeff_a[v_id] == NULL) {
+      if (bc_coeff_0 == NULL) {
+        BFT_MALLOC(bc_coeff_0, n_b_faces, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++)
+          bc_coeff_0[i] = 0;
+      }
+      _bc_coeff_a[v_id] = bc_coeff_0;
+    }
+    if (_bc_coeff_b[v_id] == NULL) {
+      if (bc_coeff_1 == NULL) {
+        BFT_MALLOC(bc_coeff_1, n_b_faces, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++)
+          bc_coeff_1[i] = 1;
+      }
+      _bc_coeff_b[v_id] = bc_coeff_1;
+    }
+  }
+
+  /* Interleave and synchronize variables; ghost values are also copied
+     so that those not updated for this halo type remain unchanged */
+
+  cs_real_t *pvar;
+  cs_real_3_t *_grad;
+  BFT_MALLOC(pvar, n_cells_ext*n_v, cs_real_t);
+  BFT_MALLOC(_grad, n_cells_ext*n_v, cs_real_3_t);
+
+# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    for (cs_lnum_t v_id = 0; v_id < n_v; v_id++)
+      pvar[c_id*n_v + v_id] = var[v_id][c_id];
+  }
+
+  if (mesh->halo != NULL) {
+
+    cs_halo_sync_var_strided(mesh->halo, halo_type, pvar, n_v);
+
+    /* Update halo values of base variables, as cs_gradient_scalar would */
+
+    for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++) {
+      for (cs_lnum_t v_id = 0; v_id < n_v; v_id++)
+        var[v_id][c_id] = pvar[c_id*n_v + v_id];
+    }
+
+  }
+
+  /* Compute gradients */
+
+  _lsq_scalar_gradient_multi(mesh,
+                             cs_glob_mesh_adjacencies,
+                             fvq,
+                             halo_type,
+                             recompute_cocg,
+                             inc,
+                             n_fields,
+                             _bc_coeff_a,
+                             _bc_coeff_b,
+                             pvar,
+                             _grad);
+
+  /* De-interleave (local cells and standard halo) */
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t v_id = 0; v_id < n_v; v_id++) {
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        grad[v_id][c_id][ll] = _grad[c_id*n_v + v_id][ll];
+    }
+  }
+
+  if (mesh->halo != NULL) {
+    const cs_halo_t *halo = mesh->halo;
+    for (int r_id = 0; r_id < halo->n_c_domains; r_id++) {
+      for (cs_lnum_t c_id = n_cells + halo->index[2*r_id];
+           c_id < n_cells + halo->index[2*r_id + 1];
+           c_id++) {
+        for (cs_lnum_t v_id = 0; v_id < n_v; v_id++) {
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            grad[v_id][c_id][ll] = _grad[c_id*n_v + v_id][ll];
+        }
+      }
+    }
+  }
+
+  BFT_FREE(_grad);
+  BFT_FREE(pvar);
+
+  /* Field-specific post-processing */
+
+  for (int v_id = 0; v_id < n_fields; v_id++) {
+
+    _scalar_gradient_clipping(halo_type,
+                              clip_mode,
+                              verbosity,
+                              0,
+                              clip_coeff,
+                              var_name[v_id],
+                              var[v_id], grad[v_id]);
+
+    if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+      cs_bad_cells_regularisation_vector(grad[v_id], 0);
+
+  }
+
+  BFT_FREE(bc_coeff_0);
+  BFT_FREE(bc_coeff_1);
+  BFT_FREE(_bc_coeff_a);
+  BFT_FREE(_bc_coeff_b);
+
+  t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
+  /* Share elapsed time evenly between fields for logging */
+
+  cs_timer_counter_t  dt;
+  CS_TIMER_COUNTER_INIT(dt);
+  cs_timer_counter_add_diff(&dt, &t0, &t1);
+
+  for (int v_id = 0; v_id < n_fields; v_id++) {
+    gradient_info[v_id]->n_calls += 1;
+    gradient_info[v_id]->t_tot.wall_nsec += dt.wall_nsec / n_fields;
+    gradient_info[v_id]->t_tot.cpu_nsec += dt.cpu_nsec / n_fields;
+  }
+
+  BFT_FREE(gradient_info);
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -154,6 +154,30 @@ cs_gradient_finalize(void);
 void
 cs_gradient_free_quantities(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query whether least-squares gradients use a precomputed
+ *         cell-to-neighbor operator.
+ *
+ * \return  true if the precomputed operator is used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_get_lsq_operator_cache(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set whether least-squares gradients should use a precomputed
+ *         cell-to-neighbor operator.
+ *
+ * \param[in]  use_cache  true to use the precomputed operator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_lsq_operator_cache(bool  use_cache);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -207,6 +231,55 @@ cs_gradient_scalar(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t                      grad[restrict][3]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields sharing the same
+ *         gradient options.
+ *
+ * For least-squares gradients, variables are interleaved so that face
+ * adjacencies are traversed only once for all fields, and halos are
+ * synchronized using a single strided exchange. Other gradient types
+ * (or meshes with rotation periodicity) fall back to successive calls
+ * to \ref cs_gradient_scalar.
+ *
+ * \param[in]       n_fields       number of fields
+ * \param[in]       var_name       variable names
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       bc_coeff_a     boundary condition term a for each field,
+ *                                 or NULL
+ * \param[in]       bc_coeff_b     boundary condition term b for each field,
+ *                                 or NULL
+ * \param[in, out]  var            gradient's base variable for each field
+ * \param[out]      grad           gradient for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(int                    n_fields,
+                         const char            *var_name[],
+                         cs_gradient_type_t     gradient_type,
+                         cs_halo_type_t         halo_type,
+                         int                    inc,
+                         bool                   recompute_cocg,
+                         int                    n_r_sweeps,
+                         int                    verbosity,
+                         cs_gradient_limit_t    clip_mode,
+                         double                 epsilon,
+                         double                 clip_coeff,
+                         const cs_real_t       *bc_coeff_a[],
+                         const cs_real_t       *bc_coeff_b[],
+                         cs_real_t             *var[],
+                         cs_real_3_t           *grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
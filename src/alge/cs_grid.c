@@ -72,6 +72,7 @@
 #include "cs_prototypes.h"
 #include "cs_sles.h"
 #include "cs_sort.h"
+#include "cs_timer.h"
 
 #include "fvm_defs.h"
 
@@ -2366,6 +2367,174 @@ _merge_grids(cs_grid_t  *g,
                (long)g->n_rows, (long)g->n_elts_r[0]);
 }
 
+/*----------------------------------------------------------------------------
+ * Determine merge stride for a coarse grid based on the measured ratio
+ * of halo exchange to local matrix.vector product times.
+ *
+ * Merging by a stride s multiplies the local work on remaining ranks by
+ * about s, while halo exchanges on coarse grids are mostly latency-bound,
+ * so the ratio is expected to be divided by about s. The smallest stride
+ * bringing the ratio under the target is selected.
+ *
+ * This function is collective on the main communicator.
+ *
+ * parameters:
+ *   g            <-- pointer to grid structure (before merging)
+ *   max_stride   <-- maximum merge stride
+ *   comm_ratio   <-- target communication/computation time ratio
+ *   verbosity    <-- verbosity level
+ *
+ * returns:
+ *   merge stride (1 if no merging is needed)
+ *----------------------------------------------------------------------------*/
+
+static int
+_merge_stride_adaptive(const cs_grid_t  *g,
+                       int               max_stride,
+                       double            comm_ratio,
+                       int               verbosity)
+{
+  const int n_runs = 8;
+  const cs_lnum_t *db_size = g->db_size;
+  const cs_lnum_t n_rows = g->n_rows;
+  const cs_lnum_t n = g->n_cols_ext*db_size[1];
+
+  double t_measure[2] = {0., 0.};
+
+  cs_real_t *x, *y;
+  BFT_MALLOC(x, n, cs_real_t);
+  BFT_MALLOC(y, n, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    x[ii] = 1.;
+    y[ii] = 0.;
+  }
+
+  /* Halo exchange time */
+
+  if (g->halo != NULL) {
+    double t0 = cs_timer_wtime();
+    for (int run_id = 0; run_id < n_runs; run_id++)
+      cs_halo_sync_var_strided(g->halo, CS_HALO_STANDARD, x, db_size[1]);
+    t_measure[0] = (cs_timer_wtime() - t0) / n_runs;
+  }
+
+  /* Local matrix.vector product time */
+
+  double t0 = cs_timer_wtime();
+
+  for (int run_id = 0; run_id < n_runs; run_id++) {
+
+    if (g->matrix != NULL)
+      cs_matrix_vector_multiply_nosync(g->matrix, x, y);
+
+    else {
+      const cs_lnum_t xa_stride = (g->symmetric) ? 1 : 2;
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+          y[ii*db_size[1] + kk] =   g->da[ii*db_size[3] + kk*db_size[2] + kk]
+                                  * x[ii*db_size[1] + kk];
+      }
+      for (cs_lnum_t face_id = 0; face_id < g->n_faces; face_id++) {
+        cs_lnum_t ii = g->face_cell[face_id][0];
+        cs_lnum_t jj = g->face_cell[face_id][1];
+        cs_real_t xa_ij = g->xa[face_id*xa_stride];
+        cs_real_t xa_ji = g->xa[face_id*xa_stride + xa_stride - 1];
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+          y[ii*db_size[1] + kk] += xa_ij * x[jj*db_size[1] + kk];
+          y[jj*db_size[1] + kk] += xa_ji * x[ii*db_size[1] + kk];
+        }
+      }
+    }
+
+  }
+
+  t_measure[1] = (cs_timer_wtime() - t0) / n_runs;
+
+  BFT_FREE(y);
+  BFT_FREE(x);
+
+  /* Use maximum values over ranks, as the slowest rank sets the pace */
+
+  if (cs_glob_n_ranks > 1) {
+    double _t_measure[2] = {t_measure[0], t_measure[1]};
+    MPI_Allreduce(_t_measure, t_measure, 2, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+  }
+
+  int stride = max_stride;
+
+  if (t_measure[1] > 0) {
+    double r = t_measure[0] / t_measure[1];
+    double s = ceil(r / comm_ratio);
+    if (s < (double)max_stride)
+      stride = (int)s;
+  }
+
+  if (stride > g->n_ranks)
+    stride = g->n_ranks;
+  if (stride < 1)
+    stride = 1;
+
+  if (verbosity > 2)
+    bft_printf("\n"
+               "    level %2d grid merge measures:\n"
+               "      halo exchange: %12.5g s; local SpMV: %12.5g s\n"
+               "      selected merge stride: %d\n",
+               g->level, t_measure[0], t_measure[1], stride);
+
+  return stride;
+}
+
+/*----------------------------------------------------------------------------
+ * Determine merge stride to apply to a coarse grid, if any.
+ *
+ * parameters:
+ *   g                          <-- pointer to grid structure (before merging)
+ *   merge_stride               <-- associated merge stride (or maximum
+ *                                  stride if adaptive)
+ *   merge_rows_mean_threshold  <-- mean number of rows under which
+ *                                  merging should be applied
+ *   merge_rows_glob_threshold  <-- global number of rows under which
+ *                                  merging should be applied
+ *   merge_comm_ratio           <-- if > 0, target ratio of communication
+ *                                  to computation time for adaptive merging
+ *   verbosity                  <-- verbosity level
+ *
+ * returns:
+ *   merge stride (1 if no merging is needed)
+ *----------------------------------------------------------------------------*/
+
+static int
+_merge_stride(const cs_grid_t  *g,
+              int               merge_stride,
+              int               merge_rows_mean_threshold,
+              cs_gnum_t         merge_rows_glob_threshold,
+              double            merge_comm_ratio,
+              int               verbosity)
+{
+  int stride = 1;
+
+  if (merge_stride < 2 || g->n_ranks < 2)
+    return stride;
+
+  if (merge_comm_ratio > 0)
+    stride = _merge_stride_adaptive(g,
+                                    merge_stride,
+                                    merge_comm_ratio,
+                                    verbosity);
+
+  else {
+    cs_gnum_t  _n_ranks = g->n_ranks;
+    cs_gnum_t  _n_mean_g_rows = g->n_g_rows / _n_ranks;
+    if (   _n_mean_g_rows < (cs_gnum_t)merge_rows_mean_threshold
+        || g->n_g_rows < merge_rows_glob_threshold)
+      stride = merge_stride;
+  }
+
+  return stride;
+}
+
 /*----------------------------------------------------------------------------
  * Scatter coarse cell integer data in case of merged grids
  *
@@ -5278,7 +5447,8 @@ cs_grid_free_quantities(cs_grid_t  *g)
     g->face_cell = NULL;
     BFT_FREE(g->_xa);
     g->_xa = NULL;
-    if (cs_matrix_get_type(g->matrix) != CS_MATRIX_MSR) {
+    if (   cs_matrix_get_type(g->matrix) != CS_MATRIX_MSR
+        && cs_matrix_get_type(g->matrix) != CS_MATRIX_SELL) {
       BFT_FREE(g->_da);
       g->xa = NULL;
     }
@@ -5300,6 +5470,35 @@ cs_grid_free_quantities(cs_grid_t  *g)
   BFT_FREE(g->xa0ij);
 }
 
+/*----------------------------------------------------------------------------
+ * Switch a grid's matrix to reduced (single) precision coefficient storage.
+ *
+ * This only applies to coarse grids, and should be called only once
+ * all coarser grids have been built, as coarsening requires access to
+ * the full precision coefficients. Grids whose matrix format does not
+ * support reduced precision storage are left unchanged.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *
+ * returns:
+ *   true if matrix coefficients use reduced precision storage,
+ *   false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_reduce_matrix_precision(cs_grid_t  *g)
+{
+  bool retval = false;
+
+  assert(g != NULL);
+
+  if (g->level > 0 && g->_matrix != NULL)
+    retval = cs_matrix_reduce_precision(g->_matrix);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Get grid information.
  *
@@ -5538,6 +5737,10 @@ cs_grid_get_comm_merge(MPI_Comm  parent,
  *                                  merging should be applied
  *   merge_rows_glob_threshold  <-- global number of rows under which
  *                                  merging should be applied
+ *   merge_comm_ratio           <-- if > 0, target ratio of halo exchange
+ *                                  to local matrix.vector product time,
+ *                                  used to select the merge stride (up to
+ *                                  merge_stride) instead of row thresholds
  *   relaxation_parameter       <-- P0/P1 relaxation factor
  *
  * returns:
@@ -5552,6 +5755,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 int               merge_stride,
                 int               merge_rows_mean_threshold,
                 cs_gnum_t         merge_rows_glob_threshold,
+                double            merge_comm_ratio,
                 double            relaxation_parameter)
 {
   int recurse = 0;
@@ -5636,6 +5840,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
                                        c->coarse_row);
       break;
     case CS_MATRIX_MSR:
+    case CS_MATRIX_SELL:
       _automatic_aggregation_mx_msr(f, aggregation_limit, verbosity,
                                     c->coarse_row);
       break;
@@ -5650,6 +5855,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
   else if (coarsening_type == CS_GRID_COARSENING_SPD_PW) {
     switch (fine_matrix_type) {
     case CS_MATRIX_MSR:
+    case CS_MATRIX_SELL:
       _automatic_aggregation_pw_msr(f, verbosity, c->coarse_row);
       if (aggregation_limit > 2)
         recurse = 2;
@@ -5730,19 +5936,24 @@ cs_grid_coarsen(const cs_grid_t  *f,
 
   }
 
-  if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
+  if (   (   fine_matrix_type == CS_MATRIX_MSR
+          || fine_matrix_type == CS_MATRIX_SELL)
+      && c->relaxation <= 0) {
 
    _compute_coarse_quantities_msr(f, c);
 
     /* Merge grids if we are below the threshold */
 #if defined(HAVE_MPI)
    if (merge_stride > 1 && c->n_ranks > 1 && recurse == 0) {
-      cs_gnum_t  _n_ranks = c->n_ranks;
-      cs_gnum_t  _n_mean_g_rows = c->n_g_rows / _n_ranks;
-      if (   _n_mean_g_rows < (cs_gnum_t)merge_rows_mean_threshold
-          || c->n_g_rows < merge_rows_glob_threshold) {
+      int _merge_stride_c = _merge_stride(c,
+                                          merge_stride,
+                                          merge_rows_mean_threshold,
+                                          merge_rows_glob_threshold,
+                                          merge_comm_ratio,
+                                          verbosity);
+      if (_merge_stride_c > 1) {
         _native_from_msr(c);
-        _merge_grids(c, merge_stride, verbosity);
+        _merge_grids(c, _merge_stride_c, verbosity);
         _msr_from_native(c);
       }
     }
@@ -5766,11 +5977,14 @@ cs_grid_coarsen(const cs_grid_t  *f,
 
 #if defined(HAVE_MPI)
     if (merge_stride > 1 && c->n_ranks > 1 && recurse == 0) {
-      cs_gnum_t  _n_ranks = c->n_ranks;
-      cs_gnum_t  _n_mean_g_rows = c->n_g_rows / _n_ranks;
-      if (   _n_mean_g_rows < (cs_gnum_t)merge_rows_mean_threshold
-          || c->n_g_rows < merge_rows_glob_threshold)
-        _merge_grids(c, merge_stride, verbosity);
+      int _merge_stride_c = _merge_stride(c,
+                                          merge_stride,
+                                          merge_rows_mean_threshold,
+                                          merge_rows_glob_threshold,
+                                          merge_comm_ratio,
+                                          verbosity);
+      if (_merge_stride_c > 1)
+        _merge_grids(c, _merge_stride_c, verbosity);
     }
 #endif
 
@@ -5864,6 +6078,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
                                     merge_stride,
                                     merge_rows_mean_threshold,
                                     merge_rows_glob_threshold,
+                                    merge_comm_ratio,
                                     relaxation_parameter);
 
     /* Project coarsening */
@@ -5961,7 +6176,8 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
   if (verbosity > 3)
     _aggregation_stats_log(f, c, verbosity);
 
-  if (fine_matrix_type == CS_MATRIX_MSR) {
+  if (   fine_matrix_type == CS_MATRIX_MSR
+      || fine_matrix_type == CS_MATRIX_SELL) {
     _compute_coarse_quantities_msr(f, c);
 
 #if defined(HAVE_MPI)
@@ -6094,19 +6310,24 @@ cs_grid_restrict_row_var(const cs_grid_t  *f,
     MPI_Comm  comm = cs_glob_mpi_comm;
     static const int tag = 'r'+'e'+'s'+'t'+'r'+'i'+'c'+'t';
 
-    /* Append data */
+    /* Append data (receives from all merged ranks are posted at once,
+       so that they may complete in any order) */
 
     if (c->merge_sub_rank == 0) {
       int rank_id;
-      MPI_Status status;
+      MPI_Request *request;
+      BFT_MALLOC(request, c->merge_sub_size - 1, MPI_Request);
       assert(cs_glob_rank_id == c->merge_sub_root);
       for (rank_id = 1; rank_id < c->merge_sub_size; rank_id++) {
         cs_lnum_t n_recv = (  c->merge_cell_idx[rank_id+1]
                             - c->merge_cell_idx[rank_id]);
         int dist_rank = c->merge_sub_root + c->merge_stride*rank_id;
-        MPI_Recv(c_var + c->merge_cell_idx[rank_id]*db_size[1],
-                 n_recv*db_size[1], CS_MPI_REAL, dist_rank, tag, comm, &status);
+        MPI_Irecv(c_var + c->merge_cell_idx[rank_id]*db_size[1],
+                  n_recv*db_size[1], CS_MPI_REAL, dist_rank, tag, comm,
+                  request + rank_id - 1);
       }
+      MPI_Waitall(c->merge_sub_size - 1, request, MPI_STATUSES_IGNORE);
+      BFT_FREE(request);
     }
     else
       MPI_Send(c_var, c->n_elts_r[0]*db_size[1], CS_MPI_REAL,
@@ -6154,18 +6375,24 @@ cs_grid_prolong_row_var(const cs_grid_t  *c,
     MPI_Comm  comm = cs_glob_mpi_comm;
     static const int tag = 'p'+'r'+'o'+'l'+'o'+'n'+'g';
 
-    /* Append data */
+    /* Scatter data (sends to all merged ranks are posted at once,
+       so that a slow receiver does not delay the others) */
 
     if (c->merge_sub_rank == 0) {
       int rank_id;
+      MPI_Request *request;
+      BFT_MALLOC(request, c->merge_sub_size - 1, MPI_Request);
       assert(cs_glob_rank_id == c->merge_sub_root);
       for (rank_id = 1; rank_id < c->merge_sub_size; rank_id++) {
         cs_lnum_t n_send = (  c->merge_cell_idx[rank_id+1]
                             - c->merge_cell_idx[rank_id]);
         int dist_rank = c->merge_sub_root + c->merge_stride*rank_id;
-        MPI_Send(c_var + c->merge_cell_idx[rank_id]*db_size[1],
-                 n_send*db_size[1], CS_MPI_REAL, dist_rank, tag, comm);
+        MPI_Isend(c_var + c->merge_cell_idx[rank_id]*db_size[1],
+                  n_send*db_size[1], CS_MPI_REAL, dist_rank, tag, comm,
+                  request + rank_id - 1);
       }
+      MPI_Waitall(c->merge_sub_size - 1, request, MPI_STATUSES_IGNORE);
+      BFT_FREE(request);
     }
     else {
       MPI_Status status;
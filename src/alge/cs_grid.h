@@ -159,6 +159,25 @@ cs_grid_destroy(cs_grid_t  **grid);
 void
 cs_grid_free_quantities(cs_grid_t *g);
 
+/*----------------------------------------------------------------------------
+ * Switch a grid's matrix to reduced (single) precision coefficient storage.
+ *
+ * This only applies to coarse grids, and should be called only once
+ * all coarser grids have been built, as coarsening requires access to
+ * the full precision coefficients. Grids whose matrix format does not
+ * support reduced precision storage are left unchanged.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *
+ * returns:
+ *   true if matrix coefficients use reduced precision storage,
+ *   false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_reduce_matrix_precision(cs_grid_t  *g);
+
 /*----------------------------------------------------------------------------
  * Get grid information.
  *
@@ -299,6 +318,10 @@ cs_grid_get_comm_merge(MPI_Comm  parent,
  *                                  merging should be applied
  *   merge_rows_glob_threshold  <-- global number of rows under which
  *                                  merging should be applied
+ *   merge_comm_ratio           <-- if > 0, target ratio of halo exchange
+ *                                  to local matrix.vector product time,
+ *                                  used to select the merge stride (up to
+ *                                  merge_stride) instead of row thresholds
  *   relaxation_parameter       <-- P0/P1 relaxation factor
  *
  * returns:
@@ -313,6 +336,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 int               merge_stride,
                 int               merge_rows_mean_threshold,
                 cs_gnum_t         merge_rows_glob_threshold,
+                double            merge_comm_ratio,
                 double            relaxation_parameter);
 
 /*----------------------------------------------------------------------------
@@ -119,6 +119,12 @@ BEGIN_C_DECLS
 
 #define CS_CL  (CS_CL_SIZE/8)
 
+/* SELL-C-sigma storage: number of rows per chunk (a multiple of the
+   SIMD width) and size of row sorting windows */
+
+#define CS_MATRIX_SELL_C      8
+#define CS_MATRIX_SELL_SIGMA  128
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -135,7 +141,8 @@ BEGIN_C_DECLS
 const char  *cs_matrix_type_name[] = {N_("native"),
                                       N_("CSR"),
                                       N_("symmetric CSR"),
-                                      N_("MSR")};
+                                      N_("MSR"),
+                                      N_("SELL")};
 
 /* Full names for matrix types */
 
@@ -143,7 +150,8 @@ const char
 *cs_matrix_type_fullname[] = {N_("diagonal + faces"),
                               N_("Compressed Sparse Row"),
                               N_("symmetric Compressed Sparse Row"),
-                              N_("Modified Compressed Sparse Row")};
+                              N_("Modified Compressed Sparse Row"),
+                              N_("Sliced ELLPACK (SELL-C-sigma)")};
 
 /* Fill type names for matrices */
 
@@ -154,6 +162,15 @@ const char  *cs_matrix_fill_type_name[] = {"CS_MATRIX_SCALAR",
                                            "CS_MATRIX_BLOCK_D_SYM",
                                            "CS_MATRIX_BLOCK"};
 
+/* Overlap halo synchronization with local part of matrix.vector
+   products when possible */
+
+static bool _halo_overlap = false;
+
+static char _reduced_precision_error_str[]
+  = N_("%s: coefficients of a matrix using reduced precision storage\n"
+       "may not be reassigned.");
+
 #if defined (HAVE_MKL)
 
 static char _no_exclude_diag_error_str[]
@@ -624,6 +641,126 @@ _6_6_zero_range(cs_real_t  y[restrict],
     y[ii] = 0.0;
 }
 
+/*----------------------------------------------------------------------------
+ * Generate fixed block size variants of dense block helper functions.
+ *
+ * For a given block size N (without padding), this defines:
+ *
+ *   _dense_N_N_ax(b_id, a, x, y)
+ *     y[i] = a[i].x[i] for one dense block
+ *
+ *   _N_N_diag_vec_p_l(da, x, y, n_elts)
+ *     block version of y[i] = da[i].x[i], with da possibly NULL
+ *
+ * The block size being a compile-time constant, the compiler may fully
+ * unroll and vectorize inner loops, as for the hand-written 3x3 and 6x6
+ * variants above.
+ *----------------------------------------------------------------------------*/
+
+#define CS_MATRIX_DEFINE_FIXED_BLOCK_HELPERS(N)                              \
+                                                                             \
+static inline void                                                           \
+_dense_##N##_##N##_ax(cs_lnum_t         b_id,                                \
+                      const cs_real_t   a[restrict],                         \
+                      const cs_real_t   x[restrict],                         \
+                      cs_real_t         y[restrict])                         \
+{                                                                            \
+  const cs_real_t *restrict _a = a + b_id*N*N;                               \
+  const cs_real_t *restrict _x = x + b_id*N;                                 \
+                                                                             \
+  for (cs_lnum_t ii = 0; ii < N; ii++) {                                     \
+    cs_real_t s = 0.;                                                        \
+    for (cs_lnum_t jj = 0; jj < N; jj++)                                     \
+      s += _a[ii*N + jj] * _x[jj];                                           \
+    y[b_id*N + ii] = s;                                                      \
+  }                                                                          \
+}                                                                            \
+                                                                             \
+static inline void                                                           \
+_##N##_##N##_diag_vec_p_l(const cs_real_t  da[restrict],                     \
+                          const cs_real_t  x[restrict],                      \
+                          cs_real_t        y[restrict],                      \
+                          cs_lnum_t        n_elts)                           \
+{                                                                            \
+  const cs_lnum_t n_vals = n_elts*N;                                         \
+                                                                             \
+  if (da != NULL) {                                                          \
+    _Pragma("omp parallel for  if(n_vals > CS_THR_MIN)")                     \
+    for (cs_lnum_t ii = 0; ii < n_elts; ii++)                                \
+      _dense_##N##_##N##_ax(ii, da, x, y);                                   \
+  }                                                                          \
+  else {                                                                     \
+    _Pragma("omp parallel for  if(n_vals > CS_THR_MIN)")                     \
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)                                \
+      y[ii] = 0.0;                                                           \
+  }                                                                          \
+}
+
+CS_MATRIX_DEFINE_FIXED_BLOCK_HELPERS(2)
+CS_MATRIX_DEFINE_FIXED_BLOCK_HELPERS(4)
+CS_MATRIX_DEFINE_FIXED_BLOCK_HELPERS(5)
+
+/*----------------------------------------------------------------------------
+ * Generate fixed block size variant of y[i] += a[ij].x[j] for one dense
+ * extra-diagonal block (see _dense_eb_ax_add).
+ *
+ * For a given block size N (without padding), this defines:
+ *
+ *   _dense_N_N_eb_ax_add(b_i, b_j, b_ij, a, x, y)
+ *----------------------------------------------------------------------------*/
+
+#define CS_MATRIX_DEFINE_FIXED_EB_HELPERS(N)                                 \
+                                                                             \
+static inline void                                                           \
+_dense_##N##_##N##_eb_ax_add(cs_lnum_t        b_i,                           \
+                             cs_lnum_t        b_j,                           \
+                             cs_lnum_t        b_ij,                          \
+                             const cs_real_t  a[restrict],                   \
+                             const cs_real_t  x[restrict],                   \
+                             cs_real_t        y[restrict])                   \
+{                                                                            \
+  const cs_real_t *restrict _a = a + b_ij*N*N;                               \
+  const cs_real_t *restrict _x = x + b_j*N;                                  \
+                                                                             \
+  for (cs_lnum_t ii = 0; ii < N; ii++) {                                     \
+    cs_real_t s = 0.;                                                        \
+    for (cs_lnum_t jj = 0; jj < N; jj++)                                     \
+      s += _a[ii*N + jj] * _x[jj];                                           \
+    y[b_i*N + ii] += s;                                                      \
+  }                                                                          \
+}
+
+CS_MATRIX_DEFINE_FIXED_EB_HELPERS(2)
+CS_MATRIX_DEFINE_FIXED_EB_HELPERS(3)
+CS_MATRIX_DEFINE_FIXED_EB_HELPERS(4)
+CS_MATRIX_DEFINE_FIXED_EB_HELPERS(5)
+CS_MATRIX_DEFINE_FIXED_EB_HELPERS(6)
+
+/*----------------------------------------------------------------------------
+ * Check if a block size has fixed-size matrix.vector product variants.
+ *
+ * parameters:
+ *   b_size <-- block size, including padding:
+ *              b_size[0]: useful block size
+ *              b_size[1]: vector block extents
+ *              b_size[2]: matrix line extents
+ *              b_size[3]: matrix line*column (block) extents
+ *
+ * returns:
+ *   true if fixed-size variants are available, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_fixed_b_size(const cs_lnum_t  b_size[4])
+{
+  const cs_lnum_t n = b_size[0];
+
+  if (n < 2 || n > 6)
+    return false;
+
+  return (b_size[1] == n && b_size[3] == n*n) ? true : false;
+}
+
 /*----------------------------------------------------------------------------
  * Create native matrix structure.
  *
@@ -843,7 +980,8 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
     const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
     _da = mc->da;
   }
-  else if (matrix->type == CS_MATRIX_MSR) {
+  else if (   matrix->type == CS_MATRIX_MSR
+           || matrix->type == CS_MATRIX_SELL) {
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
     _da = mc->d_val;
   }
@@ -1230,6 +1368,114 @@ _6_6_mat_vec_p_l_native(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Generate local matrix.vector product y = A.x functions with native
+ * matrix, for a given fixed block size N (without padding):
+ *
+ *   _N_N_mat_vec_p_l_native     diagonal blocks, scalar extra-diagonal terms
+ *   _N_N_bb_mat_vec_p_l_native  diagonal and extra-diagonal blocks
+ *
+ * The _N_N_diag_vec_p_l and _dense_N_N_eb_ax_add helpers must be defined.
+ *
+ * parameters (of generated functions):
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+#define CS_MATRIX_DEFINE_FIXED_B_NATIVE_SPMV(N)                              \
+                                                                             \
+static void                                                                  \
+_##N##_##N##_mat_vec_p_l_native(bool                exclude_diag,            \
+                                const cs_matrix_t  *matrix,                  \
+                                const cs_real_t     x[restrict],             \
+                                cs_real_t           y[restrict])             \
+{                                                                            \
+  const cs_matrix_struct_native_t  *ms = matrix->structure;                  \
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;                      \
+                                                                             \
+  const cs_real_t  *restrict xa = mc->xa;                                    \
+                                                                             \
+  assert(matrix->db_size[0] == N && matrix->db_size[3] == N*N);              \
+                                                                             \
+  if (! exclude_diag) {                                                      \
+    _##N##_##N##_diag_vec_p_l(mc->da, x, y, ms->n_rows);                     \
+    _zero_range(y, ms->n_rows*N, ms->n_cols_ext*N);                          \
+  }                                                                          \
+  else                                                                       \
+    _zero_range(y, 0, ms->n_cols_ext*N);                                     \
+                                                                             \
+  if (mc->xa != NULL) {                                                      \
+                                                                             \
+    const cs_lnum_2_t *restrict face_cel_p = ms->edges;                      \
+    const cs_lnum_t xa_stride = (mc->symmetric) ? 1 : 2;                     \
+    const cs_lnum_t xa_shift = (mc->symmetric) ? 0 : 1;                      \
+                                                                             \
+    for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {          \
+      cs_lnum_t ii = face_cel_p[face_id][0];                                 \
+      cs_lnum_t jj = face_cel_p[face_id][1];                                 \
+      cs_real_t xa_ij = xa[xa_stride*face_id];                               \
+      cs_real_t xa_ji = xa[xa_stride*face_id + xa_shift];                    \
+      for (cs_lnum_t kk = 0; kk < N; kk++) {                                 \
+        y[ii*N + kk] += xa_ij * x[jj*N + kk];                                \
+        y[jj*N + kk] += xa_ji * x[ii*N + kk];                                \
+      }                                                                      \
+    }                                                                        \
+                                                                             \
+  }                                                                          \
+}
+
+#define CS_MATRIX_DEFINE_FIXED_BB_NATIVE_SPMV(N)                             \
+                                                                             \
+static void                                                                  \
+_##N##_##N##_bb_mat_vec_p_l_native(bool                exclude_diag,         \
+                                   const cs_matrix_t  *matrix,               \
+                                   const cs_real_t     x[restrict],          \
+                                   cs_real_t           y[restrict])          \
+{                                                                            \
+  const cs_matrix_struct_native_t  *ms = matrix->structure;                  \
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;                      \
+                                                                             \
+  const cs_real_t  *restrict xa = mc->xa;                                    \
+                                                                             \
+  assert(matrix->db_size[0] == N && matrix->db_size[3] == N*N);              \
+  assert(matrix->eb_size[0] == N && matrix->eb_size[3] == N*N);              \
+                                                                             \
+  if (! exclude_diag) {                                                      \
+    _##N##_##N##_diag_vec_p_l(mc->da, x, y, ms->n_rows);                     \
+    _zero_range(y, ms->n_rows*N, ms->n_cols_ext*N);                          \
+  }                                                                          \
+  else                                                                       \
+    _zero_range(y, 0, ms->n_cols_ext*N);                                     \
+                                                                             \
+  if (mc->xa != NULL) {                                                      \
+                                                                             \
+    const cs_lnum_2_t *restrict face_cel_p = ms->edges;                      \
+    const cs_lnum_t xa_stride = (mc->symmetric) ? 1 : 2;                     \
+    const cs_lnum_t xa_shift = (mc->symmetric) ? 0 : 1;                      \
+                                                                             \
+    for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {          \
+      cs_lnum_t ii = face_cel_p[face_id][0];                                 \
+      cs_lnum_t jj = face_cel_p[face_id][1];                                 \
+      _dense_##N##_##N##_eb_ax_add(ii, jj, xa_stride*face_id, xa, x, y);     \
+      _dense_##N##_##N##_eb_ax_add(jj, ii, xa_stride*face_id + xa_shift,     \
+                                   xa, x, y);                                \
+    }                                                                        \
+                                                                             \
+  }                                                                          \
+}
+
+CS_MATRIX_DEFINE_FIXED_B_NATIVE_SPMV(2)
+CS_MATRIX_DEFINE_FIXED_B_NATIVE_SPMV(4)
+CS_MATRIX_DEFINE_FIXED_B_NATIVE_SPMV(5)
+
+CS_MATRIX_DEFINE_FIXED_BB_NATIVE_SPMV(2)
+CS_MATRIX_DEFINE_FIXED_BB_NATIVE_SPMV(3)
+CS_MATRIX_DEFINE_FIXED_BB_NATIVE_SPMV(4)
+CS_MATRIX_DEFINE_FIXED_BB_NATIVE_SPMV(5)
+CS_MATRIX_DEFINE_FIXED_BB_NATIVE_SPMV(6)
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with native matrix, blocked version.
  *
@@ -1254,10 +1500,67 @@ _b_mat_vec_p_l_native_fixed(bool                exclude_diag,
   else if (matrix->db_size[0] == 6 && matrix->db_size[3] == 36)
     _6_6_mat_vec_p_l_native(exclude_diag, matrix, x, y);
 
+  else if (matrix->db_size[0] == 2 && matrix->db_size[3] == 4)
+    _2_2_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+
+  else if (matrix->db_size[0] == 4 && matrix->db_size[3] == 16)
+    _4_4_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+
+  else if (matrix->db_size[0] == 5 && matrix->db_size[3] == 25)
+    _5_5_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+
   else
     _b_mat_vec_p_l_native(exclude_diag, matrix, x, y);
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix, with
+ * diagonal and extra-diagonal blocks.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_native_fixed(bool                exclude_diag,
+                             const cs_matrix_t  *matrix,
+                             const cs_real_t     x[restrict],
+                             cs_real_t           y[restrict])
+{
+  const cs_lnum_t *db_size = matrix->db_size;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+
+  if (   _is_fixed_b_size(db_size) && _is_fixed_b_size(eb_size)
+      && db_size[0] == eb_size[0]) {
+
+    switch(db_size[0]) {
+    case 2:
+      _2_2_bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+      break;
+    case 3:
+      _3_3_bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+      break;
+    case 4:
+      _4_4_bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+      break;
+    case 5:
+      _5_5_bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+      break;
+    default:
+      _6_6_bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+    }
+
+  }
+
+  else
+    _bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+}
+
 #if defined(HAVE_OPENMP) /* OpenMP variants */
 
 /*----------------------------------------------------------------------------
@@ -1652,6 +1955,51 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build list of rows of a CSR matrix structure referencing ghost columns.
+ *
+ * This allows splitting matrix.vector products into a part which does
+ * not depend on ghost values (overlapping halo synchronization) and a part
+ * which depends on them.
+ *
+ * parameters:
+ *   ms  <->  pointer to CSR matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_halo_rows_csr(cs_matrix_struct_csr_t  *ms)
+{
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  ms->n_halo_rows = 0;
+  ms->halo_row_id = NULL;
+
+  if (ms->n_cols_ext <= n_rows)
+    return;
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    cs_lnum_t n_halo_rows = 0;
+
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++) {
+        if (ms->col_id[jj] >= n_rows) {
+          if (pass == 1)
+            ms->halo_row_id[n_halo_rows] = ii;
+          n_halo_rows++;
+          break;
+        }
+      }
+    }
+
+    if (pass == 0) {
+      ms->n_halo_rows = n_halo_rows;
+      BFT_MALLOC(ms->halo_row_id, n_halo_rows, cs_lnum_t);
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Destroy a CSR matrix structure.
  *
@@ -1670,6 +2018,8 @@ _destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
 
     BFT_FREE(ms->_col_id);
 
+    BFT_FREE(ms->halo_row_id);
+
     BFT_FREE(ms);
 
     *matrix = NULL;
@@ -1828,6 +2178,8 @@ _create_struct_csr(bool                have_diag,
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  _set_halo_rows_csr(ms);
+
   return ms;
 }
 
@@ -1896,6 +2248,8 @@ _create_struct_csr_from_csr(bool         have_diag,
 
   }
 
+  _set_halo_rows_csr(ms);
+
   return ms;
 }
 
@@ -1941,6 +2295,8 @@ _create_struct_csr_from_shared(bool              have_diag,
   ms->_row_index = NULL;
   ms->_col_id = NULL;
 
+  _set_halo_rows_csr(ms);
+
   return ms;
 }
 
@@ -2000,6 +2356,8 @@ _create_struct_csr_from_restrict_local(const cs_matrix_struct_csr_t  *src)
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  _set_halo_rows_csr(ms);
+
   return ms;
 }
 
@@ -3246,6 +3604,8 @@ _create_coeff_msr(void)
   mc->_d_val = NULL;
   mc->_x_val = NULL;
 
+  mc->_x_val_f = NULL;
+
   return mc;
 }
 
@@ -3263,6 +3623,7 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
 
     cs_matrix_coeff_msr_t  *mc = *coeff;
 
+    BFT_FREE(mc->_x_val_f);
     BFT_FREE(mc->_x_val);
 
     BFT_FREE(mc->_d_val);
@@ -3272,6 +3633,29 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return an MSR matrix extradiagonal coefficient, whatever its storage
+ * precision.
+ *
+ * parameters:
+ *   mc   <-- pointer to MSR matrix coefficients
+ *   k    <-- coefficient index
+ *
+ * returns:
+ *   coefficient value (0 if extradiagonal coefficients are not defined)
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_msr_x_val(const cs_matrix_coeff_msr_t  *mc,
+           cs_lnum_t                     k)
+{
+  if (mc->_x_val_f != NULL)
+    return mc->_x_val_f[k];
+  else if (mc->x_val != NULL)
+    return mc->x_val[k];
+  return 0.;
+}
+
 /*----------------------------------------------------------------------------
  * Set MSR matrix extradiagonal coefficients to zero.
  *
@@ -3611,6 +3995,10 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
 
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
 
+  if (mc->_x_val_f != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _(_reduced_precision_error_str), __func__);
+
   /* Map or copy diagonal values */
 
   _map_or_copy_da_coeffs_msr(matrix, copy, da);
@@ -3671,6 +4059,10 @@ _set_coeffs_msr_from_msr(cs_matrix_t       *matrix,
 
   bool d_transferred = false, x_transferred = false;
 
+  if (mc->_x_val_f != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _(_reduced_precision_error_str), __func__);
+
   /* TODO: we should use metadata or check that the row_index and
      column id values are consistent, which should be true as long
      as columns are ordered in an identical manner */
@@ -4113,6 +4505,64 @@ _6_6_mat_vec_p_l_msr(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Generate local matrix.vector product y = A.x function with MSR matrix,
+ * for a given fixed block size N (without padding):
+ *
+ *   _N_N_mat_vec_p_l_msr
+ *
+ * The _dense_N_N_ax helper must be defined.
+ *
+ * parameters (of generated function):
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+#define CS_MATRIX_DEFINE_FIXED_B_MSR_SPMV(N)                                 \
+                                                                             \
+static void                                                                  \
+_##N##_##N##_mat_vec_p_l_msr(bool                exclude_diag,               \
+                             const cs_matrix_t  *matrix,                     \
+                             const cs_real_t     x[restrict],                \
+                             cs_real_t           y[restrict])                \
+{                                                                            \
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;                     \
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;                         \
+  const cs_lnum_t  n_rows = ms->n_rows;                                      \
+                                                                             \
+  const cs_real_t *restrict d_val                                            \
+    = (!exclude_diag) ? mc->d_val : NULL;                                    \
+                                                                             \
+  assert(matrix->db_size[0] == N && matrix->db_size[3] == N*N);              \
+                                                                             \
+  _Pragma("omp parallel for  if(n_rows > CS_THR_MIN)")                       \
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {                                \
+                                                                             \
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];       \
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];         \
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];              \
+                                                                             \
+    if (d_val != NULL)                                                       \
+      _dense_##N##_##N##_ax(ii, d_val, x, y);                                \
+    else {                                                                   \
+      for (cs_lnum_t kk = 0; kk < N; kk++)                                   \
+        y[ii*N + kk] = 0.;                                                   \
+    }                                                                        \
+                                                                             \
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {                              \
+      for (cs_lnum_t kk = 0; kk < N; kk++)                                   \
+        y[ii*N + kk] += (m_row[jj]*x[col_id[jj]*N + kk]);                    \
+    }                                                                        \
+                                                                             \
+  }                                                                          \
+}
+
+CS_MATRIX_DEFINE_FIXED_B_MSR_SPMV(2)
+CS_MATRIX_DEFINE_FIXED_B_MSR_SPMV(4)
+CS_MATRIX_DEFINE_FIXED_B_MSR_SPMV(5)
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix, blocked version.
  *
@@ -4137,127 +4587,1074 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
   else if (matrix->db_size[0] == 6 && matrix->db_size[3] == 36)
     _6_6_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
 
+  else if (matrix->db_size[0] == 2 && matrix->db_size[3] == 4)
+    _2_2_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+
+  else if (matrix->db_size[0] == 4 && matrix->db_size[3] == 16)
+    _4_4_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+
+  else if (matrix->db_size[0] == 5 && matrix->db_size[3] == 25)
+    _5_5_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+
   else
     _b_mat_vec_p_l_msr_generic(exclude_diag, matrix, x, y);
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix, using MKL
+ * Compute row index bounds for a local thread.
+ *
+ * When called inside an OpenMP parallel section, this returns the
+ * start and past-the-end ids of the rows assigned to that thread.
+ * In other cases, the start id is 0, and the past-the-end id is n.
  *
  * parameters:
- *   exclude_diag <-- exclude diagonal if true
- *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
- *   y            --> resulting vector
+ *   n     <-- number of rows
+ *   s_id  --> start id for the current thread
+ *   e_id  --> past-the-end id for the current thread
  *----------------------------------------------------------------------------*/
 
-#if defined (HAVE_MKL)
-
-static void
-_mat_vec_p_l_msr_mkl(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t     x[restrict],
-                     cs_real_t           y[restrict])
+static inline void
+_thread_row_range(cs_lnum_t   n,
+                  cs_lnum_t  *s_id,
+                  cs_lnum_t  *e_id)
 {
-  const cs_matrix_struct_csr_t  *ms = matrix->structure;
-  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-
-  int n_rows = ms->n_rows;
-  char transa[] = "n";
+#if defined(HAVE_OPENMP)
+  int t_id = omp_get_thread_num();
+  int n_t = omp_get_num_threads();
+  cs_lnum_t t_n = (n + n_t - 1) / n_t;
+  *s_id = CS_MIN(t_id*t_n, n);
+  *e_id = CS_MIN((t_id+1)*t_n, n);
+#else
+  *s_id = 0;
+  *e_id = n;
+#endif
+}
 
-  mkl_cspblas_dcsrgemv(transa,
-                       &n_rows,
-                       mc->x_val,
-                       ms->row_index,
-                       ms->col_id,
-                       (double *)x,
-                       y);
+/*----------------------------------------------------------------------------
+ * Return the position of the first halo row with id greater or equal
+ * to a given row id.
+ *
+ * parameters:
+ *   ms     <-- pointer to CSR/MSR matrix structure
+ *   row_id <-- row id
+ *
+ * returns:
+ *   position in ms->halo_row_id
+ *----------------------------------------------------------------------------*/
 
-  /* Add diagonal contribution */
+static inline cs_lnum_t
+_halo_row_lower_bound(const cs_matrix_struct_csr_t  *ms,
+                      cs_lnum_t                      row_id)
+{
+  cs_lnum_t s_id = 0, e_id = ms->n_halo_rows;
 
-  if (!exclude_diag && mc->d_val != NULL) {
-    cs_lnum_t ii;
-    const double *restrict da = mc->d_val;
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++)
-      y[ii] += da[ii] * x[ii];
+  while (s_id < e_id) {
+    cs_lnum_t m_id = s_id + (e_id - s_id)/2;
+    if (ms->halo_row_id[m_id] < row_id)
+      s_id = m_id + 1;
+    else
+      e_id = m_id;
   }
-}
 
-#endif /* defined (HAVE_MKL) */
+  return s_id;
+}
 
 /*----------------------------------------------------------------------------
- * Synchronize ghost values prior to matrix.vector product
+ * Matrix.vector product y = A.x for one row of an MSR matrix.
+ *
+ * Operations are done in the same order as in _mat_vec_p_l_msr(),
+ * so that results are identical.
  *
  * parameters:
- *   rotation_mode <-- halo update option for rotational periodicity
- *   matrix        <-- pointer to matrix structure
- *   x             <-> multipliying vector values (ghost values updated)
+ *   ii     <-- row id
+ *   ms     <-- pointer to matrix structure
+ *   mc     <-- pointer to matrix coefficients
+ *   d_val  <-- diagonal values, or NULL to exclude diagonal
+ *   x      <-- multipliying vector values
+ *   y      --> resulting vector
  *----------------------------------------------------------------------------*/
 
-static void
-_pre_vector_multiply_sync_x(cs_halo_rotation_t   rotation_mode,
-                            const cs_matrix_t   *matrix,
-                            cs_real_t            x[restrict])
+static inline void
+_mat_vec_p_l_msr_row(cs_lnum_t                      ii,
+                     const cs_matrix_struct_csr_t  *ms,
+                     const cs_matrix_coeff_msr_t   *mc,
+                     const cs_real_t     *restrict  d_val,
+                     const cs_real_t     *restrict  x,
+                     cs_real_t           *restrict  y)
 {
-  assert(matrix->halo != NULL);
+  const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+  const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+  cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  cs_real_t sii = 0.0;
 
-  /* Non-blocked version */
+  for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+    sii += (m_row[jj]*x[col_id[jj]]);
 
-  if (matrix->db_size[3] == 1) {
+  if (d_val != NULL)
+    y[ii] = sii + d_val[ii]*x[ii];
+  else
+    y[ii] = sii;
+}
 
-    if (matrix->halo != NULL)
-      cs_halo_sync_component(matrix->halo,
-                             CS_HALO_STANDARD,
-                             rotation_mode,
-                             x);
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x for one row of an MSR matrix,
+ * blocked version.
+ *
+ * Operations are done in the same order as in _b_mat_vec_p_l_msr(),
+ * so that results are identical.
+ *
+ * parameters:
+ *   ii      <-- row id
+ *   db_size <-- diagonal block sizes
+ *   ms      <-- pointer to matrix structure
+ *   mc      <-- pointer to matrix coefficients
+ *   d_val   <-- diagonal values, or NULL to exclude diagonal
+ *   x       <-- multipliying vector values
+ *   y       --> resulting vector
+ *----------------------------------------------------------------------------*/
 
+static inline void
+_b_mat_vec_p_l_msr_row(cs_lnum_t                      ii,
+                       const cs_lnum_t                db_size[4],
+                       const cs_matrix_struct_csr_t  *ms,
+                       const cs_matrix_coeff_msr_t   *mc,
+                       const cs_real_t                d_val[restrict],
+                       const cs_real_t                x[restrict],
+                       cs_real_t                      y[restrict])
+{
+  const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+  const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+  cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+  if (d_val != NULL) {
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+      cs_real_t s = 0.;
+      for (cs_lnum_t ll = 0; ll < db_size[0]; ll++)
+        s +=   d_val[ii*db_size[3] + kk*db_size[2] + ll]
+             * x[ii*db_size[1] + ll];
+      y[ii*db_size[1] + kk] = s;
+    }
+  }
+  else {
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+      y[ii*db_size[1] + kk] = 0.;
   }
 
-  /* Blocked version */
-
-  else { /* if (matrix->db_size[3] > 1) */
-
-    const cs_lnum_t *db_size = matrix->db_size;
+  for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+      y[ii*db_size[1] + kk] += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
+  }
+}
 
-    /* Update distant ghost rows */
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, restricted to
+ * rows which do not reference ghost columns.
+ *
+ * This is the part of the product which may be computed while the halo
+ * of x is being synchronized; rows referencing ghost columns are handled
+ * by _mat_vec_p_l_msr_halo().
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
 
-    if (matrix->halo != NULL) {
+static void
+_mat_vec_p_l_msr_local(bool                exclude_diag,
+                       const cs_matrix_t  *matrix,
+                       const cs_real_t    *restrict x,
+                       cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
 
-      cs_halo_sync_var_strided(matrix->halo,
-                               CS_HALO_STANDARD,
-                               x,
-                               db_size[1]);
+  const cs_real_t *restrict d_val
+    = (!exclude_diag) ? mc->d_val : NULL;
 
-      /* Synchronize periodic values */
+# pragma omp parallel  if(n_rows > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_row_range(n_rows, &s_id, &e_id);
 
-#if !defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link with full library */
+    cs_lnum_t h_id = _halo_row_lower_bound(ms, s_id);
 
-      if (matrix->halo->n_transforms > 0) {
-        if (db_size[0] == 3)
-          cs_halo_perio_sync_var_vect(matrix->halo,
-                                      CS_HALO_STANDARD,
-                                      x,
-                                      db_size[1]);
-        else if (db_size[0] == 6)
-          cs_halo_perio_sync_var_sym_tens(matrix->halo,
-                                          CS_HALO_STANDARD,
-                                          x);
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      if (h_id < ms->n_halo_rows && ms->halo_row_id[h_id] == ii) {
+        h_id++;
+        continue;
       }
-
-#endif
-
+      _mat_vec_p_l_msr_row(ii, ms, mc, d_val, x, y);
     }
-
   }
 }
 
 /*----------------------------------------------------------------------------
- * Zero ghost values prior to matrix.vector product
+ * Local matrix.vector product y = A.x with MSR matrix, restricted to
+ * rows which reference ghost columns.
  *
  * parameters:
- *   matrix        <-- pointer to matrix structure
- *   y             --> resulting vector
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_halo(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_halo_rows = ms->n_halo_rows;
+
+  const cs_real_t *restrict d_val
+    = (!exclude_diag) ? mc->d_val : NULL;
+
+# pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+  for (cs_lnum_t h_id = 0; h_id < n_halo_rows; h_id++)
+    _mat_vec_p_l_msr_row(ms->halo_row_id[h_id], ms, mc, d_val, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version,
+ * restricted to rows which do not reference ghost columns.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_local(bool                exclude_diag,
+                         const cs_matrix_t  *matrix,
+                         const cs_real_t     x[restrict],
+                         cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+
+  const cs_real_t *restrict d_val
+    = (!exclude_diag) ? mc->d_val : NULL;
+
+# pragma omp parallel  if(n_rows > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_row_range(n_rows, &s_id, &e_id);
+
+    cs_lnum_t h_id = _halo_row_lower_bound(ms, s_id);
+
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      if (h_id < ms->n_halo_rows && ms->halo_row_id[h_id] == ii) {
+        h_id++;
+        continue;
+      }
+      _b_mat_vec_p_l_msr_row(ii, db_size, ms, mc, d_val, x, y);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version,
+ * restricted to rows which reference ghost columns.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_halo(bool                exclude_diag,
+                        const cs_matrix_t  *matrix,
+                        const cs_real_t     x[restrict],
+                        cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_halo_rows = ms->n_halo_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+
+  const cs_real_t *restrict d_val
+    = (!exclude_diag) ? mc->d_val : NULL;
+
+# pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+  for (cs_lnum_t h_id = 0; h_id < n_halo_rows; h_id++)
+    _b_mat_vec_p_l_msr_row(ms->halo_row_id[h_id], db_size, ms, mc, d_val,
+                           x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using single
+ * precision extradiagonal coefficients.
+ *
+ * Coefficients are promoted to double precision on the fly, so that
+ * accumulation is done in double precision.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_f(bool                exclude_diag,
+                   const cs_matrix_t  *matrix,
+                   const cs_real_t    *restrict x,
+                   cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const float *restrict m_row = mc->_x_val_f + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += ((cs_real_t)m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii + mc->d_val[ii]*x[ii];
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const float *restrict m_row = mc->_x_val_f + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += ((cs_real_t)m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii;
+
+    }
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version,
+ * using single precision extradiagonal coefficients.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_f(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t     x[restrict],
+                     cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+
+  bool use_diag = (!exclude_diag && mc->d_val != NULL) ? true : false;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->_x_val_f + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (use_diag)
+      _dense_b_ax(ii, db_size, mc->d_val, x, y);
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t m_ij = m_row[jj];
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+        y[ii*db_size[1] + kk]
+          += (m_ij*x[col_id[jj]*db_size[1] + kk]);
+      }
+    }
+
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using MKL
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+#if defined (HAVE_MKL)
+
+static void
+_mat_vec_p_l_msr_mkl(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t     x[restrict],
+                     cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  int n_rows = ms->n_rows;
+  char transa[] = "n";
+
+  mkl_cspblas_dcsrgemv(transa,
+                       &n_rows,
+                       mc->x_val,
+                       ms->row_index,
+                       ms->col_id,
+                       (double *)x,
+                       y);
+
+  /* Add diagonal contribution */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+    cs_lnum_t ii;
+    const double *restrict da = mc->d_val;
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++)
+      y[ii] += da[ii] * x[ii];
+  }
+}
+
+#endif /* defined (HAVE_MKL) */
+
+/*----------------------------------------------------------------------------
+ * Create a SELL-C-sigma matrix structure from an MSR matrix structure.
+ *
+ * The MSR structure's contents (including owned arrays) are transferred
+ * to the base part of the SELL structure, and the MSR structure is freed.
+ *
+ * parameters:
+ *   csr  <-> pointer to MSR matrix structure pointer
+ *
+ * returns:
+ *   pointer to allocated SELL matrix structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_sell_t *
+_create_struct_sell(cs_matrix_struct_csr_t  **csr)
+{
+  cs_matrix_struct_sell_t  *ms;
+
+  BFT_MALLOC(ms, 1, cs_matrix_struct_sell_t);
+
+  memcpy(&(ms->csr), *csr, sizeof(cs_matrix_struct_csr_t));
+  BFT_FREE(*csr);
+
+  const cs_lnum_t  n_rows = ms->csr.n_rows;
+  const cs_lnum_t  *row_index = ms->csr.row_index;
+  const cs_lnum_t  *col_id = ms->csr.col_id;
+  const cs_lnum_t  c_size = CS_MATRIX_SELL_C;
+
+  ms->chunk_size = c_size;
+  ms->sigma = CS_MATRIX_SELL_SIGMA;
+  ms->n_chunks = (n_rows + c_size - 1) / c_size;
+
+  const cs_lnum_t  n_chunks = ms->n_chunks;
+
+  BFT_MALLOC(ms->chunk_index, n_chunks + 1, cs_lnum_t);
+  BFT_MALLOC(ms->row_id, n_chunks*c_size, cs_lnum_t);
+
+  /* Sort rows by decreasing length inside each sorting window;
+     a stable (insertion) sort is used so as to preserve locality */
+
+  for (cs_lnum_t s_id = 0; s_id < n_rows; s_id += ms->sigma) {
+    const cs_lnum_t s_end = CS_MIN(s_id + ms->sigma, n_rows);
+    for (cs_lnum_t ii = s_id; ii < s_end; ii++) {
+      const cs_lnum_t n_cols = row_index[ii+1] - row_index[ii];
+      cs_lnum_t jj = ii;
+      while (jj > s_id) {
+        const cs_lnum_t p_id = ms->row_id[jj-1];
+        if (row_index[p_id+1] - row_index[p_id] >= n_cols)
+          break;
+        ms->row_id[jj] = p_id;
+        jj--;
+      }
+      ms->row_id[jj] = ii;
+    }
+  }
+
+  for (cs_lnum_t ii = n_rows; ii < n_chunks*c_size; ii++)
+    ms->row_id[ii] = -1;
+
+  /* Chunk widths are those of their longest row */
+
+  ms->chunk_index[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    const cs_lnum_t *r_id = ms->row_id + c_id*c_size;
+    cs_lnum_t n_cols_max = 0;
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      if (r_id[kk] > -1) {
+        cs_lnum_t n_cols = row_index[r_id[kk]+1] - row_index[r_id[kk]];
+        if (n_cols > n_cols_max)
+          n_cols_max = n_cols;
+      }
+    }
+    ms->chunk_index[c_id+1] = ms->chunk_index[c_id] + n_cols_max*c_size;
+  }
+
+  /* Sliced column ids; padding refers to the row itself (or to the
+     first row for empty slots) so as to remain cache-friendly */
+
+  BFT_MALLOC(ms->col_id, ms->chunk_index[n_chunks], cs_lnum_t);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    const cs_lnum_t *r_id = ms->row_id + c_id*c_size;
+    const cs_lnum_t c_n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / c_size;
+    cs_lnum_t *c_col_id = ms->col_id + ms->chunk_index[c_id];
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      cs_lnum_t n_cols = 0, pad_id = 0;
+      if (r_id[kk] > -1) {
+        const cs_lnum_t *s_col_id = col_id + row_index[r_id[kk]];
+        n_cols = row_index[r_id[kk]+1] - row_index[r_id[kk]];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          c_col_id[jj*c_size + kk] = s_col_id[jj];
+        pad_id = r_id[kk];
+      }
+      for (cs_lnum_t jj = n_cols; jj < c_n_cols; jj++)
+        c_col_id[jj*c_size + kk] = pad_id;
+    }
+  }
+
+  return ms;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a SELL matrix structure.
+ *
+ * parameters:
+ *   matrix  <->  pointer to SELL matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_struct_sell(cs_matrix_struct_sell_t  **matrix)
+{
+  if (matrix != NULL && *matrix !=NULL) {
+
+    cs_matrix_struct_sell_t  *ms = *matrix;
+
+    BFT_FREE(ms->col_id);
+    BFT_FREE(ms->row_id);
+    BFT_FREE(ms->chunk_index);
+
+    BFT_FREE(ms->csr._row_index);
+    BFT_FREE(ms->csr._col_id);
+    BFT_FREE(ms->csr.halo_row_id);
+
+    BFT_FREE(ms);
+
+    *matrix = NULL;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create SELL matrix coefficients.
+ *
+ * returns:
+ *   pointer to allocated SELL coefficients structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_coeff_sell_t *
+_create_coeff_sell(void)
+{
+  cs_matrix_coeff_sell_t  *mc;
+
+  /* Allocate */
+
+  BFT_MALLOC(mc, 1, cs_matrix_coeff_sell_t);
+
+  /* Initialize */
+
+  mc->msr.max_db_size = 0;
+  mc->msr.max_eb_size = 0;
+
+  mc->msr.d_val = NULL;
+  mc->msr.x_val = NULL;
+
+  mc->msr._d_val = NULL;
+  mc->msr._x_val = NULL;
+
+  mc->msr._x_val_f = NULL;
+
+  mc->val = NULL;
+
+  return mc;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy SELL matrix coefficients.
+ *
+ * parameters:
+ *   coeff  <->  pointer to SELL matrix coefficients pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_coeff_sell(cs_matrix_coeff_sell_t  **coeff)
+{
+  if (coeff != NULL && *coeff !=NULL) {
+
+    cs_matrix_coeff_sell_t  *mc = *coeff;
+
+    BFT_FREE(mc->val);
+
+    BFT_FREE(mc->msr._x_val);
+    BFT_FREE(mc->msr._d_val);
+
+    BFT_FREE(*coeff);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build sliced SELL extradiagonal coefficients from their MSR form.
+ *
+ * Row-based (MSR) extradiagonal coefficients are freed or unmapped
+ * once the sliced coefficients are built.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack_coeffs_sell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t  c_size = ms->chunk_size;
+  const cs_lnum_t  n_chunks = ms->n_chunks;
+  const cs_lnum_t  *row_index = ms->csr.row_index;
+  const cs_real_t  *x_val = mc->msr.x_val;
+
+  if (matrix->eb_size[3] > 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: matrices in %s format do not handle\n"
+                "extradiagonal blocks."),
+              __func__, _(cs_matrix_type_name[matrix->type]));
+
+  BFT_REALLOC(mc->val, ms->chunk_index[n_chunks], cs_real_t);
+
+# pragma omp parallel for  if(n_chunks*c_size > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    const cs_lnum_t *r_id = ms->row_id + c_id*c_size;
+    const cs_lnum_t c_n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / c_size;
+    cs_real_t *c_val = mc->val + ms->chunk_index[c_id];
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      cs_lnum_t n_cols = 0;
+      if (r_id[kk] > -1 && x_val != NULL) {
+        const cs_real_t *m_row = x_val + row_index[r_id[kk]];
+        n_cols = row_index[r_id[kk]+1] - row_index[r_id[kk]];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          c_val[jj*c_size + kk] = m_row[jj];
+      }
+      for (cs_lnum_t jj = n_cols; jj < c_n_cols; jj++)
+        c_val[jj*c_size + kk] = 0.;
+    }
+  }
+
+  BFT_FREE(mc->msr._x_val);
+  mc->msr.x_val = NULL;
+  mc->msr.max_eb_size = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix coefficients.
+ *
+ * Coefficients are first assigned in MSR form, then sliced.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if diagonal coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  _set_coeffs_msr(matrix, symmetric, copy, n_edges, edges, da, xa);
+
+  _pack_coeffs_sell(matrix);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete assembly of SELL matrix coefficients (assembled in MSR form).
+ *
+ * parameters:
+ *   matrix_p <-> untyped pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_assembler_values_end(void  *matrix_p)
+{
+  _pack_coeffs_sell((cs_matrix_t *)matrix_p);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix.
+ *
+ * Rows of a given chunk are handled simultaneously, so the inner loop
+ * may be vectorized.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell(bool                exclude_diag,
+                  const cs_matrix_t  *matrix,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_chunks = ms->n_chunks;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
+
+  assert(ms->chunk_size == CS_MATRIX_SELL_C);
+
+# pragma omp parallel for  if(n_chunks*CS_MATRIX_SELL_C > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict r_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->chunk_index[c_id];
+    const cs_real_t *restrict m_val = mc->val + ms->chunk_index[c_id];
+    const cs_lnum_t n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / CS_MATRIX_SELL_C;
+
+    cs_real_t s[CS_MATRIX_SELL_C];
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++)
+      s[kk] = 0.;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_lnum_t *restrict j_col_id = col_id + jj*CS_MATRIX_SELL_C;
+      const cs_real_t *restrict j_val = m_val + jj*CS_MATRIX_SELL_C;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++)
+        s[kk] += j_val[kk]*x[j_col_id[kk]];
+    }
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      const cs_lnum_t ii = r_id[kk];
+      if (ii > -1) {
+        if (d_val != NULL)
+          y[ii] = s[kk] + d_val[ii]*x[ii];
+        else
+          y[ii] = s[kk];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix, 3x3 blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_mat_vec_p_l_sell(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_chunks = ms->n_chunks;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
+
+  assert(ms->chunk_size == CS_MATRIX_SELL_C);
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+
+# pragma omp parallel for  if(n_chunks*CS_MATRIX_SELL_C > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict r_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->chunk_index[c_id];
+    const cs_real_t *restrict m_val = mc->val + ms->chunk_index[c_id];
+    const cs_lnum_t n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / CS_MATRIX_SELL_C;
+
+    cs_real_t s0[CS_MATRIX_SELL_C], s1[CS_MATRIX_SELL_C], s2[CS_MATRIX_SELL_C];
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      s0[kk] = 0.;
+      s1[kk] = 0.;
+      s2[kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_lnum_t *restrict j_col_id = col_id + jj*CS_MATRIX_SELL_C;
+      const cs_real_t *restrict j_val = m_val + jj*CS_MATRIX_SELL_C;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+        const cs_real_t *restrict _x = x + j_col_id[kk]*3;
+        s0[kk] += j_val[kk]*_x[0];
+        s1[kk] += j_val[kk]*_x[1];
+        s2[kk] += j_val[kk]*_x[2];
+      }
+    }
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      const cs_lnum_t ii = r_id[kk];
+      if (ii > -1) {
+        if (d_val != NULL) {
+          _dense_3_3_ax(ii, d_val, x, y);
+          y[ii*3]     += s0[kk];
+          y[ii*3 + 1] += s1[kk];
+          y[ii*3 + 2] += s2[kk];
+        }
+        else {
+          y[ii*3]     = s0[kk];
+          y[ii*3 + 1] = s1[kk];
+          y[ii*3 + 2] = s2[kk];
+        }
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix, blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell_generic(bool                exclude_diag,
+                            const cs_matrix_t  *matrix,
+                            const cs_real_t     x[restrict],
+                            cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_chunks = ms->n_chunks;
+  const cs_lnum_t  c_size = ms->chunk_size;
+  const cs_lnum_t  *db_size = matrix->db_size;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
+
+# pragma omp parallel for  if(n_chunks*c_size > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict r_id = ms->row_id + c_id*c_size;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->chunk_index[c_id];
+    const cs_real_t *restrict m_val = mc->val + ms->chunk_index[c_id];
+    const cs_lnum_t n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / c_size;
+
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+
+      const cs_lnum_t ii = r_id[kk];
+      if (ii < 0)
+        continue;
+
+      if (d_val != NULL)
+        _dense_b_ax(ii, db_size, d_val, x, y);
+      else {
+        for (cs_lnum_t ll = 0; ll < db_size[0]; ll++)
+          y[ii*db_size[1] + ll] = 0.;
+      }
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t v = m_val[jj*c_size + kk];
+        const cs_lnum_t c_id_x = col_id[jj*c_size + kk]*db_size[1];
+        for (cs_lnum_t ll = 0; ll < db_size[0]; ll++)
+          y[ii*db_size[1] + ll] += v*x[c_id_x + ll];
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix, blocked version.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t     x[restrict],
+                    cs_real_t           y[restrict])
+{
+  if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
+    _3_3_mat_vec_p_l_sell(exclude_diag, matrix, x, y);
+
+  else
+    _b_mat_vec_p_l_sell_generic(exclude_diag, matrix, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Apply periodic transformations to ghost values of a blocked vector
+ * prior to matrix.vector product, once distant ghost values are updated.
+ *
+ * parameters:
+ *   matrix        <-- pointer to matrix structure
+ *   x             <-> multipliying vector values (ghost values updated)
+ *----------------------------------------------------------------------------*/
+
+static void
+_pre_vector_multiply_sync_x_perio(const cs_matrix_t   *matrix,
+                                  cs_real_t            x[restrict])
+{
+#if !defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link with full library */
+
+  const cs_lnum_t *db_size = matrix->db_size;
+
+  if (matrix->halo->n_transforms > 0) {
+    if (db_size[0] == 3)
+      cs_halo_perio_sync_var_vect(matrix->halo,
+                                  CS_HALO_STANDARD,
+                                  x,
+                                  db_size[1]);
+    else if (db_size[0] == 6)
+      cs_halo_perio_sync_var_sym_tens(matrix->halo,
+                                      CS_HALO_STANDARD,
+                                      x);
+  }
+
+#else
+
+  CS_UNUSED(matrix);
+  CS_UNUSED(x);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize ghost values prior to matrix.vector product
+ *
+ * parameters:
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   matrix        <-- pointer to matrix structure
+ *   x             <-> multipliying vector values (ghost values updated)
+ *----------------------------------------------------------------------------*/
+
+static void
+_pre_vector_multiply_sync_x(cs_halo_rotation_t   rotation_mode,
+                            const cs_matrix_t   *matrix,
+                            cs_real_t            x[restrict])
+{
+  assert(matrix->halo != NULL);
+
+  /* Non-blocked version */
+
+  if (matrix->db_size[3] == 1) {
+
+    if (matrix->halo != NULL)
+      cs_halo_sync_component(matrix->halo,
+                             CS_HALO_STANDARD,
+                             rotation_mode,
+                             x);
+
+  }
+
+  /* Blocked version */
+
+  else { /* if (matrix->db_size[3] > 1) */
+
+    const cs_lnum_t *db_size = matrix->db_size;
+
+    /* Update distant ghost rows */
+
+    if (matrix->halo != NULL) {
+
+      cs_halo_sync_var_strided(matrix->halo,
+                               CS_HALO_STANDARD,
+                               x,
+                               db_size[1]);
+
+      /* Synchronize periodic values */
+
+      _pre_vector_multiply_sync_x_perio(matrix, x);
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Zero ghost values prior to matrix.vector product
+ *
+ * parameters:
+ *   matrix        <-- pointer to matrix structure
+ *   y             --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
@@ -4294,6 +5691,102 @@ _pre_vector_multiply_sync(cs_halo_rotation_t   rotation_mode,
   _pre_vector_multiply_sync_x(rotation_mode, matrix, x);
 }
 
+/*----------------------------------------------------------------------------
+ * Check if the halo synchronization of a matrix.vector product may be
+ * overlapped with computation of its local part.
+ *
+ * This is currently possible for MSR matrices with scalar extra-diagonal
+ * terms and double precision coefficients, when values are exchanged
+ * with other ranks, and the selected product variant is the standard one
+ * (so that tuned or fixed block size variants are not bypassed).
+ *
+ * parameters:
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   exclude_diag  <-- exclude diagonal if true
+ *   matrix        <-- pointer to matrix structure
+ *
+ * returns:
+ *   true if the overlapped product may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_vector_multiply_overlap_is_usable(cs_halo_rotation_t   rotation_mode,
+                                   bool                 exclude_diag,
+                                   const cs_matrix_t   *matrix)
+{
+  if (   _halo_overlap == false
+      || cs_glob_n_ranks < 2
+      || matrix->halo == NULL
+      || matrix->type != CS_MATRIX_MSR
+      || matrix->eb_size[3] > 1)
+    return false;
+
+  /* Rotation handling options other than copy require saving or
+     zeroing of halo values after exchange for scalar matrices. */
+
+  if (   matrix->db_size[3] == 1
+      && matrix->halo->n_rotations > 0
+      && rotation_mode != CS_HALO_ROTATION_COPY)
+    return false;
+
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc == NULL || mc->x_val == NULL || mc->_x_val_f != NULL)
+    return false;
+
+  /* The overlapped product splits the standard variant by rows */
+
+  const int ed_id = (exclude_diag) ? 1 : 0;
+  cs_matrix_vector_product_t *spmv
+    = matrix->vector_multiply[matrix->fill_type][ed_id];
+
+  if (matrix->db_size[3] == 1)
+    return (spmv == _mat_vec_p_l_msr) ? true : false;
+  else
+    return (spmv == _b_mat_vec_p_l_msr) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with halo synchronization of x overlapped
+ * with the local part of the product.
+ *
+ * Exchange of ghost values is started, the contribution of local columns
+ * is computed for all rows, and that of ghost columns is added for rows
+ * referencing them once the exchange is complete.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-> multipliying vector values (ghost values updated)
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_vector_multiply_overlap(bool                 exclude_diag,
+                         const cs_matrix_t   *matrix,
+                         cs_real_t           *restrict x,
+                         cs_real_t           *restrict y)
+{
+  _pre_vector_multiply_sync_y(matrix, y);
+
+  cs_halo_sync_var_strided_start(matrix->halo,
+                                 CS_HALO_STANDARD,
+                                 x,
+                                 matrix->db_size[1]);
+
+  if (matrix->db_size[3] == 1) {
+    _mat_vec_p_l_msr_local(exclude_diag, matrix, x, y);
+    cs_halo_sync_wait();
+    _mat_vec_p_l_msr_halo(exclude_diag, matrix, x, y);
+  }
+  else {
+    _b_mat_vec_p_l_msr_local(exclude_diag, matrix, x, y);
+    cs_halo_sync_wait();
+    _pre_vector_multiply_sync_x_perio(matrix, x);
+    _b_mat_vec_p_l_msr_halo(exclude_diag, matrix, x, y);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Add variant
  *
@@ -4359,9 +5852,10 @@ _variant_add(const char                        *name,
  *   CS_MATRIX_NATIVE  (all fill types)
  *     default
  *     standard
- *     fixed           (for CS_MATRIX_33_BLOCK_D or CS_MATRIX_33_BLOCK_D_SYM)
  *     omp             (for OpenMP with compatible numbering)
  *     vector          (For vector machine with compatible numbering)
+ *     generic         (for block fill types, without fixed block size
+ *                      specializations)
  *
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     default
@@ -4378,6 +5872,12 @@ _variant_add(const char                        *name,
  *     standard
  *     omp_sched       (Improved scheduling for OpenMP)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     generic         (for block diagonal fill types, without fixed block
+ *                      size specializations)
+ *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
  *
  * parameters:
  *   m_type          <-- Matrix type
@@ -4431,9 +5931,8 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[1] = _b_mat_vec_p_l_native_fixed;
         break;
       case CS_MATRIX_BLOCK:
-        spmv[0] = _bb_mat_vec_p_l_native;
-        spmv[1] = _bb_mat_vec_p_l_native;
-        break;
+        spmv[0] = _bb_mat_vec_p_l_native_fixed;
+        spmv[1] = _bb_mat_vec_p_l_native_fixed;
         break;
       default:
         break;
@@ -4535,6 +6034,23 @@ _set_spmv_func(cs_matrix_type_t             m_type,
       }
     }
 
+    else if (!strcmp(func_name, "generic")) {
+      switch(fill_type) {
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_native;
+        spmv[1] = _b_mat_vec_p_l_native;
+        break;
+      case CS_MATRIX_BLOCK:
+        spmv[0] = _bb_mat_vec_p_l_native;
+        spmv[1] = _bb_mat_vec_p_l_native;
+        break;
+      default:
+        break;
+      }
+    }
+
     break;
 
   case CS_MATRIX_CSR:
@@ -4619,12 +6135,47 @@ _set_spmv_func(cs_matrix_type_t             m_type,
 #endif
     }
 
-    else if (!strcmp(func_name, "omp_sched")) {
+    else if (!strcmp(func_name, "omp_sched")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_msr_omp_sched;
+        spmv[1] = _mat_vec_p_l_msr_omp_sched;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "generic")) {
+      switch(fill_type) {
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_msr_generic;
+        spmv[1] = _b_mat_vec_p_l_msr_generic;
+        break;
+      default:
+        break;
+      }
+    }
+
+    break;
+
+  case CS_MATRIX_SELL:
+
+    if (standard > 0) {
       switch(fill_type) {
       case CS_MATRIX_SCALAR:
       case CS_MATRIX_SCALAR_SYM:
-        spmv[0] = _mat_vec_p_l_msr_omp_sched;
-        spmv[1] = _mat_vec_p_l_msr_omp_sched;
+        spmv[0] = _mat_vec_p_l_sell;
+        spmv[1] = _mat_vec_p_l_sell;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell;
+        spmv[1] = _b_mat_vec_p_l_sell;
         break;
       default:
         break;
@@ -4653,7 +6204,7 @@ _set_spmv_func(cs_matrix_type_t             m_type,
 /*!
  * \brief Create matrix structure internals using a matrix assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -4750,6 +6301,15 @@ _structure_from_assembler(cs_matrix_type_t        type,
                                               &_col_id);
     }
     break;
+
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *_structure
+        = _structure_from_assembler(CS_MATRIX_MSR, n_rows, n_cols_ext, ma);
+      structure = _create_struct_sell(&_structure);
+    }
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -4804,6 +6364,13 @@ _structure_destroy(cs_matrix_type_t   type,
       *structure = _structure;
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_sell_t *_structure = *structure;
+      _destroy_struct_sell(&_structure);
+      *structure = _structure;
+    }
+    break;
   default:
     assert(0);
     break;
@@ -4874,6 +6441,9 @@ _matrix_create(cs_matrix_type_t  type)
   case CS_MATRIX_MSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_sell();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4924,6 +6494,12 @@ _matrix_create(cs_matrix_type_t  type)
     m->copy_diagonal = _copy_diagonal_separate;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_msr;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
   default:
     assert(0);
     break;
@@ -5023,6 +6599,16 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                        n_edges,
                                        edges);
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *_structure = _create_struct_csr(false,
+                                                              n_rows,
+                                                              n_cols_ext,
+                                                              n_edges,
+                                                              edges);
+      ms->structure = _create_struct_sell(&_structure);
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -5044,7 +6630,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 /*!
  * \brief Create a matrix structure based on a MSR connectivity definition.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * col_id is sorted row by row during the creation of this structure.
  *
@@ -5112,6 +6698,19 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                                 row_index,
                                                 col_id);
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *_structure
+        = _create_struct_csr_from_csr(false,
+                                      transfer,
+                                      false,
+                                      n_rows,
+                                      n_cols_ext,
+                                      row_index,
+                                      col_id);
+      ms->structure = _create_struct_sell(&_structure);
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -5197,7 +6796,7 @@ cs_matrix_structure_create_msr_shared(bool                    have_diag,
 /*!
  * \brief Create a matrix structure using a matrix assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -5298,7 +6897,7 @@ cs_matrix_create(const cs_matrix_structure_t  *ms)
 /*!
  * \brief Create a matrix directly from assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -5378,6 +6977,9 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
   case CS_MATRIX_MSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_sell();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -5430,26 +7032,53 @@ cs_matrix_create_by_local_restrict(const cs_matrix_t  *src)
 
   switch(m->type) {
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
-      m->_structure = _create_struct_csr_from_restrict_local(src->structure);
+      /* SELL matrices are restricted through their MSR form */
+      cs_matrix_struct_csr_t *_ms
+        = _create_struct_csr_from_restrict_local(src->structure);
+      if (m->type == CS_MATRIX_SELL) {
+        cs_matrix_sell_msr_x_val(src);
+        m->_structure = _create_struct_sell(&_ms);
+        m->coeffs = _create_coeff_sell();
+      }
+      else {
+        m->_structure = _ms;
+        m->coeffs = _create_coeff_msr();
+      }
       m->structure = m->_structure;
-      m->coeffs = _create_coeff_msr();
       cs_matrix_coeff_msr_t  *mc = m->coeffs;
       cs_matrix_coeff_msr_t  *mc_src = src->coeffs;
       const cs_matrix_struct_csr_t *ms = m->structure;
       const cs_matrix_struct_csr_t *ms_src = src->structure;
       mc->d_val = mc_src->d_val;
-      BFT_MALLOC(mc->_x_val, src->eb_size[3]*ms->row_index[n_rows], cs_real_t);
-      mc->x_val = mc->_x_val;
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-        const cs_lnum_t  n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-        const cs_real_t  *s_row =   mc_src->x_val
-                                  + ms_src->row_index[ii]*eb_size[3];
-        cs_real_t  *m_row = mc->_x_val + ms->row_index[ii]*eb_size[3];
-        memcpy(m_row, s_row, sizeof(cs_real_t)*eb_size[3]*n_cols);
+      if (mc_src->_x_val_f != NULL) {
+        /* Reduced precision source: keep the same storage, so that the
+           inherited matrix.vector product functions remain valid */
+        BFT_MALLOC(mc->_x_val_f, eb_size[3]*ms->row_index[n_rows], float);
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          const cs_lnum_t  n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+          const float  *s_row =   mc_src->_x_val_f
+                                + ms_src->row_index[ii]*eb_size[3];
+          float  *m_row = mc->_x_val_f + ms->row_index[ii]*eb_size[3];
+          memcpy(m_row, s_row, sizeof(float)*eb_size[3]*n_cols);
+        }
+      }
+      else {
+        BFT_MALLOC(mc->_x_val, eb_size[3]*ms->row_index[n_rows], cs_real_t);
+        mc->x_val = mc->_x_val;
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          const cs_lnum_t  n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+          const cs_real_t  *s_row =   mc_src->x_val
+                                    + ms_src->row_index[ii]*eb_size[3];
+          cs_real_t  *m_row = mc->_x_val + ms->row_index[ii]*eb_size[3];
+          memcpy(m_row, s_row, sizeof(cs_real_t)*eb_size[3]*n_cols);
+        }
       }
       mc->max_db_size = m->db_size[3];
       mc->max_eb_size = m->eb_size[3];
+      if (m->type == CS_MATRIX_SELL)
+        _pack_coeffs_sell(m);
     }
     break;
   case CS_MATRIX_NATIVE:
@@ -5510,6 +7139,13 @@ cs_matrix_destroy(cs_matrix_t **matrix)
         m->coeffs = NULL;
       }
       break;
+    case CS_MATRIX_SELL:
+      {
+        cs_matrix_coeff_sell_t *coeffs = m->coeffs;
+        _destroy_coeff_sell(&coeffs);
+        m->coeffs = NULL;
+      }
+      break;
     default:
       assert(0);
       break;
@@ -5617,6 +7253,7 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
     }
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       const cs_matrix_struct_csr_t  *ms = matrix->structure;
       retval = ms->row_index[ms->n_rows] + ms->n_rows;
@@ -5955,6 +7592,18 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                              x_val);
     break;
 
+  case CS_MATRIX_SELL:
+    _set_coeffs_msr_from_msr(matrix,
+                             false, /* ignored in case of transfer */
+                             row_index,
+                             col_id,
+                             d_val_p,
+                             d_val,
+                             x_val_p,
+                             x_val);
+    _pack_coeffs_sell(matrix);
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -6064,6 +7713,18 @@ cs_matrix_assembler_values_init(cs_matrix_t      *matrix,
                                             NULL,
                                             NULL);
     break;
+  case CS_MATRIX_SELL:
+    mav = cs_matrix_assembler_values_create(matrix->assembler,
+                                            true,
+                                            diag_block_size,
+                                            extra_diag_block_size,
+                                            (void *)matrix,
+                                            cs_matrix_msr_assembler_values_init,
+                                            cs_matrix_msr_assembler_values_add,
+                                            NULL,
+                                            NULL,
+                                            _sell_assembler_values_end);
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -6144,6 +7805,115 @@ cs_matrix_is_mapped_from_native(const cs_matrix_t  *matrix)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Switch matrix extradiagonal coefficients to single precision storage.
+ *
+ * This is currently only available for MSR matrices with scalar or
+ * block diagonal fill types. Diagonal coefficients are kept in double
+ * precision, and matrix-vector products are still accumulated in double
+ * precision, so only the extradiagonal coefficients (which represent
+ * most of the matrix memory traffic) are affected.
+ *
+ * Once converted, the matrix coefficients may not be reassigned, and
+ * extradiagonal values are not available through
+ * \ref cs_matrix_get_msr_arrays, so this should only be used for matrices
+ * which are accessed through matrix-vector products (for example,
+ * coarse multigrid levels).
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ *
+ * \return  true if coefficients were converted, false if this is not
+ *          available for the given matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_reduce_precision(cs_matrix_t  *matrix)
+{
+  if (matrix == NULL)
+    return false;
+
+  if (matrix->type != CS_MATRIX_MSR)
+    return false;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc->_x_val_f != NULL)
+    return true;
+
+  cs_matrix_vector_product_t  *spmv = NULL;
+
+  switch(matrix->fill_type) {
+  case CS_MATRIX_SCALAR:
+  case CS_MATRIX_SCALAR_SYM:
+    spmv = _mat_vec_p_l_msr_f;
+    break;
+  case CS_MATRIX_BLOCK_D:
+  case CS_MATRIX_BLOCK_D_66:
+  case CS_MATRIX_BLOCK_D_SYM:
+    spmv = _b_mat_vec_p_l_msr_f;
+    break;
+  default:
+    return false;
+  }
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t n_vals = ms->row_index[n_rows];
+
+  BFT_MALLOC(mc->_x_val_f, n_vals, float);
+
+  if (mc->x_val != NULL) {
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++)
+        mc->_x_val_f[jj] = mc->x_val[jj];
+    }
+  }
+  else {
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++)
+        mc->_x_val_f[jj] = 0.;
+    }
+  }
+
+  BFT_FREE(mc->_x_val);
+  mc->x_val = NULL;
+
+  matrix->vector_multiply[matrix->fill_type][0] = spmv;
+  matrix->vector_multiply[matrix->fill_type][1] = spmv;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether matrix extradiagonal coefficients are stored
+ *        in reduced (single) precision.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ *
+ * \return  true if coefficients use reduced precision storage,
+ *          false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_has_reduced_precision(const cs_matrix_t  *matrix)
+{
+  bool retval = false;
+
+  if (matrix->type == CS_MATRIX_MSR) {
+    const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+    if (mc != NULL && mc->_x_val_f != NULL)
+      retval = true;
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get matrix diagonal values.
@@ -6213,6 +7983,7 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       cs_matrix_coeff_msr_t *mc = matrix->coeffs;
       if (mc->d_val == NULL) {
@@ -6354,12 +8125,15 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       const cs_lnum_t _row_id = row_id / b_size;
       const cs_matrix_struct_csr_t  *ms = matrix->structure;
-      const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
-      const cs_lnum_t n_ed_cols =   ms->row_index[_row_id+1]
-                                  - ms->row_index[_row_id];
+      const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+      if (matrix->type == CS_MATRIX_SELL)
+        cs_matrix_sell_msr_x_val(matrix);
+      const cs_lnum_t r_s = ms->row_index[_row_id];
+      const cs_lnum_t n_ed_cols = ms->row_index[_row_id+1] - r_s;
       if (b_size == 1)
         r->row_size = n_ed_cols + 1;
       else if (matrix->eb_size[0] == 1)
@@ -6374,27 +8148,25 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
         r->vals = r->_vals;
       }
       cs_lnum_t ii = 0, jj = 0;
-      const cs_lnum_t *restrict c_id = ms->col_id + ms->row_index[_row_id];
+      const cs_lnum_t *restrict c_id = ms->col_id + r_s;
       if (b_size == 1) {
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           r->_col_id[ii] = c_id[jj];
-          r->_vals[ii++] = m_row[jj];
+          r->_vals[ii++] = _msr_x_val(mc, r_s + jj);
         }
         r->_col_id[ii] = _row_id;
         r->_vals[ii++] = mc->d_val[_row_id];
         for (; jj < n_ed_cols; jj++) {
           r->_col_id[ii] = c_id[jj];
-          r->_vals[ii++] = m_row[jj];
+          r->_vals[ii++] = _msr_x_val(mc, r_s + jj);
         }
       }
       else if (matrix->eb_size[0] == 1) {
         const cs_lnum_t _sub_id = row_id % b_size;
         const cs_lnum_t *db_size = matrix->db_size;
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           r->_col_id[ii] = c_id[jj]*b_size + _sub_id;
-          r->_vals[ii++] = m_row[jj];
+          r->_vals[ii++] = _msr_x_val(mc, r_s + jj);
         }
         for (cs_lnum_t kk = 0; kk < b_size; kk++) {
           r->_col_id[ii] = _row_id*b_size + kk;
@@ -6403,18 +8175,18 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
         }
         for (; jj < n_ed_cols; jj++) {
           r->_col_id[ii] = c_id[jj]*b_size + _sub_id;
-          r->_vals[ii++] = m_row[jj];
+          r->_vals[ii++] = _msr_x_val(mc, r_s + jj);
         }
       }
       else {
         const cs_lnum_t _sub_id = row_id % b_size;
         const cs_lnum_t *db_size = matrix->db_size;
-        const cs_lnum_t *eb_size = matrix->db_size;
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id]*eb_size[3];
+        const cs_lnum_t *eb_size = matrix->eb_size;
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           for (cs_lnum_t kk = 0; kk < b_size; kk++) {
             r->_col_id[ii] = c_id[jj]*b_size + kk;
-            r->_vals[ii++] = m_row[_sub_id*eb_size[2] + kk];
+            r->_vals[ii++] = _msr_x_val(mc,   (r_s + jj)*eb_size[3]
+                                            + _sub_id*eb_size[2] + kk);
           }
         }
         for (cs_lnum_t kk = 0; kk < b_size; kk++) {
@@ -6425,7 +8197,8 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
         for (; jj < n_ed_cols; jj++) {
           for (cs_lnum_t kk = 0; kk < b_size; kk++) {
             r->_col_id[ii] = c_id[jj]*b_size + kk;
-            r->_vals[ii++] = m_row[_sub_id*eb_size[2] + kk];
+            r->_vals[ii++] = _msr_x_val(mc,   (r_s + jj)*eb_size[3]
+                                            + _sub_id*eb_size[2] + kk);
           }
         }
       }
@@ -6540,12 +8313,64 @@ cs_matrix_get_csr_arrays(const cs_matrix_t   *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return row-based (MSR) extradiagonal values of a SELL matrix.
+ *
+ * Those values are rebuilt from the sliced coefficients if needed, and
+ * kept with the base MSR coefficients until the next assignment.
+ *
+ * parameters:
+ *   matrix <-- pointer to SELL matrix structure
+ *
+ * returns:
+ *   pointer to MSR extradiagonal values (NULL if not assigned)
+ *----------------------------------------------------------------------------*/
+
+const cs_real_t *
+cs_matrix_sell_msr_x_val(const cs_matrix_t  *matrix)
+{
+  assert(matrix->type == CS_MATRIX_SELL);
+
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+
+  if (mc == NULL || mc->msr.x_val != NULL || mc->val == NULL)
+    return (mc != NULL) ? mc->msr.x_val : NULL;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t  c_size = ms->chunk_size;
+  const cs_lnum_t  n_chunks = ms->n_chunks;
+  const cs_lnum_t  *row_index = ms->csr.row_index;
+
+  BFT_REALLOC(mc->msr._x_val, row_index[ms->csr.n_rows], cs_real_t);
+
+# pragma omp parallel for  if(n_chunks*c_size > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    const cs_lnum_t *r_id = ms->row_id + c_id*c_size;
+    const cs_real_t *c_val = mc->val + ms->chunk_index[c_id];
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      if (r_id[kk] > -1) {
+        cs_real_t *m_row = mc->msr._x_val + row_index[r_id[kk]];
+        const cs_lnum_t n_cols = row_index[r_id[kk]+1] - row_index[r_id[kk]];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          m_row[jj] = c_val[jj*c_size + kk];
+      }
+    }
+  }
+
+  mc->msr.x_val = mc->msr._x_val;
+  mc->msr.max_eb_size = 1;
+
+  return mc->msr.x_val;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get arrays describing a matrix in MSR format.
  *
- * This function only works for an MSR matrix (i.e. there is
- * no automatic conversion from another matrix type).
+ * This function only works for an MSR or SELL matrix (i.e. there is
+ * no automatic conversion from another matrix type). For a SELL matrix,
+ * row-based extradiagonal values are rebuilt from the sliced values
+ * on the first query following each assignment.
  *
  * Matrix block sizes can be obtained by cs_matrix_get_diag_block_size()
  * and cs_matrix_get_extra_diag_block_size().
@@ -6574,9 +8399,11 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
   if (x_val != NULL)
     *x_val = NULL;
 
-  if (matrix->type == CS_MATRIX_MSR) {
+  if (matrix->type == CS_MATRIX_MSR || matrix->type == CS_MATRIX_SELL) {
     const cs_matrix_struct_csr_t  *ms = matrix->structure;
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+    if (matrix->type == CS_MATRIX_SELL && x_val != NULL)
+      cs_matrix_sell_msr_x_val(matrix);
     if (row_index != NULL)
       *row_index = ms->row_index;
     if (col_id != NULL)
@@ -6584,8 +8411,14 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
     if (mc != NULL) {
       if (d_val != NULL)
         *d_val = mc->d_val;
-      if (x_val != NULL)
+      if (x_val != NULL) {
+        if (mc->_x_val_f != NULL)
+          bft_error
+            (__FILE__, __LINE__, 0,
+             _("%s: extradiagonal values are not available for a matrix\n"
+               "using reduced precision storage."), __func__);
         *x_val = mc->x_val;
+      }
     }
   }
   else
@@ -6596,6 +8429,48 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
        cs_matrix_type_name[matrix->type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether halo synchronization may be overlapped with
+ *        computation in matrix.vector products.
+ *
+ * \return  true if overlap is allowed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_get_halo_overlap(void)
+{
+  return _halo_overlap;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow or disallow overlap of halo synchronization with
+ *        computation in matrix.vector products.
+ *
+ * When allowed, matrix.vector products including a halo update of x
+ * start the exchange of ghost values, compute rows which do not reference
+ * ghost columns, and compute the remaining rows once the exchange is
+ * complete. Results are identical to those of the non-overlapped product.
+ * This is currently used for MSR matrices using the standard product
+ * variant only, other cases using a blocking synchronization.
+ *
+ * Overlap is disallowed by default.
+ *
+ * Disallowing overlap may be useful with MPI libraries which do not
+ * progress communication in the background.
+ *
+ * \param[in]  overlap  true to allow overlap, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_halo_overlap(bool  overlap)
+{
+  _halo_overlap = overlap;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x
@@ -6619,6 +8494,11 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
+  if (_vector_multiply_overlap_is_usable(rotation_mode, false, matrix)) {
+    _vector_multiply_overlap(false, matrix, x, y);
+    return;
+  }
+
   if (matrix->halo != NULL)
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
@@ -6690,6 +8570,11 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
+  if (_vector_multiply_overlap_is_usable(rotation_mode, true, matrix)) {
+    _vector_multiply_overlap(true, matrix, x, y);
+    return;
+  }
+
   if (matrix->halo != NULL)
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
@@ -7128,7 +9013,7 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
       vector_multiply = _b_mat_vec_p_l_native_fixed;
       break;
     case CS_MATRIX_BLOCK:
-      vector_multiply = _bb_mat_vec_p_l_native;
+      vector_multiply = _bb_mat_vec_p_l_native_fixed;
       break;
     default:
       vector_multiply = NULL;
@@ -7143,6 +9028,35 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
                  &n_variants_max,
                  m_variant);
 
+    /* Generic block variants, to compare with fixed block size ones */
+
+    vector_multiply = NULL;
+
+    if (_is_fixed_b_size(m->db_size)) {
+      switch(m->fill_type) {
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        vector_multiply = _b_mat_vec_p_l_native;
+        break;
+      case CS_MATRIX_BLOCK:
+        if (_is_fixed_b_size(m->eb_size) && m->eb_size[0] == m->db_size[0])
+          vector_multiply = _bb_mat_vec_p_l_native;
+        break;
+      default:
+        break;
+      }
+    }
+
+    _variant_add(_("native, generic block"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
     if (m->numbering != NULL) {
 
 #if defined(HAVE_OPENMP)
@@ -7335,6 +9249,31 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
                  &n_variants_max,
                  m_variant);
 
+    /* Generic block variant, to compare with fixed block size ones */
+
+    vector_multiply = NULL;
+
+    if (_is_fixed_b_size(m->db_size)) {
+      switch(m->fill_type) {
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        vector_multiply = _b_mat_vec_p_l_msr_generic;
+        break;
+      default:
+        break;
+      }
+    }
+
+    _variant_add(_("MSR, generic block"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
 #if defined(HAVE_MKL)
 
     switch(m->fill_type) {
@@ -7385,6 +9324,33 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
   }
 
+  if (m->type == CS_MATRIX_SELL) {
+
+    switch(m->fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      vector_multiply = _mat_vec_p_l_sell;
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+      vector_multiply = _b_mat_vec_p_l_sell;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("SELL"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_variant_t);
 }
@@ -7425,7 +9391,7 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
     return;
 
   for (int i = 0; i < 2; i++)
-    m->vector_multiply[m->fill_type][0] = mv->vector_multiply[0];
+    m->vector_multiply[m->fill_type][i] = mv->vector_multiply[i];
 }
 
 /*----------------------------------------------------------------------------*/
@@ -7441,6 +9407,8 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     omp             (for OpenMP with compatible numbering)
  *     omp_atomic      (for OpenMP with atomics)
  *     vector          (For vector machine with compatible numbering)
+ *     generic         (for block fill types, without fixed block size
+ *                      specializations)
  *
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     default
@@ -7457,6 +9425,12 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     standard
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
+ *     generic         (for block diagonal fill types, without fixed block
+ *                      size specializations)
+ *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
  *
  * parameters:
  *   mv        <-> Pointer to matrix variant
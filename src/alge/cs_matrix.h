@@ -59,6 +59,8 @@ typedef enum {
   CS_MATRIX_CSR_SYM,          /*!< Compressed Symmetric Sparse Row storage */
   CS_MATRIX_MSR,              /*!< Modified Compressed Sparse Row storage
                                 (separate diagonal) */
+  CS_MATRIX_SELL,             /*!< Sliced ELLPACK (SELL-C-sigma) storage
+                                (separate diagonal) */
 
   CS_MATRIX_N_BUILTIN_TYPES,  /*!< Number of known and built-in matrix types */
 
@@ -171,7 +173,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 /*----------------------------------------------------------------------------
  * Create a matrix structure based on a MSR connectivity definition.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * col_id is sorted row by row during the creation of this structure.
  *
@@ -246,7 +248,7 @@ cs_matrix_structure_create_msr_shared(bool                    have_diag,
 /*!
  * \brief Create a matrix structure using a matrix assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -289,7 +291,7 @@ cs_matrix_create(const cs_matrix_structure_t  *ms);
 /*!
  * \brief Create a matrix directly from assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -655,6 +657,47 @@ cs_matrix_is_symmetric(const cs_matrix_t  *matrix);
 bool
 cs_matrix_is_mapped_from_native(const cs_matrix_t  *matrix);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Switch matrix extradiagonal coefficients to single precision storage.
+ *
+ * This is currently only available for MSR matrices with scalar or
+ * block diagonal fill types. Diagonal coefficients are kept in double
+ * precision, and matrix-vector products are still accumulated in double
+ * precision, so only the extradiagonal coefficients (which represent
+ * most of the matrix memory traffic) are affected.
+ *
+ * Once converted, the matrix coefficients may not be reassigned, and
+ * extradiagonal values are not available through
+ * \ref cs_matrix_get_msr_arrays, so this should only be used for matrices
+ * which are accessed through matrix-vector products (for example,
+ * coarse multigrid levels).
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ *
+ * \return  true if coefficients were converted, false if this is not
+ *          available for the given matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_reduce_precision(cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether matrix extradiagonal coefficients are stored
+ *        in reduced (single) precision.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ *
+ * \return  true if coefficients use reduced precision storage,
+ *          false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_has_reduced_precision(const cs_matrix_t  *matrix);
+
 /*----------------------------------------------------------------------------
  * Get matrix diagonal values.
  *
@@ -822,6 +865,36 @@ void
 cs_matrix_apply_variant(cs_matrix_t                *m,
                         const cs_matrix_variant_t  *mv);
 
+/*----------------------------------------------------------------------------
+ * Indicate whether halo synchronization may be overlapped with
+ * computation in matrix.vector products.
+ *
+ * returns:
+ *   true if overlap is allowed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_get_halo_overlap(void);
+
+/*----------------------------------------------------------------------------
+ * Allow or disallow overlap of halo synchronization with computation
+ * in matrix.vector products.
+ *
+ * When allowed, matrix.vector products including a halo update of x
+ * start the exchange of ghost values, compute rows which do not reference
+ * ghost columns, and compute the remaining rows once the exchange is
+ * complete. This is currently used for MSR matrices using the standard
+ * product variant only, other cases using a blocking synchronization.
+ *
+ * Overlap is disallowed by default.
+ *
+ * parameters:
+ *   overlap <-- true to allow overlap, false otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_halo_overlap(bool  overlap);
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x
  *
@@ -1069,6 +1142,8 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     standard
  *     omp             (for OpenMP with compatible numbering)
  *     vector          (For vector machine with compatible numbering)
+ *     generic         (for block fill types, without fixed block size
+ *                      specializations)
  *
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     default
@@ -1085,6 +1160,12 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     standard
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
+ *     generic         (for block diagonal fill types, without fixed block
+ *                      size specializations)
+ *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
  *
  * parameters:
  *   mv        <-> pointer to matrix variant
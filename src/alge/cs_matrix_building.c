@@ -57,6 +57,7 @@
 #include "cs_gradient.h"
 #include "cs_gradient_perio.h"
 #include "cs_ext_neighborhood.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parameters.h"
 #include "cs_porous_model.h"
@@ -836,6 +837,11 @@ cs_matrix_scalar(const cs_mesh_t          *m,
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *restrict)m->b_face_cells;
 
+  /* Cell-based gather of interior face terms if available
+     (no face coloring required) */
+
+  const cs_adjacency_t *c2f = cs_mesh_adjacencies_gather_c2f(m);
+
   /*========================================================================== */
 
   /*==========================================================================
@@ -877,26 +883,50 @@ cs_matrix_scalar(const cs_mesh_t          *m,
 
     /* 3. Contribution of the extra-diagonal terms to the diagonal */
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-            face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-            face_id++) {
-
-          cs_lnum_t ii = i_face_cells[face_id][0];
-          cs_lnum_t jj = i_face_cells[face_id][1];
+    if (c2f != NULL) {
+
+#     pragma omp parallel for if(n_cells > CS_THR_MIN)
+      for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+        for (cs_lnum_t j = c2f->idx[cell_id]; j < c2f->idx[cell_id+1]; j++) {
+          cs_lnum_t face_id = c2f->ids[j];
+          if (face_id >= n_i_faces)
+            continue;
+          if (c2f->sgn[j] > 0)
+            da[cell_id] -=   xa[face_id][0]
+                           + iconvp*(1. - thetap)*i_massflux[face_id];
+          else
+            da[cell_id] -=   xa[face_id][1]
+                           - iconvp*(1. - thetap)*i_massflux[face_id];
+        }
+      }
 
-          /* D_ii =  theta (m_ij)^+ - m_ij
-           *      = -X_ij - (1-theta)*m_ij
-           * D_jj = -theta (m_ij)^- + m_ij
-           *      = -X_ji + (1-theta)*m_ij
-           */
-          da[ii] -= xa[face_id][0] + iconvp*(1. - thetap)*i_massflux[face_id];
-          da[jj] -= xa[face_id][1] - iconvp*(1. - thetap)*i_massflux[face_id];
+    }
+    else {
 
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+              face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+              face_id++) {
+
+            cs_lnum_t ii = i_face_cells[face_id][0];
+            cs_lnum_t jj = i_face_cells[face_id][1];
+
+            /* D_ii =  theta (m_ij)^+ - m_ij
+             *      = -X_ij - (1-theta)*m_ij
+             * D_jj = -theta (m_ij)^- + m_ij
+             *      = -X_ji + (1-theta)*m_ij
+             */
+            da[ii] -=   xa[face_id][0]
+                      + iconvp*(1. - thetap)*i_massflux[face_id];
+            da[jj] -=   xa[face_id][1]
+                      - iconvp*(1. - thetap)*i_massflux[face_id];
+
+          }
         }
       }
+
     }
 
     /* 4. Contribution of border faces to the diagonal */
@@ -947,28 +977,50 @@ cs_matrix_scalar(const cs_mesh_t          *m,
 
     /* 3. Contribution of the extra-diagonal terms to the diagonal */
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-            face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-            face_id++) {
-
-          cs_lnum_t ii = i_face_cells[face_id][0];
-          cs_lnum_t jj = i_face_cells[face_id][1];
+    if (c2f != NULL) {
+
+#     pragma omp parallel for if(n_cells > CS_THR_MIN)
+      for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+        for (cs_lnum_t j = c2f->idx[cell_id]; j < c2f->idx[cell_id+1]; j++) {
+          cs_lnum_t face_id = c2f->ids[j];
+          if (face_id >= n_i_faces)
+            continue;
+          if (c2f->sgn[j] > 0)
+            da[cell_id] -= xa[face_id][0]
+              + iconvp*(1. - thetap)*xcpp[cell_id]*i_massflux[face_id];
+          else
+            da[cell_id] -= xa[face_id][1]
+              - iconvp*(1. - thetap)*xcpp[cell_id]*i_massflux[face_id];
+        }
+      }
 
-          /* D_ii =  theta (m_ij)^+ - m_ij
-           *      = -X_ij - (1-theta)*m_ij
-           * D_jj = -theta (m_ij)^- + m_ij
-           *      = -X_ji + (1-theta)*m_ij
-           */
-          da[ii] -= xa[face_id][0]
-            + iconvp*(1. - thetap)*xcpp[ii]*i_massflux[face_id];
-          da[jj] -= xa[face_id][1]
-            - iconvp*(1. - thetap)*xcpp[jj]*i_massflux[face_id];
+    }
+    else {
 
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+              face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+              face_id++) {
+
+            cs_lnum_t ii = i_face_cells[face_id][0];
+            cs_lnum_t jj = i_face_cells[face_id][1];
+
+            /* D_ii =  theta (m_ij)^+ - m_ij
+             *      = -X_ij - (1-theta)*m_ij
+             * D_jj = -theta (m_ij)^- + m_ij
+             *      = -X_ji + (1-theta)*m_ij
+             */
+            da[ii] -= xa[face_id][0]
+              + iconvp*(1. - thetap)*xcpp[ii]*i_massflux[face_id];
+            da[jj] -= xa[face_id][1]
+              - iconvp*(1. - thetap)*xcpp[jj]*i_massflux[face_id];
+
+          }
         }
       }
+
     }
 
     /* 4. Contribution of boundary faces to the diagonal */
@@ -454,6 +454,8 @@ cs_matrix_finalize(void)
 {
   BFT_FREE(_global_row_id);
 
+  cs_matrix_tuning_set_cache_file(NULL);
+
   for (cs_matrix_type_t t = 0; t < CS_MATRIX_N_BUILTIN_TYPES; t++) {
     for (int i = 0; i < CS_MATRIX_N_FILL_TYPES; i++) {
       if (_matrix_variant_tuned[t][i] != NULL)
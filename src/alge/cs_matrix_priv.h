@@ -152,6 +152,11 @@ typedef struct _cs_matrix_struct_csr_t {
   cs_lnum_t        *_row_index;       /* Row index (0 to n-1), if owner */
   cs_lnum_t        *_col_id;          /* Column id (0 to n-1), if owner */
 
+  cs_lnum_t         n_halo_rows;      /* Number of rows referencing
+                                         ghost columns */
+  cs_lnum_t        *halo_row_id;      /* Ids of rows referencing ghost
+                                         columns (always owner) */
+
 } cs_matrix_struct_csr_t;
 
 /* CSR matrix coefficients representation */
@@ -233,8 +238,54 @@ typedef struct _cs_matrix_coeff_msr_t {
   cs_real_t        *_d_val;           /* Diagonal matrix coefficients */
   cs_real_t        *_x_val;           /* Extra-diagonal matrix coefficients */
 
+  /* Optional reduced precision storage (replaces x_val if present) */
+
+  float            *_x_val_f;         /* Extra-diagonal matrix coefficients,
+                                         single precision */
+
 } cs_matrix_coeff_msr_t;
 
+/* SELL-C-sigma (sliced ELLPACK) matrix structure representation */
+/*----------------------------------------------------------------*/
+
+/* Rows are grouped in chunks of chunk_size rows, after being sorted by
+   decreasing length inside windows of sigma rows. Entries of a given chunk
+   are stored column-major (i.e. entry j of each row of the chunk is
+   contiguous) and padded to the length of the longest row of the chunk. */
+
+typedef struct _cs_matrix_struct_sell_t {
+
+  cs_matrix_struct_csr_t  csr;        /* Base MSR structure, used for
+                                         coefficient assignment and queries
+                                         (must be first member) */
+
+  cs_lnum_t         chunk_size;       /* Number of rows per chunk */
+  cs_lnum_t         sigma;            /* Size of row sorting windows */
+  cs_lnum_t         n_chunks;         /* Number of chunks */
+
+  cs_lnum_t        *chunk_index;      /* Start of each chunk in sliced
+                                         arrays (size: n_chunks + 1) */
+  cs_lnum_t        *row_id;           /* Row id associated with each chunk
+                                         slot, or -1 for padding
+                                         (size: n_chunks*chunk_size) */
+  cs_lnum_t        *col_id;           /* Sliced column ids */
+
+} cs_matrix_struct_sell_t;
+
+/* SELL-C-sigma matrix coefficients representation */
+/*-------------------------------------------------*/
+
+typedef struct _cs_matrix_coeff_sell_t {
+
+  cs_matrix_coeff_msr_t  msr;         /* Base MSR coefficients; extradiagonal
+                                         values are only present during
+                                         assignment or if queried
+                                         (must be first member) */
+
+  cs_real_t        *val;              /* Sliced extra-diagonal coefficients */
+
+} cs_matrix_coeff_sell_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
@@ -398,6 +449,22 @@ cs_matrix_copy_diagonal_csr(const cs_matrix_t  *matrix,
 void
 cs_matrix_destroy_struct_csr(cs_matrix_struct_csr_t  **matrix);
 
+/*----------------------------------------------------------------------------
+ * Return row-based (MSR) extradiagonal values of a SELL matrix.
+ *
+ * Those values are rebuilt from the sliced coefficients if needed, and
+ * kept with the base MSR coefficients until the next assignment.
+ *
+ * parameters:
+ *   matrix <-- pointer to SELL matrix structure
+ *
+ * returns:
+ *   pointer to MSR extradiagonal values (NULL if not assigned)
+ *----------------------------------------------------------------------------*/
+
+const cs_real_t *
+cs_matrix_sell_msr_x_val(const cs_matrix_t  *matrix);
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with CSR matrix.
  *
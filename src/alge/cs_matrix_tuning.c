@@ -105,6 +105,11 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Maximum length of a tuning cache key or line */
+
+#define CS_MATRIX_TUNING_KEY_MAX  256
+#define CS_MATRIX_TUNING_LINE_MAX  384
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -116,10 +121,236 @@ BEGIN_C_DECLS
  *  Global variables
  *============================================================================*/
 
+/* Path to persistent tuning cache file, or NULL */
+
+static char  *_tuning_cache_path = NULL;
+static bool   _tuning_cache_env_checked = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return basic CPU description, used as part of the hardware signature
+ * for the tuning cache.
+ *
+ * parameters:
+ *   cpu_str     --> string with CPU description
+ *   cpu_str_max <-- maximum length of string with CPU description
+ *----------------------------------------------------------------------------*/
+
+static void
+_cpu_signature(char    *cpu_str,
+               size_t   cpu_str_max)
+{
+  strcpy(cpu_str, "unknown");
+
+#if defined(__linux__)
+
+  FILE *fp = fopen("/proc/cpuinfo", "r");
+
+  if (fp != NULL) {
+
+    char line[CS_MATRIX_TUNING_LINE_MAX];
+    char *s = fgets(line, CS_MATRIX_TUNING_LINE_MAX, fp);
+
+    while (s != NULL && strncmp(s, "model name", 10) != 0)
+      s = fgets(line, CS_MATRIX_TUNING_LINE_MAX, fp);
+
+    if (s != NULL) {
+      for ( ; *s != '\0' && *s != ':' ; s++);
+      if (*s == ':')
+        s++;
+      for ( ; *s != '\0' && *s == ' ' ; s++);
+      size_t l = strlen(s);
+      while (l > 0 && (s[l-1] == ' ' || s[l-1] == '\n' || s[l-1] == '\r'))
+        s[--l] = '\0';
+      for (size_t i = 0; i < l; i++) {  /* protect field separator */
+        if (s[i] == '|')
+          s[i] = ' ';
+      }
+      if (l > 0) {
+        strncpy(cpu_str, s, cpu_str_max - 1);
+        cpu_str[cpu_str_max - 1] = '\0';
+      }
+    }
+
+    fclose(fp);
+  }
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Build tuning cache key for a given matrix.
+ *
+ * The key is based on the matrix type, fill type, block sizes, global
+ * and maximum local sizes (which depend on the partitioning), number of
+ * ranks and threads, and a basic hardware signature.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   m   <-- associated matrix
+ *   key --> key string (size: CS_MATRIX_TUNING_KEY_MAX)
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_cache_key(const cs_matrix_t  *m,
+                  char                key[CS_MATRIX_TUNING_KEY_MAX])
+{
+  char cpu_str[128];
+
+  cs_gnum_t n_g_rows = cs_matrix_get_n_rows(m);
+  cs_gnum_t n_l_max = n_g_rows;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t n_l = n_g_rows;
+    MPI_Allreduce(&n_l, &n_g_rows, 1, CS_MPI_GNUM, MPI_SUM,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(&n_l, &n_l_max, 1, CS_MPI_GNUM, MPI_MAX,
+                  cs_glob_mpi_comm);
+  }
+
+#endif
+
+  _cpu_signature(cpu_str, 128);
+
+  snprintf(key, CS_MATRIX_TUNING_KEY_MAX,
+           "%s|%s|%d|%d|%llu|%llu|%d|%d|%s",
+           cs_matrix_type_name[m->type],
+           cs_matrix_fill_type_name[m->fill_type],
+           (int)(m->db_size[0]), (int)(m->eb_size[0]),
+           (unsigned long long)n_g_rows, (unsigned long long)n_l_max,
+           cs_glob_n_ranks, cs_glob_n_threads,
+           cpu_str);
+
+  key[CS_MATRIX_TUNING_KEY_MAX - 1] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Look for a previously selected variant in the tuning cache.
+ *
+ * The cache file is read on rank 0 only, and the result is broadcast.
+ * If several entries match, the last one is used.
+ *
+ * parameters:
+ *   key         <-- tuning cache key
+ *   n_variants  <-- number of variants
+ *   m_variant   <-- array of matrix variants
+ *   v_id        --> selected variant id for each operation, or -1
+ *
+ * returns:
+ *   true if an entry was found for both operations, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_tuning_cache_lookup(const char                 *key,
+                     int                         n_variants,
+                     const cs_matrix_variant_t  *m_variant,
+                     int                         v_id[2])
+{
+  v_id[0] = -1;
+  v_id[1] = -1;
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *fp = fopen(_tuning_cache_path, "r");
+
+    if (fp != NULL) {
+
+      char line[CS_MATRIX_TUNING_LINE_MAX];
+      size_t l_key = strlen(key);
+
+      while (fgets(line, CS_MATRIX_TUNING_LINE_MAX, fp) != NULL) {
+
+        if (line[0] == '#' || strncmp(line, key, l_key) != 0)
+          continue;
+        if (line[l_key] != '|')
+          continue;
+
+        /* Remaining fields: variant names for A.x and (A-D).x */
+
+        char *name[2];
+        name[0] = line + l_key + 1;
+        name[1] = strchr(name[0], '|');
+        if (name[1] == NULL)
+          continue;
+        *(name[1]) = '\0';
+        name[1] += 1;
+
+        size_t l = strlen(name[1]);
+        while (l > 0 && (name[1][l-1] == '\n' || name[1][l-1] == '\r'))
+          name[1][--l] = '\0';
+
+        for (int j = 0; j < 2; j++) {
+          v_id[j] = -1;
+          for (int i = 0; i < n_variants; i++) {
+            if (   m_variant[i].vector_multiply[j] != NULL
+                && strcmp(m_variant[i].name[j], name[j]) == 0) {
+              v_id[j] = i;
+              break;
+            }
+          }
+        }
+
+      }
+
+      fclose(fp);
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(v_id, 2, MPI_INT, 0, cs_glob_mpi_comm);
+
+#endif
+
+  return (v_id[0] > -1 && v_id[1] > -1) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Add selected variant to the tuning cache.
+ *
+ * Entries are appended (on rank 0 only) in a single write, so that
+ * concurrent jobs sharing a cache file do not interleave partial lines.
+ *
+ * parameters:
+ *   key  <-- tuning cache key
+ *   mv   <-- selected matrix variant
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_cache_store(const char                 *key,
+                    const cs_matrix_variant_t  *mv)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  FILE *fp = fopen(_tuning_cache_path, "a");
+
+  if (fp == NULL) {
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Unable to open SpMV tuning cache file \"%s\" "
+                    "for writing.\n"),
+                  _tuning_cache_path);
+    return;
+  }
+
+  char line[CS_MATRIX_TUNING_LINE_MAX];
+  snprintf(line, CS_MATRIX_TUNING_LINE_MAX, "%s|%s|%s\n",
+           key, mv->name[0], mv->name[1]);
+  line[CS_MATRIX_TUNING_LINE_MAX - 1] = '\0';
+
+  fputs(line, fp);
+  fclose(fp);
+}
+
 /*----------------------------------------------------------------------------
  * Tune local matrix.vector product operations.
  *
@@ -340,6 +571,44 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
 
   cs_matrix_variant_build_list(m, &n_variants, &m_variant);
 
+  const char *cache_path = cs_matrix_tuning_get_cache_file();
+
+  char cache_key[CS_MATRIX_TUNING_KEY_MAX];
+  int  cache_v_id[2] = {-1, -1};
+
+  if (n_variants > 1 && cache_path != NULL) {
+
+    _tuning_cache_key(m, cache_key);
+
+    if (_tuning_cache_lookup(cache_key, n_variants, m_variant, cache_v_id)) {
+
+      for (int j = 0; j < 2; j++) {
+        const cs_matrix_variant_t *mv_s = m_variant + cache_v_id[j];
+        if (cache_v_id[j] > 0) {
+          strcpy(m_variant->name[j], mv_s->name[j]);
+          m_variant->vector_multiply[j] = mv_s->vector_multiply[j];
+        }
+      }
+
+      if (verbosity > 0)
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("\n"
+                        "SpMV variant for matrix of type %s and fill %s\n"
+                        "read from tuning cache \"%s\":\n"
+                        "  %32s for y <= A.x\n"
+                        "  %32s for y <= (A-D).x\n"),
+                      _(cs_matrix_type_name[m->type]),
+                      _(cs_matrix_fill_type_name[m->fill_type]),
+                      cache_path,
+                      m_variant[0].name[0], m_variant[0].name[1]);
+
+      n_variants = 1;
+      BFT_REALLOC(m_variant, 1, cs_matrix_variant_t);
+
+    }
+
+  }
+
   if (n_variants > 1) {
 
     if (verbosity > 0)
@@ -368,6 +637,9 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
 
     BFT_FREE(spmv_cost);
 
+    if (cache_path != NULL)
+      _tuning_cache_store(cache_key, m_variant);
+
     cs_log_printf(CS_LOG_PERFORMANCE, "\n");
     cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -379,6 +651,55 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
   return m_variant;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a persistent cache file for matrix tuning results.
+ *
+ * When a cache file is defined, the variant selected by
+ * \ref cs_matrix_variant_tuned for a given matrix type, fill type,
+ * block size, global and local sizes, number of ranks and threads, and
+ * processor model is appended to that file. Later runs with matching
+ * characteristics reuse that selection instead of measuring again.
+ *
+ * If this function is not called, the CS_MATRIX_TUNING_CACHE environment
+ * variable, if defined, is used as the cache file path.
+ *
+ * \param[in]  path  path to cache file, or NULL to disable the cache
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuning_set_cache_file(const char  *path)
+{
+  _tuning_cache_env_checked = true;
+
+  BFT_FREE(_tuning_cache_path);
+
+  if (path != NULL) {
+    if (strlen(path) > 0) {
+      BFT_MALLOC(_tuning_cache_path, strlen(path) + 1, char);
+      strcpy(_tuning_cache_path, path);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the path to the persistent matrix tuning cache file.
+ *
+ * \return  path to cache file, or NULL if no cache is used
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_matrix_tuning_get_cache_file(void)
+{
+  if (_tuning_cache_env_checked == false)
+    cs_matrix_tuning_set_cache_file(getenv("CS_MATRIX_TUNING_CACHE"));
+
+  return _tuning_cache_path;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
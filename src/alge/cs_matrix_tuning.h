@@ -78,6 +78,37 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
                         int                 n_measure,
                         double              t_measure);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a persistent cache file for matrix tuning results.
+ *
+ * When a cache file is defined, the variant selected by
+ * \ref cs_matrix_variant_tuned for a given matrix type, fill type,
+ * block size, global and local sizes, number of ranks and threads, and
+ * processor model is appended to that file. Later runs with matching
+ * characteristics reuse that selection instead of measuring again.
+ *
+ * If this function is not called, the CS_MATRIX_TUNING_CACHE environment
+ * variable, if defined, is used as the cache file path.
+ *
+ * \param[in]  path  path to cache file, or NULL to disable the cache
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuning_set_cache_file(const char  *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the path to the persistent matrix tuning cache file.
+ *
+ * \return  path to cache file, or NULL if no cache is used
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_matrix_tuning_get_cache_file(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
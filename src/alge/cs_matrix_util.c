@@ -589,6 +589,20 @@ _diag_dom_msr(const cs_matrix_t  *matrix,
 
   }
 
+  else if (mc->_x_val_f != NULL) {
+
+#   pragma omp parallel for private(jj, n_cols, sii)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float *restrict m_row_f = mc->_x_val_f + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      sii = 0.0;
+      for (jj = 0; jj < n_cols; jj++)
+        sii -= fabs(m_row_f[jj]);
+      dd[ii] += sii;
+    }
+
+  }
+
   _diag_dom_diag_normalize(mc->d_val, dd, n_rows);
 }
 
@@ -632,6 +646,20 @@ _b_diag_dom_msr(const cs_matrix_t  *matrix,
 
   }
 
+  else if (mc->_x_val_f != NULL) {
+
+#   pragma omp parallel for private(jj, kk, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float *restrict m_row_f = mc->_x_val_f + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        for (kk = 0; kk < db_size[0]; kk++)
+          dd[ii*db_size[1] + kk] -= fabs(m_row_f[jj]);
+      }
+    }
+
+  }
+
   _b_diag_dom_diag_normalize(mc->d_val, dd, ms->n_rows, db_size);
 }
 
@@ -1128,6 +1156,20 @@ _pre_dump_msr(const cs_matrix_t   *matrix,
       }
     }
   }
+  else if (mc->_x_val_f != NULL) {
+#   pragma omp parallel for private(jj, dump_id, col_id, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float *restrict m_row_f = mc->_x_val_f + ms->row_index[ii];
+      col_id = ms->col_id + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        dump_id = ms->row_index[ii] + jj + ms->n_rows;
+        _m_coo[dump_id*2] = g_coo_num[ii];
+        _m_coo[dump_id*2+1] = g_coo_num[col_id[jj]];
+        _m_val[dump_id] = m_row_f[jj];
+      }
+    }
+  }
   else {
 #   pragma omp parallel for private(jj, dump_id, col_id, n_cols)
     for (ii = 0; ii < n_rows; ii++) {
@@ -1212,6 +1254,22 @@ _b_pre_dump_msr(const cs_matrix_t   *matrix,
       }
     }
   }
+  else if (mc->_x_val_f != NULL) {
+#   pragma omp parallel for private(jj, kk, dump_id, col_id, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float *restrict m_row_f = mc->_x_val_f + ms->row_index[ii];
+      col_id = ms->col_id + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        for (kk = 0; kk < db_size[0]; kk++) {
+          dump_id = (ms->row_index[ii] + jj)*db_size[0] + kk + dump_id_shift;
+          _m_coo[dump_id*2] = g_coo_num[ii]*db_size[0] + kk;
+          _m_coo[dump_id*2+1] = g_coo_num[col_id[jj]]*db_size[0] + kk;
+          _m_val[dump_id] = m_row_f[jj];
+        }
+      }
+    }
+  }
   else {
 #   pragma omp parallel for private(jj, kk, dump_id, col_id, n_cols)
     for (ii = 0; ii < n_rows; ii++) {
@@ -1372,6 +1430,9 @@ _prepare_matrix_dump_data(const cs_matrix_t   *m,
     _n_entries = _pre_dump_csr_sym(m, g_coo_num, &_m_coords, &_m_vals);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+    if (m->type == CS_MATRIX_SELL)  /* base coefficients in MSR form */
+      cs_matrix_sell_msr_x_val(m);
     if (m->db_size[3] == 1)
       _n_entries = _pre_dump_msr(m, g_coo_num, &_m_coords, &_m_vals);
     else
@@ -1876,7 +1937,29 @@ _frobenius_norm(const cs_matrix_t  *m)
       cs_lnum_t n_vals = ms->row_index[m->n_rows];
       double d_mult = (m->eb_size[3] == 1) ? m->db_size[0] : 1;
       retval = cs_dot_xx(d_stride*m->n_rows, mc->d_val);
-      retval += d_mult * cs_dot_xx(e_stride*n_vals, mc->x_val);
+      if (mc->_x_val_f != NULL) {
+        const float *x_val_f = mc->_x_val_f;
+        double s = 0;
+#       pragma omp parallel for reduction(+:s) if(n_vals > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < e_stride*n_vals; ii++)
+          s += (double)x_val_f[ii] * (double)x_val_f[ii];
+        retval += d_mult * s;
+      }
+      else if (mc->x_val != NULL)
+        retval += d_mult * cs_dot_xx(e_stride*n_vals, mc->x_val);
+      cs_parall_sum(1, CS_DOUBLE, &retval);
+    }
+    break;
+
+  case CS_MATRIX_SELL:
+    if (   (m->eb_size[3] == 1)
+        && (m->db_size[0]*m->db_size[0] == m->db_size[3])) {
+      cs_lnum_t  d_stride = m->db_size[3];
+      const cs_matrix_struct_sell_t  *ms = m->structure;
+      const cs_matrix_coeff_sell_t  *mc = m->coeffs;
+      cs_lnum_t n_vals = ms->chunk_index[ms->n_chunks]; /* padding is zero */
+      retval = cs_dot_xx(d_stride*m->n_rows, mc->msr.d_val);
+      retval += m->db_size[0] * cs_dot_xx(n_vals, mc->val);
       cs_parall_sum(1, CS_DOUBLE, &retval);
     }
     break;
@@ -1929,12 +2012,14 @@ cs_matrix_diag_dominance(const cs_matrix_t  *matrix,
     _diag_dom_csr_sym(matrix, dd);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+    if (matrix->type == CS_MATRIX_SELL)  /* base coefficients in MSR form */
+      cs_matrix_sell_msr_x_val(matrix);
     if (matrix->db_size[3] == 1)
       _diag_dom_msr(matrix, dd);
     else
       _b_diag_dom_msr(matrix, dd);
     break;
-    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Extraction of diagonal dominance of matrixes in %s format\n"
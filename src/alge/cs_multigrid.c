@@ -279,6 +279,10 @@ struct _cs_multigrid_t {
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
 
+  int        rp_level_min;       /* First level using reduced (single)
+                                    precision matrix coefficients,
+                                    or -1 if not used */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -323,6 +327,8 @@ struct _cs_multigrid_t {
   cs_gnum_t merge_glob_threshold;
 
   int      merge_stride;
+  double   merge_comm_ratio;   /* if > 0, target communication/computation
+                                  time ratio for adaptive merging */
   int      caller_n_ranks;
 
   /* Data available between "setup" and "solve" states */
@@ -486,8 +492,18 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                   mg->merge_stride,
                   (int)(mg->merge_mean_threshold),
                   (unsigned long long)(mg->merge_glob_threshold));
+  if (cs_glob_n_ranks > 1 && mg->merge_comm_ratio > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("    adaptive merge, target comm/comp: %g\n"),
+                  mg->merge_comm_ratio);
 #endif
 
+  if (mg->rp_level_min > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Single precision coarse matrices:\n"
+                    "    starting at level:               %d\n"),
+                  mg->rp_level_min);
+
   cs_log_printf(CS_LOG_SETUP,
                 _("  Cycle type:                        %s\n"),
                 _(cs_multigrid_type_name[mg->type]));
@@ -1608,6 +1624,7 @@ _multigrid_create_k_cycle_bottom(cs_multigrid_t  *parent)
   mg->merge_mean_threshold = 0;
   mg->merge_glob_threshold = 1;
   mg->merge_stride = _k_cycle_hpc_merge_stride;
+  mg->merge_comm_ratio = 0;
 #endif
 
 #if defined(HAVE_MPI)
@@ -1844,6 +1861,83 @@ _multigrid_setup_sles_k_cycle_bottom(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a smoother or solver type may be used with matrices using
+ * reduced precision coefficient storage.
+ *
+ * Gauss-Seidel type smoothers require direct access to the matrix
+ * coefficients, so are not compatible with this storage.
+ *
+ * parameters:
+ *   type <-- smoother or solver type
+ *
+ * returns:
+ *   true if compatible, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_reduced_precision_compatible(cs_sles_it_type_t  type)
+{
+  bool retval = true;
+
+  switch(type) {
+  case CS_SLES_P_GAUSS_SEIDEL:
+  case CS_SLES_P_SYM_GAUSS_SEIDEL:
+  case CS_SLES_TS_F_GAUSS_SEIDEL:
+  case CS_SLES_TS_B_GAUSS_SEIDEL:
+    retval = false;
+    break;
+  default:
+    break;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Switch coarse grid matrices to reduced precision coefficient storage.
+ *
+ * The finest level matrix is never modified, so that the outer
+ * iterative solver (or the multigrid cycle itself) acts as a defect
+ * correction loop in full precision; only the levels using compatible
+ * smoothers and solvers are converted.
+ *
+ * parameters:
+ *   mg        <-> pointer to multigrid structure
+ *   verbosity <-- verbosity level
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_reduce_precision(cs_multigrid_t  *mg,
+                            int              verbosity)
+{
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  unsigned n_levels = mgd->n_levels;
+  unsigned n_reduced = 0;
+
+  bool smoother_ok =    _reduced_precision_compatible(mg->info.type[0])
+                     && _reduced_precision_compatible(mg->info.type[1]);
+
+  /* Coarse solver preconditioned by a sub-multigrid needs to coarsen
+     the coarsest matrix, so it requires full precision */
+
+  bool coarse_ok =    _reduced_precision_compatible(mg->info.type[2])
+                   && mg->lv_mg[2] == NULL;
+
+  for (unsigned i = CS_MAX(mg->rp_level_min, 1); i < n_levels; i++) {
+    bool ok = (i < n_levels - 1) ? smoother_ok : coarse_ok;
+    if (ok) {
+      if (cs_grid_reduce_matrix_precision(mgd->grid_hierarchy[i]))
+        n_reduced++;
+    }
+  }
+
+  if (verbosity > 1 && n_reduced > 0)
+    bft_printf(_("   single precision coarse matrices: %u levels\n"),
+               n_reduced);
+}
+
 /*----------------------------------------------------------------------------
  * Setup multigrid sparse linear equation solvers on existing hierarchy.
  *
@@ -2112,6 +2206,7 @@ _setup_hierarchy(void             *context,
                           mg->merge_stride,
                           mg->merge_mean_threshold,
                           mg->merge_glob_threshold,
+                          mg->merge_comm_ratio,
                           mg->p0p1_relax);
 
     bool symmetric = true;
@@ -2310,6 +2405,11 @@ _setup_hierarchy(void             *context,
   for (unsigned i = 0; i < mg->setup_data->n_levels; i++)
     cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
 
+  /* Switch to reduced precision for coarse levels if requested */
+
+  if (mg->rp_level_min > 0)
+    _multigrid_reduce_precision(mg, verbosity);
+
   /* Setup solvers */
 
   if (mg->subtype == CS_MULTIGRID_BOTTOM)
@@ -3801,6 +3901,7 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->merge_mean_threshold = 300;
   mg->merge_glob_threshold = 500;
   mg->merge_stride = 1;
+  mg->merge_comm_ratio = 0;
 #endif
 
   mg->aggregation_limit = 3;
@@ -3813,6 +3914,8 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
 
+  mg->rp_level_min = -1;
+
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
     mg->lv_mg[i] = NULL;
@@ -4840,6 +4943,70 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid parameters for adaptive parallel grid merging.
+ *
+ * When enabled, the halo exchange and local matrix.vector product times
+ * are measured on each coarse grid during setup, and the merge stride
+ * for that level is chosen so that their expected ratio is below the
+ * given target. The rank stride defined by
+ * \ref cs_multigrid_set_merge_options is then used as the maximum stride
+ * per level, and row count thresholds are ignored.
+ *
+ * \param[in, out]  mg          pointer to multigrid info and context
+ * \param[in]       comm_ratio  target ratio of communication to
+ *                              computation time, or 0 to use row count
+ *                              thresholds (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_merge_adaptive(cs_multigrid_t  *mg,
+                                double           comm_ratio)
+{
+#if defined(HAVE_MPI)
+  mg->merge_comm_ratio = (comm_ratio > 0) ? comm_ratio : 0;
+#else
+  CS_UNUSED(mg);
+  CS_UNUSED(comm_ratio);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid parameters for reduced (single) precision storage
+ *        of coarse grid matrices.
+ *
+ * Coarse grid matrices from the given level on use single precision
+ * extra-diagonal coefficients, while vectors, diagonal coefficients and
+ * accumulations remain in double precision. The finest grid matrix is
+ * never modified, so the outer iterative solver acts as a defect
+ * correction loop and the final precision is not affected.
+ *
+ * Levels using Gauss-Seidel type smoothers, or a coarse solver
+ * preconditioned by a sub-multigrid, are left in full precision.
+ *
+ * \param[in, out]  mg         pointer to multigrid info and context
+ * \param[in]       level_min  first grid level using reduced precision
+ *                             (> 0), or -1 to use full precision on all
+ *                             levels
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reduced_precision(cs_multigrid_t  *mg,
+                                   int              level_min)
+{
+  if (mg == NULL)
+    return;
+
+  if (level_min == 0)
+    level_min = 1;
+
+  mg->rp_level_min = level_min;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
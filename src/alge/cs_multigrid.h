@@ -443,6 +443,53 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
                                int              rows_mean_threshold,
                                cs_gnum_t        rows_glob_threshold);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid parameters for adaptive parallel grid merging.
+ *
+ * When enabled, the halo exchange and local matrix.vector product times
+ * are measured on each coarse grid during setup, and the merge stride
+ * for that level is chosen so that their expected ratio is below the
+ * given target. The rank stride defined by
+ * \ref cs_multigrid_set_merge_options is then used as the maximum stride
+ * per level, and row count thresholds are ignored.
+ *
+ * \param[in, out]  mg          pointer to multigrid info and context
+ * \param[in]       comm_ratio  target ratio of communication to
+ *                              computation time, or 0 to use row count
+ *                              thresholds (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_merge_adaptive(cs_multigrid_t  *mg,
+                                double           comm_ratio);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid parameters for reduced (single) precision storage
+ *        of coarse grid matrices.
+ *
+ * Coarse grid matrices from the given level on use single precision
+ * extra-diagonal coefficients, while vectors, diagonal coefficients and
+ * accumulations remain in double precision. The finest grid matrix is
+ * never modified, so the outer iterative solver acts as a defect
+ * correction loop and the final precision is not affected.
+ *
+ * Levels using Gauss-Seidel type smoothers, or a coarse solver
+ * preconditioned by a sub-multigrid, are left in full precision.
+ *
+ * \param[in, out]  mg         pointer to multigrid info and context
+ * \param[in]       level_min  first grid level using reduced precision
+ *                             (> 0), or -1 to use full precision on all
+ *                             levels
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reduced_precision(cs_multigrid_t  *mg,
+                                   int              level_min);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
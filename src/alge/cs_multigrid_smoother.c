@@ -87,6 +87,10 @@ BEGIN_C_DECLS
 
 #define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
 
+/* Number of Lanczos iterations for Chebyshev smoother eigenvalue estimation */
+
+#define CS_CHEBYSHEV_N_LANCZOS 10
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -101,6 +105,13 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Chebyshev smoother eigenvalue bounds estimation settings */
+
+static double _chebyshev_upper_factor = 1.1;  /* safety factor on estimated
+                                                 largest eigenvalue */
+static double _chebyshev_lower_ratio = 1./30; /* lower bound to upper bound
+                                                 ratio */
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1771,6 +1782,337 @@ _p_gauss_seidel(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the largest eigenvalue of a symmetric tridiagonal matrix
+ * using Sturm sequence bisection.
+ *
+ * parameters:
+ *   n <-- matrix size
+ *   d <-- diagonal values
+ *   e <-- off-diagonal values (size n-1)
+ *
+ * returns:
+ *   largest eigenvalue
+ *----------------------------------------------------------------------------*/
+
+static double
+_tridiag_max_eigenvalue(int            n,
+                        const double   d[],
+                        const double   e[])
+{
+  /* Gershgorin bounds */
+
+  double l_min = d[0], l_max = d[0];
+
+  for (int i = 0; i < n; i++) {
+    double r = 0;
+    if (i > 0)
+      r += fabs(e[i-1]);
+    if (i < n-1)
+      r += fabs(e[i]);
+    l_min = CS_MIN(l_min, d[i] - r);
+    l_max = CS_MAX(l_max, d[i] + r);
+  }
+
+  /* Bisection on the number of eigenvalues lower than l */
+
+  for (int k = 0; k < 100 && l_max - l_min > 1e-10*fabs(l_max); k++) {
+
+    double l = 0.5*(l_min + l_max);
+    int n_lower = 0;
+    double q = 1;
+
+    for (int i = 0; i < n; i++) {
+      q = d[i] - l - ((i > 0) ? e[i-1]*e[i-1]/q : 0);
+      if (fabs(q) < 1e-300)
+        q = -1e-300;
+      if (q < 0)
+        n_lower++;
+    }
+
+    if (n_lower < n)
+      l_min = l;
+    else
+      l_max = l;
+
+  }
+
+  return l_max;
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate eigenvalue bounds of D^-1.A for the Chebyshev smoother.
+ *
+ * The largest eigenvalue is estimated from the Lanczos tridiagonal
+ * matrix built from a few Jacobi-preconditioned conjugate gradient
+ * iterations, and enlarged by a safety factor; the lower bound is
+ * then chosen as a fixed fraction of the upper bound, so that the
+ * smoother targets the upper part of the spectrum only.
+ *
+ * Reductions are required here, but only once per setup.
+ *
+ * parameters:
+ *   c               <-> pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   verbosity       <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_chebyshev_setup(cs_sles_it_t       *c,
+                 const cs_matrix_t  *a,
+                 cs_lnum_t           diag_block_size,
+                 int                 verbosity)
+{
+  cs_sles_it_setup_t  *sd = c->setup_data;
+
+  double eig_max = 0;
+
+#if defined(HAVE_MPI)
+  if (c->caller_n_ranks < 2 || c->comm != MPI_COMM_NULL) {
+#endif
+
+    const cs_lnum_t n_rows = sd->n_rows;
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
+    const cs_lnum_t n_blocks = n_rows / diag_block_size;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    const cs_real_t  *restrict ad_inv = sd->ad_inv;
+
+    cs_real_t *_aux_vectors, *restrict rk, *restrict zk, *restrict pk;
+    cs_real_t *restrict qk;
+    BFT_MALLOC(_aux_vectors, wa_size*4, cs_real_t);
+    rk = _aux_vectors;
+    zk = _aux_vectors + wa_size;
+    pk = _aux_vectors + wa_size*2;
+    qk = _aux_vectors + wa_size*3;
+
+    double t_d[CS_CHEBYSHEV_N_LANCZOS], t_e[CS_CHEBYSHEV_N_LANCZOS];
+    double alpha_p = 0, beta = 0, rk_zk_p = 0;
+    int n_t = 0;
+
+    /* Deterministic oscillating right-hand side, so as to have
+       significant components along high-frequency eigenvectors */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] = 1.0 + 0.25*(ii%7) - 1.5*(ii%2);
+
+    for (int k = 0; k < CS_CHEBYSHEV_N_LANCZOS; k++) {
+
+      /* zk <- D^-1.rk */
+
+      if (diag_block_size == 1) {
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+          zk[ii] = rk[ii] * ad_inv[ii];
+      }
+      else {
+        const cs_real_t zero[DB_SIZE_MAX] = {0};
+#       pragma omp parallel for if(n_blocks > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_blocks; ii++)
+          _fw_and_bw_lu(ad_inv + db_size[3]*ii,
+                        db_size[0],
+                        zk + db_size[1]*ii,
+                        zero,
+                        rk + db_size[1]*ii);
+      }
+
+      double rk_zk = _dot_product(c, rk, zk);
+
+      if (!(rk_zk > 0))
+        break;
+
+      if (k > 0) {
+        beta = rk_zk / rk_zk_p;
+        t_e[n_t - 1] = sqrt(beta) / alpha_p;
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+          pk[ii] = zk[ii] + beta*pk[ii];
+      }
+      else
+        memcpy(pk, zk, n_rows*sizeof(cs_real_t));
+
+      cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a, pk, qk);
+
+      double pk_qk = _dot_product(c, pk, qk);
+      if (!(pk_qk > 0))
+        break;
+
+      double alpha = rk_zk / pk_qk;
+
+      t_d[n_t] = 1.0/alpha + ((k > 0) ? beta/alpha_p : 0);
+      n_t++;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        rk[ii] -= alpha*qk[ii];
+
+      alpha_p = alpha;
+      rk_zk_p = rk_zk;
+
+    }
+
+    BFT_FREE(_aux_vectors);
+
+    if (n_t > 0)
+      eig_max = _tridiag_max_eigenvalue(n_t, t_d, t_e);
+
+#if defined(HAVE_MPI)
+  }
+  if (c->comm != c->caller_comm)
+    MPI_Bcast(&eig_max, 1, MPI_DOUBLE, 0, cs_glob_mpi_comm);
+#endif
+
+  /* For a diagonally dominant matrix, eigenvalues of D^-1.A lie in ]0, 2] */
+
+  if (eig_max <= 0)
+    eig_max = 2.0;
+
+  sd->eig_bounds[1] = _chebyshev_upper_factor * eig_max;
+  sd->eig_bounds[0] = _chebyshev_lower_ratio * sd->eig_bounds[1];
+
+  if (verbosity > 1)
+    bft_printf(_("  Chebyshev smoother eigenvalue bounds: [%12.5e, %12.5e]\n"),
+               sd->eig_bounds[0], sd->eig_bounds[1]);
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using a Jacobi-preconditioned Chebyshev
+ * polynomial smoother.
+ *
+ * The eigenvalue bounds are estimated at setup, so this smoother
+ * requires no inner products: each iteration consists of one matrix-vector
+ * product and element-wise vector updates only.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_chebyshev(cs_sles_it_t              *c,
+           const cs_matrix_t         *a,
+           cs_lnum_t                  diag_block_size,
+           cs_halo_rotation_t         rotation_mode,
+           cs_sles_it_convergence_t  *convergence,
+           const cs_real_t           *rhs,
+           cs_real_t                 *restrict vx,
+           size_t                     aux_size,
+           void                      *aux_vectors)
+{
+  cs_real_t *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict dk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_blocks = c->setup_data->n_rows / diag_block_size;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 2;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+  }
+
+  /* Chebyshev recurrence coefficients */
+
+  const double *eig_bounds = c->setup_data->eig_bounds;
+  const double theta = 0.5*(eig_bounds[1] + eig_bounds[0]);
+  const double delta = 0.5*(eig_bounds[1] - eig_bounds[0]);
+  const double sigma = theta / delta;
+
+  double rho = 1.0 / sigma;
+
+  /* Work arrays are not initialized, and c0.dk must be 0 at the first
+     iteration (even if dk contains non-finite values) */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    dk[ii] = 0;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 0; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    /* dk <- c0.dk + c1.D^-1.(rhs - A.vx); vx <- vx + dk */
+
+    double c0 = 0, c1 = 1.0/theta;
+
+    if (n_iter > 0) {
+      double rho_n = 1.0 / (2.0*sigma - rho);
+      c0 = rho_n * rho;
+      c1 = 2.0 * rho_n / delta;
+      rho = rho_n;
+    }
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+    if (diag_block_size == 1) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        dk[ii] = c0*dk[ii] + c1*(rhs[ii] - rk[ii])*ad_inv[ii];
+        vx[ii] += dk[ii];
+      }
+    }
+    else {
+#     pragma omp parallel for if(n_blocks > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_blocks; ii++) {
+        cs_real_t zk[DB_SIZE_MAX];
+        _fw_and_bw_lu(ad_inv + db_size[3]*ii,
+                      db_size[0],
+                      zk,
+                      rk + db_size[1]*ii,
+                      rhs + db_size[1]*ii);
+        for (cs_lnum_t jj = 0; jj < db_size[0]; jj++) {
+          cs_lnum_t kk = db_size[1]*ii + jj;
+          dk[kk] = c0*dk[kk] + c1*zk[jj];
+          vx[kk] += dk[kk];
+        }
+      }
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1818,6 +2160,7 @@ cs_multigrid_smoother_create(cs_sles_it_type_t    smoother_type,
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
   case CS_SLES_TS_F_GAUSS_SEIDEL:
   case CS_SLES_TS_B_GAUSS_SEIDEL:
+  case CS_SLES_CHEBYSHEV:
     break;
 
   case CS_SLES_PCG:
@@ -1902,7 +2245,7 @@ cs_multigrid_smoother_setup(void               *context,
     cs_matrix_log_info(a, verbosity);
   }
 
-  if (c->type == CS_SLES_JACOBI)
+  if (c->type == CS_SLES_JACOBI || c->type == CS_SLES_CHEBYSHEV)
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, true);
 
   else if (   c->type == CS_SLES_P_GAUSS_SEIDEL
@@ -1985,6 +2328,11 @@ cs_multigrid_smoother_setup(void               *context,
     c->solve = _ts_b_gauss_seidel_msr;
     break;
 
+  case CS_SLES_CHEBYSHEV:
+    _chebyshev_setup(c, a, diag_block_size, verbosity);
+    c->solve = _chebyshev;
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -131,9 +131,12 @@ const char *cs_sles_it_type_name[]
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
+     N_("Pipelined Conjugate Gradient"),
+     N_("Pipelined BiCGstab"),
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
+     N_("Chebyshev"),
 };
 
 /*=============================================================================
@@ -243,6 +246,48 @@ _convergence_test(cs_sles_it_t              *c,
   return CS_SLES_ITERATING;
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Start non-blocking global sum of local partial dot products.
+ *
+ * The result is available in s only after a call to _sum_wait().
+ *
+ * parameters:
+ *   c       <-- pointer to solver context info
+ *   n       <-- number of values to sum
+ *   s       <-> local partial sums in, global sums out
+ *   request --> associated MPI request
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_start(const cs_sles_it_t  *c,
+           int                  n,
+           double               s[],
+           MPI_Request         *request)
+{
+  *request = MPI_REQUEST_NULL;
+
+  if (c->comm != MPI_COMM_NULL)
+    MPI_Iallreduce(MPI_IN_PLACE, s, n, MPI_DOUBLE, MPI_SUM, c->comm,
+                   request);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete non-blocking global sum started with _sum_start().
+ *
+ * parameters:
+ *   request <-> associated MPI request
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_wait(MPI_Request  *request)
+{
+  MPI_Wait(request, MPI_STATUS_IGNORE);
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned conjugate gradient.
  *
@@ -1997,6 +2042,188 @@ _breakdown(cs_sles_it_t                 *c,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant, described in \cite Ghysels:2014, requires a single global
+ * reduction per iteration, which is overlapped with the application
+ * of the preconditioner and the matrix.vector product. The preconditioner
+ * must be symmetric and constant. Compared to standard PCG, this requires
+ * additional vector updates, and the preconditioner and matrix.vector
+ * product are also applied at the last iteration.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              cs_lnum_t                  diag_block_size,
+                              cs_halo_rotation_t         rotation_mode,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  double  _epzero = 1.e-30; /* smaller than epzero */
+  double  alpha = 1., beta = 0., gamma, gamma_m1 = 1., denom, residue;
+  double  s[3];
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk, *restrict mk;
+  cs_real_t  *restrict nk, *restrict zk, *restrict qk, *restrict sk;
+  cs_real_t  *restrict pk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residue (rk = b - A.x0), preconditioned residue and its product */
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    rk[ii] = rhs[ii] - rk[ii];
+    zk[ii] = 0.;
+    qk[ii] = 0.;
+    sk[ii] = 0.;
+    pk[ii] = 0.;
+  }
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          uk);
+
+  cs_matrix_vector_multiply(rotation_mode, a, uk, wk);
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (true) {
+
+    /* Start global sum of rk.rk, rk.uk and uk.wk, and overlap it
+       with preconditioning and matrix.vector product */
+
+#if defined(HAVE_MPI)
+    MPI_Request request;
+#endif
+
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s, s+1, s+2);
+
+#if defined(HAVE_MPI)
+    _sum_start(c, 3, s, &request);
+#endif
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            wk,
+                            mk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, mk, nk);
+
+#if defined(HAVE_MPI)
+    _sum_wait(&request);
+#endif
+
+    residue = sqrt(s[0]);
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    /* Convergence test for end of previous iteration */
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    n_iter += 1;
+
+    /* Descent parameters */
+
+    gamma = s[1];
+
+    if (n_iter > 1) {
+      beta = gamma / gamma_m1;
+      denom = s[2] - beta*gamma/alpha;
+    }
+    else
+      denom = s[2];
+
+    if (_breakdown(c, convergence, "delta", denom, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    alpha = gamma / denom;
+    gamma_m1 = gamma;
+
+    /* Update recurrences and solution */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      zk[ii] = nk[ii] + beta*zk[ii];
+      qk[ii] = mk[ii] + beta*qk[ii];
+      sk[ii] = wk[ii] + beta*sk[ii];
+      pk[ii] = uk[ii] + beta*pk[ii];
+      vx[ii] += alpha*pk[ii];
+      rk[ii] -= alpha*sk[ii];
+      uk[ii] -= alpha*qk[ii];
+      wk[ii] -= alpha*zk[ii];
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned Bi-CGSTAB.
  *
@@ -2206,6 +2433,272 @@ _bi_cgstab(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned Bi-CGSTAB.
+ *
+ * This variant, described in \cite Cools:2017, applies right
+ * preconditioning and uses 2 global reductions per iteration, each of
+ * which is overlapped with the application of the preconditioner and a
+ * matrix.vector product. Preconditioned vectors are updated through
+ * recurrences, so the preconditioner must be constant. As with other
+ * pipelined methods, the recursively updated residual may drift from
+ * the true residual when very tight tolerances are required.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- block size of diagonal elements
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_bi_cgstab_pipelined(cs_sles_it_t              *c,
+                     const cs_matrix_t         *a,
+                     cs_lnum_t                  diag_block_size,
+                     cs_halo_rotation_t         rotation_mode,
+                     cs_sles_it_convergence_t  *convergence,
+                     const cs_real_t           *rhs,
+                     cs_real_t                 *restrict vx,
+                     size_t                     aux_size,
+                     void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  double  _epzero = 1.e-30; /* smaller than epzero */
+  double  alpha, beta = 0., omega = 1., rho, denom, residue;
+  double  s[5];
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict res0, *restrict rk, *restrict wk, *restrict tk;
+  cs_real_t  *restrict pk, *restrict sk, *restrict zk, *restrict vk;
+  cs_real_t  *restrict rk_p, *restrict wk_p, *restrict pk_p;
+  cs_real_t  *restrict sk_p, *restrict zk_p;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 13;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    res0 = _aux_vectors;
+    rk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    tk = _aux_vectors + wa_size*3;
+    pk = _aux_vectors + wa_size*4;
+    sk = _aux_vectors + wa_size*5;
+    zk = _aux_vectors + wa_size*6;
+    vk = _aux_vectors + wa_size*7;
+    rk_p = _aux_vectors + wa_size*8;
+    wk_p = _aux_vectors + wa_size*9;
+    pk_p = _aux_vectors + wa_size*10;
+    sk_p = _aux_vectors + wa_size*11;
+    zk_p = _aux_vectors + wa_size*12;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Vectors with a "_p" suffix are preconditioned counterparts of the
+     associated vectors, so that wk = A.rk_p, tk = A.wk_p, sk = A.pk_p,
+     zk = A.sk_p and vk = A.zk_p */
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    rk[ii] = rhs[ii] - rk[ii];
+    res0[ii] = rk[ii];
+    pk[ii] = 0.;
+    sk[ii] = 0.;
+    zk[ii] = 0.;
+    vk[ii] = 0.;
+    pk_p[ii] = 0.;
+    sk_p[ii] = 0.;
+    zk_p[ii] = 0.;
+  }
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          rk_p);
+
+  cs_matrix_vector_multiply(rotation_mode, a, rk_p, wk);
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          wk,
+                          wk_p);
+
+  cs_matrix_vector_multiply(rotation_mode, a, wk_p, tk);
+
+  _dot_products_xx_xy(c, rk, wk, &rho, &denom);
+
+  residue = sqrt(rho);
+  c->setup_data->initial_residue = residue;
+
+  cvg = _convergence_test(c, n_iter, residue, convergence);
+
+  if (cvg == CS_SLES_ITERATING) {
+    if (! _breakdown(c, convergence, "rho1", denom, _epzero,
+                     residue, n_iter, &cvg))
+      alpha = rho / denom;
+  }
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+#if defined(HAVE_MPI)
+    MPI_Request request;
+#endif
+
+    n_iter += 1;
+
+    /* Update search directions; rk and wk are replaced by intermediate
+       vectors q = r - alpha.s and y = w - alpha.z, and qk.yk, yk.yk
+       computed on the fly */
+
+    double s_qy = 0., s_yy = 0.;
+
+#   pragma omp parallel for reduction(+:s_qy, s_yy) if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      pk[ii] = rk[ii] + beta*(pk[ii] - omega*sk[ii]);
+      pk_p[ii] = rk_p[ii] + beta*(pk_p[ii] - omega*sk_p[ii]);
+      sk[ii] = wk[ii] + beta*(sk[ii] - omega*zk[ii]);
+      sk_p[ii] = wk_p[ii] + beta*(sk_p[ii] - omega*zk_p[ii]);
+      zk[ii] = tk[ii] + beta*(zk[ii] - omega*vk[ii]);
+      rk[ii] -= alpha*sk[ii];
+      rk_p[ii] -= alpha*sk_p[ii];
+      wk[ii] -= alpha*zk[ii];
+      s_qy += rk[ii]*wk[ii];
+      s_yy += wk[ii]*wk[ii];
+    }
+
+    /* Overlap global sum with preconditioning and matrix.vector product */
+
+    s[0] = s_qy;
+    s[1] = s_yy;
+
+#if defined(HAVE_MPI)
+    _sum_start(c, 2, s, &request);
+#endif
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            zk,
+                            zk_p);
+
+    cs_matrix_vector_multiply(rotation_mode, a, zk_p, vk);
+
+#if defined(HAVE_MPI)
+    _sum_wait(&request);
+#endif
+
+    if (_breakdown(c, convergence, "yk.yk", s[1], _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    omega = s[0] / s[1];
+
+    /* Update solution, residue and its product, computing
+       dot products for next iteration on the fly */
+
+    double s_r0r = 0., s_r0w = 0., s_r0s = 0., s_r0z = 0., s_rr = 0.;
+
+#   pragma omp parallel for reduction(+:s_r0r, s_r0w, s_r0s, s_r0z, s_rr) \
+                            if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      wk_p[ii] -= alpha*zk_p[ii];
+      vx[ii] += alpha*pk_p[ii] + omega*rk_p[ii];
+      rk_p[ii] -= omega*wk_p[ii];
+      rk[ii] -= omega*wk[ii];
+      wk[ii] -= omega*(tk[ii] - alpha*vk[ii]);
+      s_r0r += res0[ii]*rk[ii];
+      s_r0w += res0[ii]*wk[ii];
+      s_r0s += res0[ii]*sk[ii];
+      s_r0z += res0[ii]*zk[ii];
+      s_rr += rk[ii]*rk[ii];
+    }
+
+    /* Overlap global sum with preconditioning and matrix.vector product */
+
+    s[0] = s_r0r;
+    s[1] = s_r0w;
+    s[2] = s_r0s;
+    s[3] = s_r0z;
+    s[4] = s_rr;
+
+#if defined(HAVE_MPI)
+    _sum_start(c, 5, s, &request);
+#endif
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            wk,
+                            wk_p);
+
+    cs_matrix_vector_multiply(rotation_mode, a, wk_p, tk);
+
+#if defined(HAVE_MPI)
+    _sum_wait(&request);
+#endif
+
+    residue = sqrt(s[4]);
+
+    /* Convergence test */
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    if (_breakdown(c, convergence, "rho", rho, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    if (_breakdown(c, convergence, "omega", omega, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    beta = (alpha / omega) * (s[0] / rho);
+    denom = s[1] + beta*s[2] - beta*omega*s[3];
+
+    if (_breakdown(c, convergence, "rho1", denom, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    rho = s[0];
+    alpha = rho / denom;
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of (ad+ax).vx = Rhs using (not yet preconditioned) Bi-CGSTAB2.
  *
@@ -3715,6 +4208,7 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   case CS_SLES_BICGSTAB:
   case CS_SLES_BICGSTAB2:
   case CS_SLES_PCR3:
+  case CS_SLES_PIPELINED_BICGSTAB:
     c->fallback_cvg = CS_SLES_BREAKDOWN;
     break;
   default:
@@ -3991,6 +4485,10 @@ cs_sles_it_setup(void               *context,
     c->solve = _flexible_conjugate_gradient;
     break;
 
+  case CS_SLES_PIPELINED_PCG:
+    c->solve = _conjugate_gradient_pipelined;
+    break;
+
   case CS_SLES_IPCG:
     c->solve = _conjugate_gradient_ip;
     break;
@@ -4010,6 +4508,9 @@ cs_sles_it_setup(void               *context,
   case CS_SLES_BICGSTAB2:
     c->solve = _bicgstab2;
     break;
+  case CS_SLES_PIPELINED_BICGSTAB:
+    c->solve = _bi_cgstab_pipelined;
+    break;
 
   case CS_SLES_GMRES:
     c->solve = _gmres;
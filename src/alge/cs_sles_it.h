@@ -69,12 +69,19 @@ typedef enum {
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
+  CS_SLES_PIPELINED_PCG,       /*!< Pipelined preconditioned conjugate
+                                    gradient, described in
+                                    \cite Ghysels:2014 */
+  CS_SLES_PIPELINED_BICGSTAB,  /*!< Pipelined preconditioned BiCGstab,
+                                    described in \cite Cools:2017 */
 
   CS_SLES_N_IT_TYPES,          /*!< Number of resolution algorithms
                                     excluding smoother only*/
 
   CS_SLES_TS_F_GAUSS_SEIDEL,   /*!< Truncated forward Gauss-Seidel smoother */
   CS_SLES_TS_B_GAUSS_SEIDEL,   /*!< Truncated backward Gauss-Seidel smoother */
+  CS_SLES_CHEBYSHEV,           /*!< Jacobi-preconditioned Chebyshev
+                                    polynomial smoother */
 
   CS_SLES_N_SMOOTHER_TYPES     /*!< Number of resolution algorithms
                                     including smoother only */
@@ -234,6 +234,8 @@ cs_sles_it_setup_priv(cs_sles_it_t       *c,
     sd = c->setup_data;
     sd->ad_inv = NULL;
     sd->_ad_inv = NULL;
+    sd->eig_bounds[0] = 0;
+    sd->eig_bounds[1] = 0;
     sd->pc_context = NULL;
     sd->pc_apply = NULL;
   }
@@ -134,6 +134,10 @@ typedef struct _cs_sles_it_setup_t {
   cs_real_t           *_ad_inv;          /* private pointer to
                                             diagonal inverse */
 
+  double               eig_bounds[2];    /* estimated lower and upper
+                                            eigenvalue bounds of D^-1.A
+                                            (for polynomial smoothers) */
+
   void                *pc_context;       /* preconditioner context */
   cs_sles_pc_apply_t  *pc_apply;         /* preconditioner apply */
 
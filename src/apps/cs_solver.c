@@ -94,6 +94,7 @@
 #include "cs_param_cdo.h"
 #include "cs_paramedmem_coupling.h"
 #include "cs_parameters.h"
+#include "cs_part_to_block.h"
 #include "cs_partition.h"
 #include "cs_physical_properties.h"
 #include "cs_post.h"
@@ -504,7 +505,9 @@ _run(void)
 
   cs_control_finalize();
 
-  /* Free the checkpoint multiwriter structure */
+  /* Complete asynchronous checkpoint writes and free the checkpoint
+     multiwriter structure */
+  cs_restart_checkpoint_wait();
   cs_restart_multiwriters_destroy_all();
 
   /* Print some mesh statistics */
@@ -572,6 +575,9 @@ _run(void)
 
   /* CPU times and memory management finalization */
 
+#if defined(HAVE_MPI)
+  cs_part_to_block_free_persistent();
+#endif
   cs_all_to_all_log_finalize();
   cs_io_log_finalize();
 
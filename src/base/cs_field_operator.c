@@ -152,6 +152,82 @@ cs_f_field_set_volume_average(int       f_id,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Check if a scalar field's gradient may be computed together with others
+ * (i.e. it uses neither gradient weighting nor internal coupling).
+ *
+ * parameters:
+ *   f  <-- pointer to field
+ *
+ * returns:
+ *   pointer to associated equation parameters if gradient computations
+ *   may be grouped, NULL otherwise
+ *----------------------------------------------------------------------------*/
+
+static const cs_equation_param_t *
+_gradient_scalar_group_eqp(const cs_field_t  *f)
+{
+  const cs_field_t *parent_f = f;
+
+  const int f_parent_id
+    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
+  if (f_parent_id > -1)
+    parent_f = cs_field_by_id(f_parent_id);
+
+  const cs_equation_param_t
+    *eqp = cs_field_get_equation_param_const(parent_f);
+
+  if (eqp == NULL)
+    return NULL;
+
+  if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
+
+    if (eqp->iwgrec == 1) {
+      int key_id = cs_field_key_id("gradient_weighting_id");
+      if (cs_field_get_key_int(parent_f, key_id) > -1)
+        return NULL;
+    }
+
+    int key_id = cs_field_key_id_try("coupling_entity");
+    if (key_id > -1) {
+      if (cs_field_get_key_int(parent_f, key_id) > -1)
+        return NULL;
+    }
+
+  }
+
+  return eqp;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if two sets of equation parameters lead to the same scalar
+ * gradient computation options.
+ *
+ * parameters:
+ *   eqp0  <-- first set of equation parameters
+ *   eqp1  <-- second set of equation parameters
+ *
+ * returns:
+ *   true if options are identical, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_scalar_same_options(const cs_equation_param_t  *eqp0,
+                              const cs_equation_param_t  *eqp1)
+{
+  if (   eqp0->imrgra != eqp1->imrgra
+      || eqp0->nswrgr != eqp1->nswrgr
+      || eqp0->verbosity != eqp1->verbosity
+      || eqp0->imligr != eqp1->imligr)
+    return false;
+
+  if (   eqp0->epsrgr < eqp1->epsrgr || eqp0->epsrgr > eqp1->epsrgr
+      || eqp0->climgr < eqp1->climgr || eqp0->climgr > eqp1->climgr)
+    return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Interpolate field values at a given set of points using P0 interpolation.
  *
@@ -644,6 +720,125 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      grad);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute cell gradients of multiple scalar fields.
+ *
+ * Fields sharing the same gradient options are grouped and handled by
+ * \ref cs_gradient_scalar_multi. Fields using gradient weighting or
+ * internal coupling, or meshes with rotation periodicity, are handled
+ * by \ref cs_field_gradient_scalar. In all cases, results are the same
+ * as with successive calls to \ref cs_field_gradient_scalar.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       f               pointers to fields
+ * \param[in]       use_previous_t  should we use values from the previous
+ *                                  time step ?
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[out]      grad            gradient for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar_multi(int                  n_fields,
+                               const cs_field_t    *f[],
+                               bool                 use_previous_t,
+                               int                  inc,
+                               bool                 recompute_cocg,
+                               cs_real_3_t         *grad[])
+{
+  if (n_fields < 1)
+    return;
+
+  const cs_equation_param_t **f_eqp;
+  BFT_MALLOC(f_eqp, n_fields, const cs_equation_param_t *);
+
+  /* Handle fields which can not be grouped first */
+
+  for (int i = 0; i < n_fields; i++) {
+    f_eqp[i] = _gradient_scalar_group_eqp(f[i]);
+    if (   f_eqp[i] == NULL
+        || cs_glob_mesh->have_rotation_perio
+        || (f[i]->n_time_vals < 2 && use_previous_t)) {
+      f_eqp[i] = NULL;
+      cs_field_gradient_scalar(f[i],
+                               use_previous_t,
+                               inc,
+                               recompute_cocg,
+                               grad[i]);
+    }
+  }
+
+  /* Group remaining fields by gradient options */
+
+  const char **g_name;
+  const cs_real_t **g_bc_coeff_a, **g_bc_coeff_b;
+  cs_real_t **g_var;
+  cs_real_3_t **g_grad;
+
+  BFT_MALLOC(g_name, n_fields, const char *);
+  BFT_MALLOC(g_bc_coeff_a, n_fields, const cs_real_t *);
+  BFT_MALLOC(g_bc_coeff_b, n_fields, const cs_real_t *);
+  BFT_MALLOC(g_var, n_fields, cs_real_t *);
+  BFT_MALLOC(g_grad, n_fields, cs_real_3_t *);
+
+  for (int i = 0; i < n_fields; i++) {
+
+    const cs_equation_param_t *eqp = f_eqp[i];
+    if (eqp == NULL)
+      continue;
+
+    int n_g = 0;
+
+    for (int j = i; j < n_fields; j++) {
+      if (f_eqp[j] == NULL)
+        continue;
+      if (_gradient_scalar_same_options(eqp, f_eqp[j]) == false)
+        continue;
+      g_name[n_g] = f[j]->name;
+      g_bc_coeff_a[n_g] = (f[j]->bc_coeffs != NULL) ? f[j]->bc_coeffs->a : NULL;
+      g_bc_coeff_b[n_g] = (f[j]->bc_coeffs != NULL) ? f[j]->bc_coeffs->b : NULL;
+      g_var[n_g] = (use_previous_t) ? f[j]->val_pre : f[j]->val;
+      g_grad[n_g] = grad[j];
+      f_eqp[j] = NULL;
+      n_g++;
+    }
+
+    cs_halo_type_t halo_type = CS_HALO_STANDARD;
+    cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+
+    cs_gradient_type_by_imrgra(eqp->imrgra,
+                               &gradient_type,
+                               &halo_type);
+
+    cs_gradient_scalar_multi(n_g,
+                             g_name,
+                             gradient_type,
+                             halo_type,
+                             inc,
+                             recompute_cocg,
+                             eqp->nswrgr,
+                             eqp->verbosity,
+                             eqp->imligr,
+                             eqp->epsrgr,
+                             eqp->climgr,
+                             g_bc_coeff_a,
+                             g_bc_coeff_b,
+                             g_var,
+                             g_grad);
+
+  }
+
+  BFT_FREE(g_grad);
+  BFT_FREE(g_var);
+  BFT_FREE(g_bc_coeff_b);
+  BFT_FREE(g_bc_coeff_a);
+  BFT_FREE(g_name);
+
+  BFT_FREE(f_eqp);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
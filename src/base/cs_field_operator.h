@@ -81,6 +81,30 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                          bool                       recompute_cocg,
                          cs_real_3_t      *restrict grad);
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalar fields.
+ *
+ * Fields sharing the same gradient options are grouped and handled by
+ * cs_gradient_scalar_multi; results are the same as with successive
+ * calls to cs_field_gradient_scalar.
+ *
+ * parameters:
+ *   n_fields       <-- number of fields
+ *   f              <-- pointers to fields
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   recompute_cocg <-- should COCG FV quantities be recomputed ?
+ *   grad           --> gradient for each field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar_multi(int                  n_fields,
+                               const cs_field_t    *f[],
+                               bool                 use_previous_t,
+                               int                  inc,
+                               bool                 recompute_cocg,
+                               cs_real_3_t         *grad[]);
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient of scalar field or component of vector or
  * tensor field.
@@ -69,6 +69,11 @@
 #include <dirent.h>
 #endif
 
+#if defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #endif
@@ -192,8 +197,20 @@ struct _cs_file_t {
 
   FILE              *sh;           /* Serial file handle */
 
+  bool               use_mmap;     /* Map file to memory for reads ? */
+  unsigned char     *map;          /* Memory-mapped file contents */
+  size_t             map_size;     /* Size of mapped contents */
+  int                n_views;      /* Number of private (byte-swapped)
+                                      mapped views */
+  unsigned char    **views;        /* Private mapped views */
+  size_t            *views_size;   /* Size of private mapped views */
+
 #if defined(HAVE_MPI)
-  int                rank_step;    /* Rank step between ranks and io ranks */
+  int                rank_step;    /* Rank step between ranks and io ranks
+                                      (maximum aggregation group size) */
+  int                aggr_root;    /* Rank of associated aggregator */
+  int                n_aggr;       /* Number of ranks in aggregation group
+                                      (on aggregator rank) */
   cs_gnum_t         *block_size;   /* Block sizes on IO ranks in case
                                       of rank stepping */
   MPI_Comm           comm;         /* Associated MPI communicator */
@@ -203,6 +220,12 @@ struct _cs_file_t {
   MPI_File           fh;           /* MPI file handle */
   MPI_Info           info;         /* MPI file info */
   MPI_Offset         offset;       /* MPI file offset */
+
+  bool               async_write;  /* Use non-blocking block writes ? */
+  int                n_async;      /* Number of pending block writes */
+  int                n_async_max;  /* Size of pending write arrays */
+  MPI_Request       *async_req;    /* Pending write requests */
+  void             **async_buf;    /* Staging buffers of pending writes */
 #else
   cs_file_off_t      offset;       /* File offset */
 #endif
@@ -257,12 +280,20 @@ static cs_file_mpi_positioning_t
 static cs_file_access_t _default_access_r = CS_FILE_DEFAULT;
 static cs_file_access_t _default_access_w = CS_FILE_DEFAULT;
 
+/* Use memory-mapped reads with standard IO access methods ? */
+
+static bool _default_mmap_r = false;
+
 /* Communicator and hints used for file operations */
 
 #if defined(HAVE_MPI)
 
 static bool     _mpi_defaults_are_set = false;
 static int      _mpi_rank_step = 1;
+static bool     _mpi_node_aggr = false;   /* node-level aggregation ? */
+static int      _mpi_node_aggr_step = 1;  /* max. ranks per node group */
+static int      _mpi_node_aggr_root = 0;  /* node group aggregator rank */
+static int      _mpi_node_n_aggr = 1;     /* ranks in node group */
 static MPI_Comm _mpi_comm = MPI_COMM_NULL;
 static MPI_Comm _mpi_io_comm = MPI_COMM_NULL;
 static MPI_Info _mpi_io_hints_r = MPI_INFO_NULL;
@@ -515,6 +546,50 @@ _swap_endian(void        *dest,
     memcpy(dest, src, ni);
 }
 
+/*----------------------------------------------------------------------------
+ * Map a file opened for reading using standard C IO to memory.
+ *
+ * Pages of the mapped file are loaded lazily by the operating system
+ * when first accessed.
+ *
+ * parameters:
+ *   f    <-> pointer to file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_map(cs_file_t  *f)
+{
+  assert(f != NULL);
+
+  if (f->map != NULL || f->sh == NULL || f->mode != CS_FILE_MODE_READ)
+    return;
+
+#if defined(HAVE_SYS_MMAN_H)
+
+  struct stat s;
+  int fd = fileno(f->sh);
+
+  if (fstat(fd, &s) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error querying size of file \"%s\":\n\n"
+                "  %s"), f->name, strerror(errno));
+
+  if (s.st_size > 0) {
+
+    void *p = mmap(NULL, s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (p == MAP_FAILED)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error mapping file \"%s\" to memory:\n\n"
+                  "  %s"), f->name, strerror(errno));
+
+    f->map = p;
+    f->map_size = s.st_size;
+  }
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Open a file using standard C IO.
  *
@@ -562,79 +637,8 @@ _file_open(cs_file_t  *f)
     retval = errno;
   }
 
-  return retval;
-}
-
-/*----------------------------------------------------------------------------
- * Close a file using standard C IO.
- *
- * parameters:
- *   f <-> pointer to file handler
- *
- * returns:
- *   0 in case of success, -1 in case of failure
- *----------------------------------------------------------------------------*/
-
-static int
-_file_close(cs_file_t  *f)
-{
-  int retval = 0;
-
-  if (f->sh != NULL)
-    retval = fclose(f->sh);
-
-  if (retval != 0) {
-    bft_error(__FILE__, __LINE__, 0,
-              _("Error closing file \"%s\":\n\n"
-                "  %s"), f->name, strerror(errno));
-    retval = errno;
-  }
-  f->sh = NULL;
-
-  return retval;
-}
-
-/*----------------------------------------------------------------------------
- * Read data to a buffer using standard C IO.
- *
- * parameters:
- *   f    <-- cs_file_t descriptor
- *   buf  --> pointer to location receiving data
- *   size <-- size of each item of data in bytes
- *   ni   <-- number of items to read
- *
- * returns:
- *   the (local) number of items (not bytes) sucessfully read;
- *----------------------------------------------------------------------------*/
-
-static size_t
-_file_read(cs_file_t  *f,
-           void       *buf,
-           size_t      size,
-           size_t      ni)
-{
-  size_t retval = 0;
-
-  assert(f->sh != NULL);
-
-  if (ni != 0)
-    retval = fread(buf, size, ni, f->sh);
-
-  /* In case of error, determine error type */
-
-  if (retval != ni) {
-    int err_num = ferror(f->sh);
-    if (err_num != 0)
-      bft_error(__FILE__, __LINE__, 0,
-                _("Error reading file \"%s\":\n\n  %s"),
-                f->name, strerror(err_num));
-    else if (feof(f->sh) != 0)
-      bft_error(__FILE__, __LINE__, 0,
-                _("Premature end of file \"%s\""), f->name);
-    else
-      bft_error(__FILE__, __LINE__, 0,
-                _("Error reading file \"%s\""), f->name);
-  }
+  else if (f->use_mmap)
+    _file_map(f);
 
   return retval;
 }
@@ -825,6 +829,109 @@ _file_tell(cs_file_t  *f)
   return offset;
 }
 
+/*----------------------------------------------------------------------------
+ * Close a file using standard C IO.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, -1 in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_close(cs_file_t  *f)
+{
+  int retval = 0;
+
+#if defined(HAVE_SYS_MMAN_H)
+  for (int i = 0; i < f->n_views; i++)
+    munmap(f->views[i], f->views_size[i]);
+  f->n_views = 0;
+  BFT_FREE(f->views);
+  BFT_FREE(f->views_size);
+  if (f->map != NULL) {
+    munmap(f->map, f->map_size);
+    f->map = NULL;
+    f->map_size = 0;
+  }
+#endif
+
+  if (f->sh != NULL)
+    retval = fclose(f->sh);
+
+  if (retval != 0) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error closing file \"%s\":\n\n"
+                "  %s"), f->name, strerror(errno));
+    retval = errno;
+  }
+  f->sh = NULL;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Read data to a buffer using standard C IO.
+ *
+ * parameters:
+ *   f    <-- cs_file_t descriptor
+ *   buf  --> pointer to location receiving data
+ *   size <-- size of each item of data in bytes
+ *   ni   <-- number of items to read
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully read;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_read(cs_file_t  *f,
+           void       *buf,
+           size_t      size,
+           size_t      ni)
+{
+  size_t retval = 0;
+
+  assert(f->sh != NULL);
+
+  /* Copy from memory-mapped contents if available */
+
+  if (f->map != NULL && ni != 0) {
+    cs_file_off_t offset = _file_tell(f);
+    size_t n_avail = 0;
+    if (offset >= 0 && (size_t)offset < f->map_size)
+      n_avail = (f->map_size - (size_t)offset) / size;
+    retval = (ni < n_avail) ? ni : n_avail;
+    memcpy(buf, f->map + offset, retval*size);
+    _file_seek(f, offset + retval*size, CS_FILE_SEEK_SET);
+    if (retval != ni)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Premature end of file \"%s\""), f->name);
+    return retval;
+  }
+
+  if (ni != 0)
+    retval = fread(buf, size, ni, f->sh);
+
+  /* In case of error, determine error type */
+
+  if (retval != ni) {
+    int err_num = ferror(f->sh);
+    if (err_num != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error reading file \"%s\":\n\n  %s"),
+                f->name, strerror(err_num));
+    else if (feof(f->sh) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Premature end of file \"%s\""), f->name);
+    else
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error reading file \"%s\""), f->name);
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Read data to a buffer, distributing a contiguous part of it to each
  * process associated with a file.
@@ -1210,16 +1317,12 @@ _gather_block_sizes(cs_file_t   *f,
 
   /* Aggregator rank */
 
-  if (f->rank % f->rank_step == 0) {
+  if (f->rank == f->aggr_root) {
 
     f->block_size[0] = _global_num_end - global_num_start;
     size_t block_size = f->block_size[0];
 
-    int rank_end = f->rank + f->rank_step;
-    if (rank_end >= f->n_ranks)
-      rank_end = f->n_ranks;
-
-    int n_aggr = rank_end - f->rank;
+    int n_aggr = f->n_aggr;
 
     /* Receive counts */
 
@@ -1243,7 +1346,7 @@ _gather_block_sizes(cs_file_t   *f,
 
   else {
 
-    int dest_rank = f->rank - (f->rank % f->rank_step);
+    int dest_rank = f->aggr_root;
     cs_gnum_t block_size = _global_num_end - global_num_start;
     f->block_size[0] = block_size;
 
@@ -1298,13 +1401,9 @@ _gather_blocks(cs_file_t   *f,
 
   /* Aggregator rank */
 
-  if (f->rank % f->rank_step == 0) {
-
-    int rank_end = f->rank + f->rank_step;
-    if (rank_end >= f->n_ranks)
-      rank_end = f->n_ranks;
+  if (f->rank == f->aggr_root) {
 
-    int n_aggr = rank_end - f->rank;
+    int n_aggr = f->n_aggr;
 
     /* Precaution for large messages */
 
@@ -1348,7 +1447,7 @@ _gather_blocks(cs_file_t   *f,
 
   else {
 
-    int dest_rank = f->rank - (f->rank % f->rank_step);
+    int dest_rank = f->aggr_root;
     cs_gnum_t block_size = f->block_size[0];
 
     size_t message_size = _size * (size_t)block_size;
@@ -1407,13 +1506,9 @@ _scatter_blocks(cs_file_t   *f,
 
   /* Aggregator rank */
 
-  if (f->rank % f->rank_step == 0) {
-
-    int rank_end = f->rank + f->rank_step;
-    if (rank_end >= f->n_ranks)
-      rank_end = f->n_ranks;
+  if (f->rank == f->aggr_root) {
 
-    int n_aggr = rank_end - f->rank;
+    int n_aggr = f->n_aggr;
 
     /* Precaution for large messages */
 
@@ -1457,7 +1552,7 @@ _scatter_blocks(cs_file_t   *f,
 
   else {
 
-    int dest_rank = f->rank - (f->rank % f->rank_step);
+    int dest_rank = f->aggr_root;
     cs_gnum_t block_size = f->block_size[0];
 
     size_t message_size = _size * (size_t)block_size;
@@ -1485,6 +1580,89 @@ _scatter_blocks(cs_file_t   *f,
   return f->block_size[0];
 }
 
+/*----------------------------------------------------------------------------
+ * Create an MPI communicator for node-level aggregated block IO.
+ *
+ * Aggregation groups consist of consecutive ranks sharing the same compute
+ * node, so as to keep gathered blocks contiguous; the first rank of each
+ * group is its aggregator, and is the only one participating in the
+ * returned communicator.
+ *
+ * Group info is stored in the matching _mpi_node_* static variables.
+ *
+ * parameters:
+ *   comm <-- handle to main MPI communicator
+ *
+ * returns:
+ *   communicator associated with IO, MPI_COMM_NULL for ranks not
+ *   participating in parallel IO
+ *----------------------------------------------------------------------------*/
+
+static MPI_Comm
+_node_block_comm(MPI_Comm  comm)
+{
+  MPI_Comm  new_comm = MPI_COMM_NULL;
+
+  int rank_id, n_ranks;
+  MPI_Comm_rank(comm, &rank_id);
+  MPI_Comm_size(comm, &n_ranks);
+
+  _mpi_node_aggr_step = 1;
+  _mpi_node_aggr_root = rank_id;
+  _mpi_node_n_aggr = 1;
+
+  if (n_ranks < 2)
+    return new_comm;
+
+#if (MPI_VERSION >= 3)
+
+  static const int tag = 'n'+'o'+'d'+'e'+'_'+'a'+'g'+'g'+'r';
+
+  MPI_Comm node_comm = MPI_COMM_NULL, group_comm = MPI_COMM_NULL;
+
+  /* Identify node by its lowest rank */
+
+  int node_id = rank_id, prev_node_id = -1;
+
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank_id, MPI_INFO_NULL,
+                      &node_comm);
+  MPI_Allreduce(&rank_id, &node_id, 1, MPI_INT, MPI_MIN, node_comm);
+  MPI_Comm_free(&node_comm);
+
+  /* A rank is an aggregator if the previous rank is on a different node */
+
+  int next_rank = (rank_id + 1 < n_ranks) ? rank_id + 1 : MPI_PROC_NULL;
+  int prev_rank = (rank_id > 0) ? rank_id - 1 : MPI_PROC_NULL;
+
+  MPI_Sendrecv(&node_id, 1, MPI_INT, next_rank, tag,
+               &prev_node_id, 1, MPI_INT, prev_rank, tag,
+               comm, MPI_STATUS_IGNORE);
+
+  int is_aggr = (prev_node_id != node_id) ? 1 : 0;
+  int aggr_root = (is_aggr) ? rank_id : -1;
+
+  MPI_Scan(&aggr_root, &_mpi_node_aggr_root, 1, MPI_INT, MPI_MAX, comm);
+
+  /* Group sizes */
+
+  MPI_Comm_split(comm, _mpi_node_aggr_root, rank_id, &group_comm);
+  MPI_Comm_size(group_comm, &_mpi_node_n_aggr);
+  MPI_Comm_free(&group_comm);
+
+  MPI_Allreduce(&_mpi_node_n_aggr, &_mpi_node_aggr_step, 1, MPI_INT, MPI_MAX,
+                comm);
+
+  MPI_Comm_split(comm, (is_aggr) ? 0 : MPI_UNDEFINED, rank_id, &new_comm);
+
+#else
+
+  MPI_Comm_dup(comm, &new_comm);
+
+#endif
+
+  return new_comm;
+}
+
 #endif /* defined(HAVE_MPI) */
 
 #if defined(HAVE_MPI_IO)
@@ -2045,6 +2223,137 @@ _mpi_file_write_block_ip(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Start writing data to a file, each associated process writing a
+ * contiguous part of this data, without waiting for completion.
+ *
+ * Data is copied to a staging buffer, which is released once the
+ * write has completed (see _mpi_file_async_complete), so the caller
+ * may reuse or free the source buffer immediately.
+ *
+ * Only explicit offsets are used, so that file views are not modified
+ * while writes are pending.
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   buf              <-- pointer to location containing data
+ *   size             <-- size of each item of data in bytes
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   the (local) number of items (not bytes) for which writing was started;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_mpi_file_iwrite_block(cs_file_t  *f,
+                       void       *buf,
+                       size_t      size,
+                       cs_gnum_t   global_num_start,
+                       cs_gnum_t   global_num_end)
+{
+  cs_gnum_t gcount = (global_num_end - global_num_start)*size;
+  size_t retval = 0;
+
+  if (f->fh == MPI_FILE_NULL || gcount == 0)
+    return retval;
+
+  int errcode, count;
+  MPI_Offset disp = f->offset + ((global_num_start - 1) * size);
+  MPI_Datatype ent_type = MPI_BYTE;
+
+  if (gcount > INT_MAX) {
+    MPI_Type_contiguous(size, MPI_BYTE, &ent_type);
+    MPI_Type_commit(&ent_type);
+    count = global_num_end - global_num_start;
+  }
+  else
+    count = gcount;
+
+  if (f->n_async >= f->n_async_max) {
+    f->n_async_max = CS_MAX(8, f->n_async_max*2);
+    BFT_REALLOC(f->async_req, f->n_async_max, MPI_Request);
+    BFT_REALLOC(f->async_buf, f->n_async_max, void *);
+  }
+
+  unsigned char *s_buf;
+  BFT_MALLOC(s_buf, gcount, unsigned char);
+  memcpy(s_buf, buf, gcount);
+
+  errcode = MPI_File_iwrite_at(f->fh, disp, s_buf, count, ent_type,
+                               f->async_req + f->n_async);
+
+  if (errcode != MPI_SUCCESS)
+    _mpi_io_error_message(f->name, errcode);
+
+  f->async_buf[f->n_async] = s_buf;
+  f->n_async += 1;
+
+  /* The datatype may be freed as soon as the operation is started */
+
+  if (ent_type != MPI_BYTE)
+    MPI_Type_free(&ent_type);
+
+  retval = global_num_end - global_num_start;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Complete pending non-blocking writes, releasing associated staging
+ * buffers.
+ *
+ * parameters:
+ *   f    <-> cs_file_t descriptor
+ *   wait <-- if true, wait for all writes to complete; otherwise,
+ *            only release those already completed
+ *----------------------------------------------------------------------------*/
+
+static void
+_mpi_file_async_complete(cs_file_t  *f,
+                         bool        wait)
+{
+  if (f->n_async == 0)
+    return;
+
+  int errcode = MPI_SUCCESS;
+
+  if (wait)
+    errcode = MPI_Waitall(f->n_async, f->async_req, MPI_STATUSES_IGNORE);
+  else {
+    int n_done = 0;
+    int *done_ids;
+    BFT_MALLOC(done_ids, f->n_async, int);
+    errcode = MPI_Testsome(f->n_async, f->async_req, &n_done, done_ids,
+                           MPI_STATUSES_IGNORE);
+    BFT_FREE(done_ids);
+  }
+
+  if (errcode != MPI_SUCCESS)
+    _mpi_io_error_message(f->name, errcode);
+
+  /* Completed requests are set to MPI_REQUEST_NULL; compact others */
+
+  int j = 0;
+  for (int i = 0; i < f->n_async; i++) {
+    if (f->async_req[i] == MPI_REQUEST_NULL)
+      BFT_FREE(f->async_buf[i]);
+    else {
+      f->async_req[j] = f->async_req[i];
+      f->async_buf[j] = f->async_buf[i];
+      j++;
+    }
+  }
+  f->n_async = j;
+
+  if (f->n_async == 0) {
+    f->n_async_max = 0;
+    BFT_FREE(f->async_req);
+    BFT_FREE(f->async_buf);
+  }
+}
+
 #endif /* defined(HAVE_MPI_IO) */
 
 /*----------------------------------------------------------------------------
@@ -2152,6 +2461,11 @@ cs_file_open(const char        *name,
 #if defined(HAVE_MPI_IO)
   f->fh = MPI_FILE_NULL;
   f->info = hints;
+  f->async_write = false;
+  f->n_async = 0;
+  f->n_async_max = 0;
+  f->async_req = NULL;
+  f->async_buf = NULL;
 #endif
 #endif
 
@@ -2168,6 +2482,13 @@ cs_file_open(const char        *name,
 
   f->swap_endian = false; /* Use native endianness by default */
 
+  f->use_mmap = (mode == CS_FILE_MODE_READ) ? _default_mmap_r : false;
+  f->map = NULL;
+  f->map_size = 0;
+  f->n_views = 0;
+  f->views = NULL;
+  f->views_size = NULL;
+
   /* Set communicator */
 
 #if defined(HAVE_MPI)
@@ -2200,6 +2521,23 @@ cs_file_open(const char        *name,
     if (f->n_ranks % n_io_ranks)
       f->rank_step += 1;
 
+    f->aggr_root = f->rank - (f->rank % f->rank_step);
+    f->n_aggr = CS_MIN(f->rank_step, f->n_ranks - f->aggr_root);
+
+    /* Node-level aggregation groups do not follow a regular rank step */
+
+    if (_mpi_node_aggr && f->comm != MPI_COMM_NULL) {
+      int l_match = (   f->comm == _mpi_comm
+                     && f->io_comm == _mpi_io_comm) ? 1 : 0;
+      int g_match = 0;
+      MPI_Allreduce(&l_match, &g_match, 1, MPI_INT, MPI_MIN, f->comm);
+      if (g_match) {
+        f->rank_step = _mpi_node_aggr_step;
+        f->aggr_root = _mpi_node_aggr_root;
+        f->n_aggr = _mpi_node_n_aggr;
+      }
+    }
+
     f->block_size = NULL;
     if (f->rank_step > 1) {
       if (f->io_comm != MPI_COMM_NULL)
@@ -2357,8 +2695,10 @@ cs_file_free(cs_file_t  *f)
     _file_close(_f);
 
 #if defined(HAVE_MPI_IO)
-  else if (_f->fh != MPI_FILE_NULL)
+  else if (_f->fh != MPI_FILE_NULL) {
+    _mpi_file_async_complete(_f, true);
     _mpi_file_close(_f);
+  }
   BFT_FREE(f->block_size);
 #endif
 
@@ -2455,6 +2795,220 @@ cs_file_set_swap_endian(cs_file_t  *f,
   f->swap_endian = swap;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a read-only view of a memory-mapped file's contents.
+ *
+ * This is available only for files opened for reading with memory-mapped
+ * reads enabled (see \ref cs_file_set_default_mmap_read), using a standard
+ * IO access method allowing the calling rank to access the file
+ * (i.e. \ref CS_FILE_STDIO_PARALLEL, or any standard IO method on a
+ * single rank).
+ *
+ * This function is local (non-collective); on ranks which have not
+ * accessed the file yet, it is opened and mapped. Pages of the file
+ * are only loaded when accessed.
+ *
+ * \param[in, out]  f     cs_file_t descriptor
+ * \param[out]      size  size of mapped contents, in bytes, or NULL
+ *
+ * \return  pointer to start of mapped file contents, or NULL if not
+ *          available
+ */
+/*----------------------------------------------------------------------------*/
+
+const void *
+cs_file_get_map(cs_file_t      *f,
+                cs_file_off_t  *size)
+{
+  assert(f != NULL);
+
+  const void *retval = NULL;
+
+  if (size != NULL)
+    *size = 0;
+
+  if (f->use_mmap == false || f->mode != CS_FILE_MODE_READ)
+    return retval;
+
+  if (   f->method == CS_FILE_STDIO_PARALLEL
+      || (f->method == CS_FILE_STDIO_SERIAL && f->n_ranks == 1)) {
+
+    if (f->sh == NULL)
+      _file_open(f);
+
+    retval = f->map;
+    if (size != NULL && f->map != NULL)
+      *size = f->map_size;
+
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a read-only view of a range of a memory-mapped file's
+ *        contents, with values in native endianness.
+ *
+ * The same conditions as for \ref cs_file_get_map apply. If no byte swapping
+ * is needed, the view simply points to the file's mapped contents.
+ * Otherwise, the pages containing the range are mapped again privately
+ * (copy-on-write), and values are byte-swapped in place, so neither the file
+ * nor its main mapping (used for reads) are modified. Such views remain
+ * valid until the file is closed.
+ *
+ * \param[in, out]  f       cs_file_t descriptor
+ * \param[in]       offset  offset of first value in file, in bytes
+ * \param[in]       size    size of each item of data in bytes
+ * \param[in]       ni      number of items
+ *
+ * \return  pointer to the first value of the range, or NULL if not
+ *          available
+ */
+/*----------------------------------------------------------------------------*/
+
+const void *
+cs_file_get_map_range(cs_file_t      *f,
+                      cs_file_off_t   offset,
+                      size_t          size,
+                      size_t          ni)
+{
+  cs_file_off_t map_size = 0;
+  const unsigned char *map = cs_file_get_map(f, &map_size);
+
+  if (   map == NULL || offset < 0
+      || offset + (cs_file_off_t)(size*ni) > map_size)
+    return NULL;
+
+  if (f->swap_endian == false || size < 2 || ni == 0)
+    return map + offset;
+
+  unsigned char *retval = NULL;
+
+#if defined(HAVE_SYS_MMAN_H)
+
+  cs_file_off_t page_size = sysconf(_SC_PAGESIZE);
+  cs_file_off_t p_offset = offset - (offset % page_size);
+  size_t v_size = offset - p_offset + size*ni;
+
+  void *p = mmap(NULL, v_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                 fileno(f->sh), p_offset);
+
+  if (p == MAP_FAILED)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error mapping file \"%s\" to memory:\n\n"
+                "  %s"), f->name, strerror(errno));
+
+  BFT_REALLOC(f->views, f->n_views + 1, unsigned char *);
+  BFT_REALLOC(f->views_size, f->n_views + 1, size_t);
+  f->views[f->n_views] = p;
+  f->views_size[f->n_views] = v_size;
+  f->n_views += 1;
+
+  retval = (unsigned char *)p + (offset - p_offset);
+  _swap_endian(retval, retval, size, ni);
+
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow or disallow asynchronous (non-blocking) block writes
+ *        for a file.
+ *
+ * When allowed, block writes only start writing data, which is copied
+ * to staging buffers, and return without waiting for completion.
+ * Pending writes are completed at the latest when the file is closed.
+ *
+ * This is only possible with MPI-IO based access methods and explicit
+ * offsets positioning; in other cases, writes remain synchronous.
+ *
+ * \param[in, out]  f      cs_file_t descriptor
+ * \param[in]       async  true if asynchronous writes are allowed
+ *
+ * \return  true if asynchronous writes are active for this file
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_set_async_write(cs_file_t  *f,
+                        bool        async)
+{
+  assert(f != NULL);
+
+  bool retval = false;
+
+#if defined(HAVE_MPI_IO)
+
+  if (async == false)
+    _mpi_file_async_complete(f, true);
+
+  else if (   f->mode != CS_FILE_MODE_READ
+           && (   f->method == CS_FILE_MPI_NON_COLLECTIVE
+               || f->method == CS_FILE_MPI_COLLECTIVE)
+           && _mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
+    retval = true;
+
+  f->async_write = retval;
+
+#else
+
+  CS_UNUSED(async);
+
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Release staging buffers of completed asynchronous writes.
+ *
+ * This function is local to each rank, and may be called regularly
+ * to ensure progress of pending writes.
+ *
+ * \param[in, out]  f  cs_file_t descriptor
+ *
+ * \return  number of local writes still pending
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_file_test_async_write(cs_file_t  *f)
+{
+  assert(f != NULL);
+
+  int retval = 0;
+
+#if defined(HAVE_MPI_IO)
+  _mpi_file_async_complete(f, false);
+  retval = f->n_async;
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of a file's pending asynchronous writes.
+ *
+ * \param[in, out]  f  cs_file_t descriptor
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_wait_async_write(cs_file_t  *f)
+{
+  assert(f != NULL);
+
+#if defined(HAVE_MPI_IO)
+  _mpi_file_async_complete(f, true);
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read global data from a file, distributing it to all processes
@@ -3004,15 +3558,28 @@ cs_file_write_block_buffer(cs_file_t  *f,
 
   case CS_FILE_MPI_INDEPENDENT:
   case CS_FILE_MPI_NON_COLLECTIVE:
+    if (f->async_write)
+      retval = _mpi_file_iwrite_block(f,
+                                      _buf,
+                                      size,
+                                      _global_num_start,
+                                      _global_num_end);
+    else
       retval = _mpi_file_write_block_noncoll(f,
                                              _buf,
                                              size,
                                              _global_num_start,
                                              _global_num_end);
-      break;
+    break;
 
   case CS_FILE_MPI_COLLECTIVE:
-    if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
+    if (f->async_write)
+      retval = _mpi_file_iwrite_block(f,
+                                      _buf,
+                                      size,
+                                      _global_num_start,
+                                      _global_num_end);
+    else if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
       retval = _mpi_file_write_block_eo(f,
                                         _buf,
                                         size,
@@ -3034,12 +3601,9 @@ cs_file_write_block_buffer(cs_file_t  *f,
 
 #if defined(HAVE_MPI)
   if (f->rank_step > 1) {
-    if (f->rank % f->rank_step == 0) {
+    if (f->rank == f->aggr_root) {
       /* Check for inconsistent read sizes */
-      int rank_end = f->rank + f->rank_step;
-      if (rank_end >= f->n_ranks)
-        rank_end = f->n_ranks;
-      int n_aggr = rank_end - f->rank;
+      int n_aggr = f->n_aggr;
       cs_gnum_t retval_cmp = 0;
       for (int i = 0; i < n_aggr; i++)
         retval_cmp += f->block_size[i];
@@ -3287,6 +3851,10 @@ cs_file_free_defaults(void)
 #if defined(HAVE_MPI)
   _mpi_defaults_are_set = false;
   _mpi_rank_step = 1;
+  _mpi_node_aggr = false;
+  _mpi_node_aggr_step = 1;
+  _mpi_node_aggr_root = 0;
+  _mpi_node_n_aggr = 1;
   _mpi_comm = MPI_COMM_NULL;
 
   if (_mpi_io_comm != MPI_COMM_NULL) {
@@ -3454,6 +4022,33 @@ cs_file_set_default_access(cs_file_mode_t    mode,
 
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable memory-mapped reads for files opened for reading
+ *        with standard IO access methods.
+ *
+ * When enabled, files opened for reading are mapped to memory by the ranks
+ * accessing them, so reads are simple copies from the mapped pages, which
+ * the operating system loads lazily, and read-only views of file sections
+ * may be obtained using \ref cs_file_get_map.
+ *
+ * This setting applies to files opened after this call, and has no effect
+ * on systems where memory mapping is not available.
+ *
+ * \param[in]  mmap_read  true to map files opened for reading to memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_mmap_read(bool  mmap_read)
+{
+#if defined(HAVE_SYS_MMAN_H)
+  _default_mmap_r = mmap_read;
+#else
+  CS_UNUSED(mmap_read);
+#endif
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------*/
@@ -3552,7 +4147,13 @@ cs_file_set_default_comm(int       block_rank_step,
 
     if (_mpi_comm != MPI_COMM_NULL) {
 
-      if (_mpi_rank_step < 2) {
+      if (_mpi_node_aggr) {
+        if (_mpi_rank_step < 2)
+          _mpi_rank_step = 1;
+        _mpi_io_comm = _node_block_comm(_mpi_comm);
+      }
+
+      else if (_mpi_rank_step < 2) {
         _mpi_rank_step = 1;
         MPI_Comm_dup(_mpi_comm, &_mpi_io_comm);
       }
@@ -3567,6 +4168,36 @@ cs_file_set_default_comm(int       block_rank_step,
   _mpi_defaults_are_set = true;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set default node-level aggregation for distributed file access.
+ *
+ * When active, ranks are grouped by compute node (as determined by
+ * MPI_Comm_split_type with MPI_COMM_TYPE_SHARED), and distributed block
+ * data is gathered on (or scattered from) the first rank of each group,
+ * which is the only one to access the file, using large contiguous reads
+ * and writes. This reduces the number of processes accessing the file
+ * system (and associated lock contention) to one per node.
+ *
+ * As gathered blocks must remain contiguous, a group consists of
+ * consecutive ranks on the same node, so nodes on which ranks are not
+ * numbered consecutively have several aggregators.
+ *
+ * This function is collective on the default file communicator, and
+ * requires MPI 3; otherwise, it has no effect.
+ *
+ * \param[in]  node_aggr  true to activate node-level aggregation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_node_aggregation(bool  node_aggr)
+{
+  _mpi_node_aggr = node_aggr;
+
+  cs_file_set_default_comm(_mpi_rank_step, MPI_COMM_SELF);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create an MPI communicator for distributed block parallel IO.
@@ -3717,9 +4348,13 @@ cs_file_defaults_info(void)
     }
 #endif
     if (method <= CS_FILE_STDIO_PARALLEL) {
-      for (log_id = 0; log_id < 2; log_id++)
+      for (log_id = 0; log_id < 2; log_id++) {
         cs_log_printf(logs[log_id],
                       _(fmt[mode]), _(cs_file_access_name[method]));
+        if (mode == CS_FILE_MODE_READ && _default_mmap_r)
+          cs_log_printf(logs[log_id],
+                        _("    memory-mapped reads\n"));
+      }
     }
 
 #if MPI_VERSION > 1
@@ -3752,9 +4387,15 @@ cs_file_defaults_info(void)
   if (cs_glob_n_ranks > 1) {
     int block_rank_step;
     cs_file_get_default_comm(&block_rank_step, NULL, NULL);
-    for (log_id = 0; log_id < 2; log_id++)
+    for (log_id = 0; log_id < 2; log_id++) {
       cs_log_printf(logs[log_id],
                     _("  I/O rank step:        %d\n"), block_rank_step);
+      if (_mpi_node_aggr)
+        cs_log_printf(logs[log_id],
+                      _("  I/O aggregation:      node-level, "
+                        "up to %d ranks per aggregator\n"),
+                      _mpi_node_aggr_step);
+    }
   }
 
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
@@ -270,6 +270,105 @@ void
 cs_file_set_swap_endian(cs_file_t  *f,
                         int         swap);
 
+/*----------------------------------------------------------------------------
+ * Return a read-only view of a memory-mapped file's contents.
+ *
+ * This is available only for files opened for reading with memory-mapped
+ * reads enabled (see cs_file_set_default_mmap_read()), using a standard
+ * IO access method allowing the calling rank to access the file
+ * (i.e. CS_FILE_STDIO_PARALLEL, or any standard IO method on a single rank).
+ *
+ * This function is local (non-collective); on ranks which have not
+ * accessed the file yet, it is opened and mapped. Pages of the file
+ * are only loaded when accessed.
+ *
+ * parameters:
+ *   f    <-> cs_file_t descriptor
+ *   size --> size of mapped contents, in bytes, or NULL
+ *
+ * returns:
+ *   pointer to start of mapped file contents, or NULL if not available
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_file_get_map(cs_file_t      *f,
+                cs_file_off_t  *size);
+
+/*----------------------------------------------------------------------------
+ * Return a read-only view of a range of a memory-mapped file's contents,
+ * with values in native endianness.
+ *
+ * The same conditions as for cs_file_get_map() apply. If no byte swapping
+ * is needed, the view simply points to the file's mapped contents.
+ * Otherwise, the pages containing the range are mapped again privately
+ * (copy-on-write), and values are byte-swapped in place, so neither the file
+ * nor its main mapping (used for reads) are modified. Such views remain
+ * valid until the file is closed.
+ *
+ * parameters:
+ *   f      <-> cs_file_t descriptor
+ *   offset <-- offset of first value in file, in bytes
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items
+ *
+ * returns:
+ *   pointer to the first value of the range, or NULL if not available
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_file_get_map_range(cs_file_t      *f,
+                      cs_file_off_t   offset,
+                      size_t          size,
+                      size_t          ni);
+
+/*----------------------------------------------------------------------------
+ * Allow or disallow asynchronous (non-blocking) block writes for a file.
+ *
+ * When allowed, block writes only start writing data, which is copied
+ * to staging buffers, and return without waiting for completion.
+ * Pending writes are completed at the latest when the file is closed.
+ *
+ * This is only possible with MPI-IO based access methods and explicit
+ * offsets positioning; in other cases, writes remain synchronous.
+ *
+ * parameters:
+ *   f     <-> cs_file_t descriptor
+ *   async <-- true if asynchronous writes are allowed
+ *
+ * returns:
+ *   true if asynchronous writes are active for this file
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_file_set_async_write(cs_file_t  *f,
+                        bool        async);
+
+/*----------------------------------------------------------------------------
+ * Release staging buffers of completed asynchronous writes.
+ *
+ * This function is local to each rank, and may be called regularly
+ * to ensure progress of pending writes.
+ *
+ * parameters:
+ *   f <-> cs_file_t descriptor
+ *
+ * returns:
+ *   number of local writes still pending
+ *----------------------------------------------------------------------------*/
+
+int
+cs_file_test_async_write(cs_file_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of a file's pending asynchronous writes.
+ *
+ * parameters:
+ *   f <-> cs_file_t descriptor
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_wait_async_write(cs_file_t  *f);
+
 /*----------------------------------------------------------------------------
  * Read global data from a file, distributing it to all processes
  * associated with that file.
@@ -529,6 +628,25 @@ cs_file_set_default_access(cs_file_mode_t    mode,
 
 #endif
 
+/*----------------------------------------------------------------------------
+ * Enable or disable memory-mapped reads for files opened for reading
+ * with standard IO access methods.
+ *
+ * When enabled, files opened for reading are mapped to memory by the ranks
+ * accessing them, so reads are simple copies from the mapped pages, which
+ * the operating system loads lazily, and read-only views of file sections
+ * may be obtained using cs_file_get_map().
+ *
+ * This setting applies to files opened after this call, and has no effect
+ * on systems where memory mapping is not available.
+ *
+ * parameters:
+ *   mmap_read <-- true to map files opened for reading to memory
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_mmap_read(bool  mmap_read);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -576,6 +694,24 @@ void
 cs_file_set_default_comm(int       block_rank_step,
                          MPI_Comm  comm);
 
+/*----------------------------------------------------------------------------
+ * Set default node-level aggregation for distributed file access.
+ *
+ * When active, ranks are grouped by compute node (as determined by
+ * MPI_Comm_split_type with MPI_COMM_TYPE_SHARED), and distributed block
+ * data is gathered on (or scattered from) the first rank of each group,
+ * which is the only one to access the file.
+ *
+ * This function is collective on the default file communicator, and
+ * requires MPI 3; otherwise, it has no effect.
+ *
+ * parameters:
+ *   node_aggr <-- true to activate node-level aggregation
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_node_aggregation(bool  node_aggr);
+
 /*----------------------------------------------------------------------------
  * Create an MPI communicator for distributed block parallel IO.
  *
@@ -34,6 +34,10 @@
 #include <string.h>
 #include <assert.h>
 
+#if defined(HAVE_MPI) && defined(HAVE_UNISTD_H)
+#include <sched.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -84,8 +88,57 @@ static int           _cs_glob_halo_request_size = 0;
 static MPI_Request  *_cs_glob_halo_request = NULL;
 static MPI_Status   *_cs_glob_halo_status = NULL;
 
+/* Number of requests of a pending split synchronization
+   (started with cs_halo_sync_var_strided_start()), or -1 if none */
+
+static int  _cs_glob_halo_n_pending_requests = -1;
+
+/* Intra-node shared memory exchange structure */
+
+struct _cs_halo_shm_t {
+
+  MPI_Comm   comm;              /* Node-local communicator */
+  MPI_Win    win;               /* Shared memory window */
+  int        rank;              /* Rank in node-local communicator */
+
+  size_t     elt_size_max;      /* Maximum element size (in bytes) for
+                                   exchanges through shared memory */
+
+  unsigned char  *buffer;       /* Local send buffer (in window) */
+
+  volatile unsigned long long  *ready;  /* Number of send buffers posted
+                                           for each node-local rank */
+  volatile unsigned long long  *ack;    /* Number of send buffers read
+                                           by each node-local rank */
+
+  int             *c_domain_shm_rank;   /* Node-local rank of each
+                                           communicating domain, or -1 */
+  cs_lnum_t       *c_domain_shift;      /* Start of local ghost values in
+                                           each domain's send buffer */
+
+  unsigned char   **c_domain_buffer;    /* Send buffer of each domain */
+
+  volatile unsigned long long  **c_domain_ready;  /* Posted counters of
+                                                     each domain */
+  volatile unsigned long long  **c_domain_ack;    /* Read counters of
+                                                     each domain */
+
+};
+
+/* Pending intra-node part of a split synchronization
+   (started with cs_halo_sync_var_strided_start()), if any */
+
+static const cs_halo_t  *_cs_glob_halo_shm_pending = NULL;
+static cs_lnum_t         _cs_glob_halo_shm_pending_end_shift = 0;
+static size_t            _cs_glob_halo_shm_pending_size = 0;
+static void             *_cs_glob_halo_shm_pending_val = NULL;
+
 #endif
 
+/* Should intra-node exchanges use shared memory when initialized ? */
+
+static bool _cs_glob_halo_use_shm = true;
+
 /* Buffer to save rotation halo values */
 
 static size_t  _cs_glob_halo_rot_backup_size = 0;
@@ -347,6 +400,231 @@ _zero_rotation_values(const cs_halo_t  *halo,
   }
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Synchronize public and private copies of a shared memory window.
+ *
+ * This is used as a memory barrier between writes and reads of
+ * shared send buffers and counters by different node-local ranks.
+ *
+ * parameters:
+ *   shm <-- pointer to halo shared memory structure
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_shm_win_sync(const cs_halo_shm_t  *shm)
+{
+#if (MPI_VERSION >= 3)
+  MPI_Win_sync(shm->win);
+#else
+  CS_UNUSED(shm);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Wait step for a node-local rank's shared memory counter update.
+ *
+ * The processor is yielded after a number of spins, so that waiting
+ * does not prevent progress when the node is oversubscribed.
+ *
+ * parameters:
+ *   shm     <-- pointer to halo shared memory structure
+ *   n_spins <-> number of spins since the processor was last yielded
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_shm_spin_wait(const cs_halo_shm_t  *shm,
+               int                  *n_spins)
+{
+  _shm_win_sync(shm);
+
+  *n_spins += 1;
+  if (*n_spins >= 64) {
+#if defined(HAVE_UNISTD_H)
+    sched_yield();
+#endif
+    *n_spins = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a halo shared memory structure.
+ *
+ * This function is collective on the node-local communicator.
+ *
+ * parameters:
+ *   shm <-> pointer to pointer to halo shared memory structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_shm_destroy(cs_halo_shm_t  **shm)
+{
+  cs_halo_shm_t  *_shm = *shm;
+
+#if (MPI_VERSION >= 3)
+  MPI_Win_unlock_all(_shm->win);
+  MPI_Win_free(&(_shm->win));
+#endif
+  MPI_Comm_free(&(_shm->comm));
+
+  BFT_FREE(_shm->c_domain_shm_rank);
+  BFT_FREE(_shm->c_domain_shift);
+  BFT_FREE(_shm->c_domain_buffer);
+  BFT_FREE(_shm->c_domain_ready);
+  BFT_FREE(_shm->c_domain_ack);
+
+  BFT_FREE(*shm);
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a halo synchronization with a given element size uses
+ * shared memory for node-local communicating ranks.
+ *
+ * Both sides of an exchange reach the same decision, as the maximum
+ * element size is identical on all ranks.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *   size <-- element size (in bytes)
+ *
+ * returns:
+ *   true if shared memory is used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_shm_use(const cs_halo_t  *halo,
+         size_t            size)
+{
+  return (halo->shm != NULL && size <= halo->shm->elt_size_max);
+}
+
+/*----------------------------------------------------------------------------
+ * Check if values are exchanged with a given communicating domain through
+ * shared memory.
+ *
+ * parameters:
+ *   halo    <-- pointer to halo structure
+ *   use_shm <-- true if shared memory is used for this synchronization
+ *   rank_id <-- id of communicating domain in halo
+ *
+ * returns:
+ *   true if shared memory is used for this domain, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_shm_is_local(const cs_halo_t  *halo,
+              bool              use_shm,
+              int               rank_id)
+{
+  return (use_shm && halo->shm->c_domain_shm_rank[rank_id] > -1);
+}
+
+/*----------------------------------------------------------------------------
+ * Wait until node-local ranks have read the previous contents of the
+ * shared send buffer, so that it may be overwritten.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_shm_wait_send_buffer(const cs_halo_t  *halo)
+{
+  cs_halo_shm_t  *shm = halo->shm;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    int r = shm->c_domain_shm_rank[rank_id];
+    if (r > -1) {
+      int n_spins = 0;
+      while (shm->ack[r] < shm->ready[r])
+        _shm_spin_wait(shm, &n_spins);
+    }
+  }
+
+  _shm_win_sync(shm);
+}
+
+/*----------------------------------------------------------------------------
+ * Signal to node-local ranks that the shared send buffer is ready.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_shm_post_send_buffer(const cs_halo_t  *halo)
+{
+  cs_halo_shm_t  *shm = halo->shm;
+
+  _shm_win_sync(shm);
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    int r = shm->c_domain_shm_rank[rank_id];
+    if (r > -1)
+      shm->ready[r] += 1;
+  }
+
+  _shm_win_sync(shm);
+}
+
+/*----------------------------------------------------------------------------
+ * Copy ghost values from the shared send buffers of node-local ranks.
+ *
+ * Each buffer is read once its owner has posted it, and its owner is
+ * then notified that it may be reused.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   end_shift <-- 1 for standard, 2 for extended synchronization
+ *   size      <-- element size (in bytes)
+ *   val       <-> pointer to array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_shm_copy_halo(const cs_halo_t  *halo,
+               cs_lnum_t         end_shift,
+               size_t            size,
+               void             *val)
+{
+  cs_halo_shm_t  *shm = halo->shm;
+  unsigned char *restrict _val = val;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (shm->c_domain_shm_rank[rank_id] < 0)
+      continue;
+
+    volatile unsigned long long *ready
+      = shm->c_domain_ready[rank_id] + shm->rank;
+    volatile unsigned long long *ack
+      = shm->c_domain_ack[rank_id] + shm->rank;
+
+    unsigned long long count = *ack + 1;
+    int n_spins = 0;
+
+    while (*ready < count)
+      _shm_spin_wait(shm, &n_spins);
+
+    _shm_win_sync(shm);
+
+    cs_lnum_t start = halo->index[2*rank_id];
+    cs_lnum_t length = halo->index[2*rank_id + end_shift] - start;
+
+    if (length > 0)
+      memcpy(_val + (halo->n_local_elts + start)*size,
+             shm->c_domain_buffer[rank_id] + shm->c_domain_shift[rank_id]*size,
+             length*size);
+
+    _shm_win_sync(shm);
+
+    *ack = count;
+
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -479,6 +757,8 @@ cs_halo_create(const cs_interface_set_t  *ifs)
 
   halo->send_list = NULL;
 
+  halo->shm = NULL;
+
   _cs_glob_n_halos += 1;
 
   return halo;
@@ -543,6 +823,8 @@ cs_halo_create_from_ref(const cs_halo_t  *ref)
 
   halo->send_list = NULL;
 
+  halo->shm = NULL;
+
   _cs_glob_n_halos += 1;
 
   return halo;
@@ -596,6 +878,8 @@ cs_halo_create_from_rank_neighbors(const cs_rank_neighbors_t  *rn,
   halo->send_perio_lst = NULL;
   halo->perio_lst = NULL;
 
+  halo->shm = NULL;
+
   halo->n_local_elts = n_local_elts;
 
   for (int i = 0; i < CS_HALO_N_TYPES; i++) {
@@ -802,6 +1086,11 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   cs_halo_t  *_halo = *halo;
 
+#if defined(HAVE_MPI)
+  if (_halo->shm != NULL)
+    _shm_destroy(&(_halo->shm));
+#endif
+
   BFT_FREE(_halo->c_domain_rank);
 
   BFT_FREE(_halo->send_perio_lst);
@@ -1163,7 +1452,9 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
     int rank_id;
     int request_count = 0;
-    unsigned char *build_buffer = (unsigned char *)_cs_glob_halo_send_buffer;
+    const bool use_shm = _shm_use(halo, size);
+    unsigned char *build_buffer = (use_shm) ?
+      halo->shm->buffer : (unsigned char *)_cs_glob_halo_send_buffer;
     const int local_rank = cs_glob_rank_id;
 
     /* Receive data from distant ranks */
@@ -1176,7 +1467,7 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
 
-        if (length > 0) {
+        if (length > 0 && !_shm_is_local(halo, use_shm, rank_id)) {
 
           unsigned char *dest = _val + (halo->n_local_elts*size) + start*size;
 
@@ -1200,6 +1491,9 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
        higher cost here, and even static scheduling might lead to
        false sharing for small halos. */
 
+    if (use_shm)
+      _shm_wait_send_buffer(halo);
+
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
@@ -1219,6 +1513,9 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
     }
 
+    if (use_shm)
+      _shm_post_send_buffer(halo);
+
     /* We wait for posting all receives (often recommended) */
 
     if (_cs_glob_halo_use_barrier)
@@ -1236,7 +1533,7 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
         length = (  halo->send_index[2*rank_id + end_shift]
                   - halo->send_index[2*rank_id]);
 
-        if (length > 0)
+        if (length > 0 && !_shm_is_local(halo, use_shm, rank_id))
           MPI_Isend(build_buffer + start*size,
                     length*size,
                     MPI_UNSIGNED_CHAR,
@@ -1249,7 +1546,10 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
     }
 
-    /* Wait for all exchanges */
+    /* Copy values from node-local ranks, then wait for all exchanges */
+
+    if (use_shm)
+      _shm_copy_halo(halo, end_shift, size, val);
 
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
@@ -1446,7 +1746,9 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
     int rank_id;
     int request_count = 0;
-    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+    const bool use_shm = _shm_use(halo, sizeof(cs_real_t));
+    cs_real_t *build_buffer = (use_shm) ?
+      (cs_real_t *)halo->shm->buffer : (cs_real_t *)_cs_glob_halo_send_buffer;
     const int local_rank = cs_glob_rank_id;
 
     /* Receive data from distant ranks */
@@ -1457,7 +1759,7 @@ cs_halo_sync_var(const cs_halo_t  *halo,
       length = halo->index[2*rank_id + end_shift] - halo->index[2*rank_id];
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
-        if (length > 0)
+        if (length > 0 && !_shm_is_local(halo, use_shm, rank_id))
           MPI_Irecv(var + halo->n_local_elts + start,
                     length,
                     CS_MPI_REAL,
@@ -1475,6 +1777,9 @@ cs_halo_sync_var(const cs_halo_t  *halo,
        scheduling led to slightly higher cost here, and even static scheduling
        might lead to false sharing for small halos. */
 
+    if (use_shm)
+      _shm_wait_send_buffer(halo);
+
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
@@ -1490,6 +1795,9 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
     }
 
+    if (use_shm)
+      _shm_post_send_buffer(halo);
+
     /* We wait for posting all receives (often recommended) */
 
     if (_cs_glob_halo_use_barrier)
@@ -1505,7 +1813,7 @@ cs_halo_sync_var(const cs_halo_t  *halo,
         length =   halo->send_index[2*rank_id + end_shift]
                  - halo->send_index[2*rank_id];
 
-        if (length > 0)
+        if (length > 0 && !_shm_is_local(halo, use_shm, rank_id))
           MPI_Isend(build_buffer + start,
                     length,
                     CS_MPI_REAL,
@@ -1518,7 +1826,10 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
     }
 
-    /* Wait for all exchanges */
+    /* Copy values from node-local ranks, then wait for all exchanges */
+
+    if (use_shm)
+      _shm_copy_halo(halo, end_shift, sizeof(cs_real_t), var);
 
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
@@ -1547,12 +1858,18 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 }
 
 /*----------------------------------------------------------------------------
- * Update array of strided variable (floating-point) values in case
+ * Start update of array of strided variable (floating-point) values in case
  * of parallelism or periodicity.
  *
- * This function aims at copying main values from local elements
- * (id between 1 and n_local_elements) to ghost elements on distant ranks
- * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ * Receives and sends are posted and local periodic values are copied,
+ * but completion of the exchange with distant ranks is deferred to
+ * cs_halo_sync_wait(), so that computations not depending on ghost values
+ * may be overlapped with communication.
+ *
+ * Only one split synchronization may be pending at a given time, and
+ * no other halo synchronization may be called before the matching call
+ * to cs_halo_sync_wait(). Until then, ghost values of var received from
+ * distant ranks must not be accessed.
  *
  * parameters:
  *   halo      <-- pointer to halo structure
@@ -1562,16 +1879,21 @@ cs_halo_sync_var(const cs_halo_t  *halo,
  *----------------------------------------------------------------------------*/
 
 void
-cs_halo_sync_var_strided(const cs_halo_t  *halo,
-                         cs_halo_type_t    sync_mode,
-                         cs_real_t         var[],
-                         int               stride)
+cs_halo_sync_var_strided_start(const cs_halo_t  *halo,
+                               cs_halo_type_t    sync_mode,
+                               cs_real_t         var[],
+                               int               stride)
 {
   cs_lnum_t i, j, start, length;
 
   cs_lnum_t end_shift = 0;
   int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
 
+#if defined(HAVE_MPI)
+  assert(_cs_glob_halo_n_pending_requests < 0);
+  assert(_cs_glob_halo_shm_pending == NULL);
+#endif
+
   if (stride > _cs_glob_halo_max_stride)
     _cs_glob_halo_max_stride = stride;
   cs_halo_update_buffers(halo);
@@ -1588,7 +1910,9 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
     int rank_id;
     int request_count = 0;
-    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+    const bool use_shm = _shm_use(halo, stride*sizeof(cs_real_t));
+    cs_real_t *build_buffer = (use_shm) ?
+      (cs_real_t *)halo->shm->buffer : (cs_real_t *)_cs_glob_halo_send_buffer;
     cs_real_t *buffer = NULL;
     const int local_rank = cs_glob_rank_id;
 
@@ -1601,7 +1925,7 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
 
-        if (length > 0) {
+        if (length > 0 && !_shm_is_local(halo, use_shm, rank_id)) {
 
           buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
 
@@ -1624,6 +1948,9 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
        scheduling led to slightly higher cost here, and even static scheduling
        might lead to false sharing for small halos. */
 
+    if (use_shm)
+      _shm_wait_send_buffer(halo);
+
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
@@ -1654,6 +1981,9 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
     }
 
+    if (use_shm)
+      _shm_post_send_buffer(halo);
+
     /* We wait for posting all receives (often recommended) */
 
     if (_cs_glob_halo_use_barrier)
@@ -1671,7 +2001,7 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
         length = (  halo->send_index[2*rank_id + end_shift]
                   - halo->send_index[2*rank_id]);
 
-        if (length > 0)
+        if (length > 0 && !_shm_is_local(halo, use_shm, rank_id))
           MPI_Isend(build_buffer + start*stride,
                     length*stride,
                     CS_MPI_REAL,
@@ -1684,9 +2014,17 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
     }
 
-    /* Wait for all exchanges */
+    /* Completion of exchanges (including copies from node-local ranks)
+       is deferred to cs_halo_sync_wait() */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _cs_glob_halo_n_pending_requests = request_count;
+
+    if (use_shm) {
+      _cs_glob_halo_shm_pending = halo;
+      _cs_glob_halo_shm_pending_end_shift = end_shift;
+      _cs_glob_halo_shm_pending_size = stride*sizeof(cs_real_t);
+      _cs_glob_halo_shm_pending_val = var;
+    }
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1724,6 +2062,65 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Complete a halo synchronization started with
+ * cs_halo_sync_var_strided_start().
+ *
+ * If no split synchronization is pending, this function does nothing.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_wait(void)
+{
+#if defined(HAVE_MPI)
+
+  if (_cs_glob_halo_n_pending_requests > -1) {
+
+    if (_cs_glob_halo_shm_pending != NULL) {
+      _shm_copy_halo(_cs_glob_halo_shm_pending,
+                     _cs_glob_halo_shm_pending_end_shift,
+                     _cs_glob_halo_shm_pending_size,
+                     _cs_glob_halo_shm_pending_val);
+      _cs_glob_halo_shm_pending = NULL;
+      _cs_glob_halo_shm_pending_val = NULL;
+    }
+
+    MPI_Waitall(_cs_glob_halo_n_pending_requests,
+                _cs_glob_halo_request,
+                _cs_glob_halo_status);
+
+    _cs_glob_halo_n_pending_requests = -1;
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Update array of strided variable (floating-point) values in case
+ * of parallelism or periodicity.
+ *
+ * This function aims at copying main values from local elements
+ * (id between 1 and n_local_elements) to ghost elements on distant ranks
+ * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_strided(const cs_halo_t  *halo,
+                         cs_halo_type_t    sync_mode,
+                         cs_real_t         var[],
+                         int               stride)
+{
+  cs_halo_sync_var_strided_start(halo, sync_mode, var, stride);
+  cs_halo_sync_wait();
+}
+
 /*----------------------------------------------------------------------------
  * Update array of vector variable component (floating-point) halo values
  * in case of parallelism or periodicity.
@@ -1847,6 +2244,208 @@ cs_halo_set_use_barrier(bool use_barrier)
   _cs_glob_halo_use_barrier = use_barrier;
 }
 
+/*----------------------------------------------------------------------------
+ * Return shared memory exchange usage flag.
+ *
+ * returns:
+ *   true if halos initialized with cs_halo_init_shared_memory() exchange
+ *   data with ranks on the same node through shared memory,
+ *   false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_shared_memory(void)
+{
+  return _cs_glob_halo_use_shm;
+}
+
+/*----------------------------------------------------------------------------
+ * Set shared memory exchange usage flag.
+ *
+ * This setting only applies to halos for which cs_halo_init_shared_memory()
+ * is called after it.
+ *
+ * parameters:
+ *   use_shm <-- true if data should be exchanged with ranks on the same
+ *               node through shared memory, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_shared_memory(bool use_shm)
+{
+  _cs_glob_halo_use_shm = use_shm;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize intra-node shared memory exchanges for a halo.
+ *
+ * Ranks sharing a node are determined using MPI_Comm_split_type,
+ * and each rank exposes its halo send buffer through an MPI-3 shared
+ * memory window, so that ranks on the same node copy ghost values
+ * directly from their neighbor's buffer; MPI messages are only used
+ * for neighbors on other nodes.
+ *
+ * Synchronizations with an element size larger than that of real values
+ * with the maximum stride at initialization (3 by default) still use MPI.
+ *
+ * This function is collective on cs_glob_mpi_comm, so it should be
+ * called only for halos which are built on all ranks, such as the
+ * main mesh halo.
+ *
+ * parameters:
+ *   halo <-> pointer to halo structure
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_init_shared_memory(cs_halo_t  *halo)
+{
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  if (   halo == NULL || halo->shm != NULL
+      || cs_glob_n_ranks < 2 || _cs_glob_halo_use_shm == false)
+    return;
+
+  MPI_Comm node_comm;
+  int node_size;
+
+  MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED,
+                      cs_glob_rank_id, MPI_INFO_NULL, &node_comm);
+  MPI_Comm_size(node_comm, &node_size);
+
+  if (node_size < 2) {
+    MPI_Comm_free(&node_comm);
+    return;
+  }
+
+  const int n_c_domains = halo->n_c_domains;
+  const int local_rank = cs_glob_rank_id;
+
+  cs_halo_shm_t *shm;
+  BFT_MALLOC(shm, 1, cs_halo_shm_t);
+
+  shm->comm = node_comm;
+  MPI_Comm_rank(node_comm, &(shm->rank));
+
+  shm->elt_size_max = _cs_glob_halo_max_stride * sizeof(cs_real_t);
+
+  /* Node-local rank of communicating domains */
+
+  MPI_Group glob_group, node_group;
+
+  MPI_Comm_group(cs_glob_mpi_comm, &glob_group);
+  MPI_Comm_group(node_comm, &node_group);
+
+  BFT_MALLOC(shm->c_domain_shm_rank, n_c_domains, int);
+
+  MPI_Group_translate_ranks(glob_group, n_c_domains, halo->c_domain_rank,
+                            node_group, shm->c_domain_shm_rank);
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+    if (   shm->c_domain_shm_rank[rank_id] == MPI_UNDEFINED
+        || halo->c_domain_rank[rank_id] == local_rank)
+      shm->c_domain_shm_rank[rank_id] = -1;
+  }
+
+  MPI_Group_free(&node_group);
+  MPI_Group_free(&glob_group);
+
+  /* Shared window: posted and read counters for each node-local rank,
+     followed by the send buffer */
+
+  size_t counters_size = 2*node_size*sizeof(unsigned long long);
+  MPI_Aint win_size =   counters_size
+                      + halo->n_send_elts[CS_HALO_EXTENDED]*shm->elt_size_max;
+  void *base = NULL;
+
+  MPI_Win_allocate_shared(win_size, 1, MPI_INFO_NULL, node_comm,
+                          &base, &(shm->win));
+
+  shm->ready = base;
+  shm->ack = shm->ready + node_size;
+  shm->buffer = (unsigned char *)base + counters_size;
+
+  for (int i = 0; i < 2*node_size; i++)
+    shm->ready[i] = 0;
+
+  BFT_MALLOC(shm->c_domain_buffer, n_c_domains, unsigned char *);
+  BFT_MALLOC(shm->c_domain_ready, n_c_domains,
+             volatile unsigned long long *);
+  BFT_MALLOC(shm->c_domain_ack, n_c_domains,
+             volatile unsigned long long *);
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    shm->c_domain_buffer[rank_id] = NULL;
+    shm->c_domain_ready[rank_id] = NULL;
+    shm->c_domain_ack[rank_id] = NULL;
+
+    if (shm->c_domain_shm_rank[rank_id] > -1) {
+      MPI_Aint r_size;
+      int r_disp_unit;
+      void *r_base = NULL;
+      MPI_Win_shared_query(shm->win, shm->c_domain_shm_rank[rank_id],
+                           &r_size, &r_disp_unit, &r_base);
+      shm->c_domain_ready[rank_id] = r_base;
+      shm->c_domain_ack[rank_id] = shm->c_domain_ready[rank_id] + node_size;
+      shm->c_domain_buffer[rank_id]
+        = (unsigned char *)r_base + counters_size;
+    }
+
+  }
+
+  /* Exchange start of ghost values in send buffers with node-local ranks */
+
+  int request_count = 0;
+  MPI_Request *request;
+
+  BFT_MALLOC(shm->c_domain_shift, n_c_domains, cs_lnum_t);
+  BFT_MALLOC(request, n_c_domains*2, MPI_Request);
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+    shm->c_domain_shift[rank_id] = 0;
+    if (shm->c_domain_shm_rank[rank_id] > -1)
+      MPI_Irecv(shm->c_domain_shift + rank_id,
+                1,
+                CS_MPI_LNUM,
+                halo->c_domain_rank[rank_id],
+                halo->c_domain_rank[rank_id],
+                cs_glob_mpi_comm,
+                &(request[request_count++]));
+  }
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+    if (shm->c_domain_shm_rank[rank_id] > -1)
+      MPI_Isend(halo->send_index + 2*rank_id,
+                1,
+                CS_MPI_LNUM,
+                halo->c_domain_rank[rank_id],
+                local_rank,
+                cs_glob_mpi_comm,
+                &(request[request_count++]));
+  }
+
+  MPI_Waitall(request_count, request, MPI_STATUSES_IGNORE);
+
+  BFT_FREE(request);
+
+  /* Open a passive target epoch for the lifetime of the window;
+     the barrier ensures counters are initialized on all node-local
+     ranks before they are used */
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, shm->win);
+  MPI_Win_sync(shm->win);
+  MPI_Barrier(node_comm);
+  MPI_Win_sync(shm->win);
+
+  halo->shm = shm;
+
+#else
+
+  CS_UNUSED(halo);
+
+#endif /* defined(HAVE_MPI) && (MPI_VERSION >= 3) */
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
@@ -65,6 +65,10 @@ typedef enum {
 
 } cs_halo_rotation_t ;
 
+/* Opaque structure for intra-node (shared memory) exchanges */
+
+typedef struct _cs_halo_shm_t cs_halo_shm_t;
+
 /* Structure for halo management */
 /* ----------------------------- */
 
@@ -152,6 +156,10 @@ typedef struct {
 
   */
 
+  cs_halo_shm_t  *shm;      /* Shared memory exchange structure for
+                               communicating ranks on the same node,
+                               or NULL if not used */
+
 } cs_halo_t;
 
 /*=============================================================================
@@ -372,6 +380,43 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
                          cs_real_t         var[],
                          int               stride);
 
+/*----------------------------------------------------------------------------
+ * Start update of array of strided variable (floating-point) values in case
+ * of parallelism or periodicity.
+ *
+ * Receives and sends are posted and local periodic values are copied,
+ * but completion of the exchange with distant ranks is deferred to
+ * cs_halo_sync_wait(), so that computations not depending on ghost values
+ * may be overlapped with communication.
+ *
+ * Only one split synchronization may be pending at a given time, and
+ * no other halo synchronization may be called before the matching call
+ * to cs_halo_sync_wait(). Until then, ghost values of var received from
+ * distant ranks must not be accessed.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_strided_start(const cs_halo_t  *halo,
+                               cs_halo_type_t    sync_mode,
+                               cs_real_t         var[],
+                               int               stride);
+
+/*----------------------------------------------------------------------------
+ * Complete a halo synchronization started with
+ * cs_halo_sync_var_strided_start().
+ *
+ * If no split synchronization is pending, this function does nothing.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_wait(void);
+
 /*----------------------------------------------------------------------------
  * Update array of vector variable component (floating-point) halo values
  * in case of parallelism or periodicity.
@@ -460,6 +505,55 @@ cs_halo_get_use_barrier(void);
 void
 cs_halo_set_use_barrier(bool use_barrier);
 
+/*----------------------------------------------------------------------------
+ * Return shared memory exchange usage flag.
+ *
+ * returns:
+ *   true if halos initialized with cs_halo_init_shared_memory() exchange
+ *   data with ranks on the same node through shared memory,
+ *   false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_shared_memory(void);
+
+/*----------------------------------------------------------------------------
+ * Set shared memory exchange usage flag.
+ *
+ * This setting only applies to halos for which cs_halo_init_shared_memory()
+ * is called after it.
+ *
+ * parameters:
+ *   use_shm <-- true if data should be exchanged with ranks on the same
+ *               node through shared memory, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_shared_memory(bool use_shm);
+
+/*----------------------------------------------------------------------------
+ * Initialize intra-node shared memory exchanges for a halo.
+ *
+ * Ranks sharing a node are determined using MPI_Comm_split_type,
+ * and each rank exposes its halo send buffer through an MPI-3 shared
+ * memory window, so that ranks on the same node copy ghost values
+ * directly from their neighbor's buffer; MPI messages are only used
+ * for neighbors on other nodes.
+ *
+ * Synchronizations with an element size larger than that of real values
+ * with the maximum stride at initialization (3 by default) still use MPI.
+ *
+ * This function is collective on cs_glob_mpi_comm, so it should be
+ * called only for halos which are built on all ranks, such as the
+ * main mesh halo.
+ *
+ * parameters:
+ *   halo <-> pointer to halo structure
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_init_shared_memory(cs_halo_t  *halo);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
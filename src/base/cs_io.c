@@ -40,6 +40,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 #undef HAVE_STDINT_H
 #if defined(__STDC_VERSION__)
 #  if (__STDC_VERSION__ >= 199901L)
@@ -119,6 +123,10 @@ typedef struct {
   cs_file_off_t  *offset;            /* Position of associated data
                                         in file (-1 if embedded) */
 
+  cs_file_off_t  *comp;              /* Compression mode, number of chunks,
+                                        and compressed body size for each
+                                        entry (all 0 if not compressed) */
+
   size_t          max_names_size;    /* Maximum size of names array */
   size_t          names_size;        /* Current size of names array */
   char           *names;             /* Array containing section names */
@@ -162,6 +170,15 @@ struct _cs_io_t {
   char               *type_name;      /* Pointer to type in section header */
   void               *data;           /* Pointer to data in section header
                                          (if embedded; NULL otherwise) */
+  cs_file_off_t       comp_vals[3];   /* Compression mode, number of chunks,
+                                         and compressed body size for
+                                         current section (0 if none) */
+
+  /* Compression options (on write) */
+
+  cs_io_compression_t compression;    /* Section compression mode */
+  double              comp_tolerance; /* Absolute error bound for lossy
+                                         compression */
 
   /* Other flags */
 
@@ -180,6 +197,10 @@ struct _cs_io_t {
 
 #define CS_IO_MPI_TAG     'C'+'S'+'_'+'I'+'O'
 
+/* Minimum section body size (in bytes) for compression */
+
+#define CS_IO_COMP_MIN_SIZE  1024
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -193,6 +214,10 @@ static char  _type_name_u8[] =   "u8";  /* Unsigned 64 bit integer */
 static char  _type_name_r4[] =   "r4";  /* Single precision real */
 static char  _type_name_r8[] =   "r8";  /* Double precsision real */
 
+#if defined(HAVE_ZLIB)
+static int  _cs_io_zlib_level = 1;      /* Favor speed over ratio */
+#endif
+
 /* Logging */
 
 static int _cs_io_map_size[2] = {0, 0};
@@ -410,6 +435,12 @@ _cs_io_create(cs_io_mode_t   mode,
   cs_io->type_name = NULL;
   cs_io->data = NULL;
 
+  for (int i = 0; i < 3; i++)
+    cs_io->comp_vals[i] = 0;
+
+  cs_io->compression = CS_IO_COMPRESSION_NONE;
+  cs_io->comp_tolerance = 0.;
+
   /* Verbosity and logging */
 
   cs_io->echo = echo;
@@ -444,6 +475,7 @@ _create_index(cs_io_t *inp)
 
   BFT_MALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
   BFT_MALLOC(idx->offset, idx->max_size, cs_file_off_t);
+  BFT_MALLOC(idx->comp, idx->max_size*3, cs_file_off_t);
 
   idx->max_names_size = 256;
   idx->names_size = 0;
@@ -477,6 +509,7 @@ _destroy_index(cs_io_t *inp)
 
   BFT_FREE(idx->h_vals);
   BFT_FREE(idx->offset);
+  BFT_FREE(idx->comp);
   BFT_FREE(idx->names);
   BFT_FREE(idx->data);
 
@@ -515,6 +548,7 @@ _update_index_and_shift(cs_io_t             *inp,
       idx->max_size *= 2;
     BFT_REALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
     BFT_REALLOC(idx->offset, idx->max_size, cs_file_off_t);
+    BFT_REALLOC(idx->comp, idx->max_size*3, cs_file_off_t);
   };
 
   new_names_size = idx->names_size + strlen(inp->sec_name) + 1;
@@ -552,6 +586,9 @@ _update_index_and_shift(cs_io_t             *inp,
   idx->h_vals[id*7 + 5] = 0;
   idx->h_vals[id*7 + 6] = header->type_read;
 
+  for (int i = 0; i < 3; i++)
+    idx->comp[id*3 + i] = inp->comp_vals[i];
+
   strcpy(idx->names + idx->names_size, inp->sec_name);
   idx->names[new_names_size - 1] = '\0';
   idx->names_size = new_names_size;
@@ -559,6 +596,8 @@ _update_index_and_shift(cs_io_t             *inp,
   if (inp->data == NULL) {
     cs_file_off_t offset = cs_file_tell(inp->f);
     cs_file_off_t data_shift = inp->n_vals * inp->type_size;
+    if (inp->comp_vals[0] != CS_IO_COMPRESSION_NONE)
+      data_shift = inp->comp_vals[2];
     if (inp->body_align > 0) {
       size_t ba = inp->body_align;
       idx->offset[id] = offset + (ba - (offset % ba)) % ba;
@@ -1259,6 +1298,484 @@ _cs_io_convert_read(void           *buffer,
   }
 }
 
+#if defined(HAVE_ZLIB)
+
+/*----------------------------------------------------------------------------
+ * Shuffle bytes of an array so that bytes of same significance are
+ * contiguous, which usually improves deflate compression of numerical data.
+ *
+ * parameters:
+ *   src    <-- source values
+ *   dest   --> shuffled bytes
+ *   size   <-- size of each value
+ *   n_vals <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_byte_shuffle(const unsigned char  *src,
+              unsigned char        *dest,
+              size_t                size,
+              size_t                n_vals)
+{
+  for (size_t i = 0; i < n_vals; i++) {
+    for (size_t j = 0; j < size; j++)
+      dest[j*n_vals + i] = src[i*size + j];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Reverse the byte shuffling of _byte_shuffle().
+ *
+ * parameters:
+ *   src    <-- shuffled bytes
+ *   dest   --> values
+ *   size   <-- size of each value
+ *   n_vals <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_byte_unshuffle(const unsigned char  *src,
+                unsigned char        *dest,
+                size_t                size,
+                size_t                n_vals)
+{
+  for (size_t i = 0; i < n_vals; i++) {
+    for (size_t j = 0; j < size; j++)
+      dest[i*size + j] = src[j*n_vals + i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compress a block of values.
+ *
+ * The compressed block starts with a 1-byte mode flag: 0 for raw values,
+ * 1 for quantized values, in which case the flag is followed by the
+ * quantization step. Quantized values are stored as zigzag-encoded
+ * 64-bit differences between successive values. The resulting bytes
+ * are shuffled and deflated.
+ *
+ * Lossy compression falls back to raw values for blocks containing
+ * non-finite values or values too large for the quantization step.
+ *
+ * parameters:
+ *   elts        <-- values (native endianness)
+ *   elt_type    <-- datatype of values
+ *   n_vals      <-- number of values
+ *   compression <-- compression mode
+ *   tolerance   <-- absolute error bound for lossy compression
+ *   swap        <-- true if bytes must be swapped to file endianness
+ *   file_name   <-- associated file name, for error messages
+ *   c_size      --> size of compressed block
+ *
+ * returns:
+ *   pointer to newly allocated compressed block, or NULL if empty
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_compress_block(const void           *elts,
+                cs_datatype_t         elt_type,
+                size_t                n_vals,
+                cs_io_compression_t   compression,
+                double                tolerance,
+                bool                  swap,
+                const char           *file_name,
+                size_t               *c_size)
+{
+  unsigned char  mode = 0;
+  size_t  size = cs_datatype_size[elt_type];
+  double  step = 2.*tolerance;
+  unsigned char  *r_buf = NULL, *s_buf = NULL, *c_buf = NULL;
+
+  *c_size = 0;
+
+  if (n_vals == 0)
+    return NULL;
+
+  /* Quantize floating-point values if possible */
+
+  if (   compression == CS_IO_COMPRESSION_LOSSY && step > 0
+      && (elt_type == CS_FLOAT || elt_type == CS_DOUBLE)) {
+
+    const double q_max = 2305843009213693952.; /* 2^61 */
+    int64_t q_prev = 0;
+    uint64_t *q = NULL;
+
+    BFT_MALLOC(q, n_vals, uint64_t);
+
+    mode = 1;
+
+    for (size_t i = 0; i < n_vals; i++) {
+      double v = (elt_type == CS_FLOAT) ?
+        ((const float *)elts)[i] : ((const double *)elts)[i];
+      double r = v / step;
+      if (!(r > -q_max && r < q_max)) { /* also handles NaN */
+        mode = 0;
+        break;
+      }
+      int64_t q_i = (r < 0) ? -(int64_t)(-r + 0.5) : (int64_t)(r + 0.5);
+      int64_t d = q_i - q_prev;
+      q_prev = q_i;
+      q[i] = (d < 0) ? ((~(uint64_t)d) << 1) | 1 : ((uint64_t)d) << 1;
+    }
+
+    if (mode == 1) {
+      r_buf = (unsigned char *)q;
+      size = 8;
+    }
+    else
+      BFT_FREE(q);
+
+  }
+
+  if (mode == 0) {
+    BFT_MALLOC(r_buf, n_vals*size, unsigned char);
+    memcpy(r_buf, elts, n_vals*size);
+  }
+
+  if (swap && size > 1)
+    _swap_endian(r_buf, size, n_vals);
+
+  /* Shuffle and deflate */
+
+  size_t r_size = n_vals*size;
+  size_t h_size = (mode == 1) ? 9 : 1;
+  uLongf z_size = compressBound(r_size);
+
+  BFT_MALLOC(s_buf, r_size, unsigned char);
+  _byte_shuffle(r_buf, s_buf, size, n_vals);
+  BFT_FREE(r_buf);
+
+  BFT_MALLOC(c_buf, h_size + z_size, unsigned char);
+
+  c_buf[0] = mode;
+  if (mode == 1) {
+    memcpy(c_buf + 1, &step, 8);
+    if (swap)
+      _swap_endian(c_buf + 1, 8, 1);
+  }
+
+  int retval = compress2(c_buf + h_size, &z_size, s_buf, r_size,
+                         _cs_io_zlib_level);
+
+  if (retval != Z_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error compressing %llu bytes for file \"%s\":\n"
+                "zlib error code %d."),
+              (unsigned long long)r_size, file_name, retval);
+
+  BFT_FREE(s_buf);
+
+  *c_size = h_size + z_size;
+  BFT_REALLOC(c_buf, *c_size, unsigned char);
+
+  return c_buf;
+}
+
+/*----------------------------------------------------------------------------
+ * Decompress a block of values compressed by _compress_block().
+ *
+ * parameters:
+ *   c_buf     <-- compressed block
+ *   c_size    <-- size of compressed block
+ *   type_read <-- datatype of values in file
+ *   n_vals    <-- number of values
+ *   swap      <-- true if bytes must be swapped from file endianness
+ *   file_name <-- associated file name, for error messages
+ *   elts      --> values (native endianness)
+ *----------------------------------------------------------------------------*/
+
+static void
+_decompress_block(const unsigned char  *c_buf,
+                  size_t                c_size,
+                  cs_datatype_t         type_read,
+                  size_t                n_vals,
+                  bool                  swap,
+                  const char           *file_name,
+                  void                 *elts)
+{
+  size_t  size = cs_datatype_size[type_read];
+  size_t  h_size = 1;
+  double  step = 0.;
+  unsigned char  *r_buf = elts, *s_buf = NULL;
+
+  if (n_vals == 0)
+    return;
+
+  unsigned char mode = c_buf[0];
+
+  if (mode == 1) {
+    memcpy(&step, c_buf + 1, 8);
+    if (swap)
+      _swap_endian(&step, 8, 1);
+    h_size = 9;
+    size = 8;
+    BFT_MALLOC(r_buf, n_vals*size, unsigned char);
+  }
+
+  uLongf r_size = n_vals*size;
+
+  BFT_MALLOC(s_buf, r_size, unsigned char);
+
+  int retval = uncompress(s_buf, &r_size, c_buf + h_size, c_size - h_size);
+
+  if (retval != Z_OK || r_size != n_vals*size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error decompressing data from file \"%s\":\n"
+                "zlib error code %d."),
+              file_name, retval);
+
+  _byte_unshuffle(s_buf, r_buf, size, n_vals);
+  BFT_FREE(s_buf);
+
+  if (swap && size > 1)
+    _swap_endian(r_buf, size, n_vals);
+
+  /* Rebuild quantized values */
+
+  if (mode == 1) {
+
+    const uint64_t *q = (const uint64_t *)r_buf;
+    int64_t q_i = 0;
+
+    for (size_t i = 0; i < n_vals; i++) {
+      int64_t d = (q[i] & 1) ? -(int64_t)(q[i] >> 1) - 1 : (int64_t)(q[i] >> 1);
+      q_i += d;
+      if (type_read == CS_FLOAT)
+        ((float *)elts)[i] = q_i*step;
+      else
+        ((double *)elts)[i] = q_i*step;
+    }
+
+    BFT_FREE(r_buf);
+  }
+}
+
+#endif /* defined(HAVE_ZLIB) */
+
+/*----------------------------------------------------------------------------
+ * Read a compressed section body.
+ *
+ * The body contains a table of (cumulative) value and byte counts for each
+ * compressed chunk, followed by the chunks. In block mode, each chunk is
+ * read and decompressed by the rank whose block contains its first value,
+ * so that file accesses remain contiguous, and values are then
+ * redistributed to the requesting ranks.
+ *
+ * The file read pointer must be positioned at the start of the body.
+ *
+ * parameters:
+ *   type_read        <-- datatype of values in file
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *                        or 0 for global read
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering) or 0 for global read
+ *   stride           <-- number of values per block item
+ *   buf              --> buffer receiving values (native endianness)
+ *   inp              <-> input kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_compressed_body(cs_datatype_t  type_read,
+                      cs_gnum_t      global_num_start,
+                      cs_gnum_t      global_num_end,
+                      size_t         stride,
+                      void          *buf,
+                      cs_io_t       *inp)
+{
+#if defined(HAVE_ZLIB)
+
+  size_t type_size = cs_datatype_size[type_read];
+  bool swap = (cs_file_get_swap_endian(inp->f) == 1) ? true : false;
+  const char *file_name = cs_file_get_name(inp->f);
+  cs_file_off_t n_chunks = inp->comp_vals[1];
+  cs_file_off_t body_end = cs_file_tell(inp->f) + inp->comp_vals[2];
+
+  /* Chunk table, with an added leading zero entry */
+
+  uint64_t *c_idx = NULL;
+  BFT_MALLOC(c_idx, n_chunks*2 + 2, uint64_t);
+  c_idx[0] = 0;
+  c_idx[1] = 0;
+
+  cs_file_read_global(inp->f, c_idx + 2, 8, n_chunks*2);
+
+  unsigned char *c_buf = NULL;
+
+  /* Global read: all ranks decompress all chunks */
+
+  if (global_num_start == 0 && global_num_end == 0) {
+
+    size_t c_size = c_idx[n_chunks*2 + 1];
+
+    BFT_MALLOC(c_buf, c_size, unsigned char);
+    cs_file_read_global(inp->f, c_buf, 1, c_size);
+
+    for (cs_file_off_t c_id = 0; c_id < n_chunks; c_id++)
+      _decompress_block(c_buf + c_idx[c_id*2 + 1],
+                        c_idx[c_id*2 + 3] - c_idx[c_id*2 + 1],
+                        type_read,
+                        c_idx[c_id*2 + 2] - c_idx[c_id*2],
+                        swap,
+                        file_name,
+                        (unsigned char *)buf + c_idx[c_id*2]*type_size);
+
+  }
+
+  /* Block read */
+
+  else {
+
+    int rank_id = 0, n_ranks = 1;
+
+#if defined(HAVE_MPI)
+    if (inp->comm != MPI_COMM_NULL) {
+      MPI_Comm_rank(inp->comm, &rank_id);
+      MPI_Comm_size(inp->comm, &n_ranks);
+    }
+#endif
+
+    cs_gnum_t *v_range;
+    BFT_MALLOC(v_range, n_ranks*2, cs_gnum_t);
+
+    v_range[rank_id*2] = (global_num_start - 1)*stride;
+    v_range[rank_id*2 + 1] = (global_num_end - 1)*stride;
+
+#if defined(HAVE_MPI)
+    if (n_ranks > 1)
+      MPI_Allgather(v_range + rank_id*2, 2, CS_MPI_GNUM,
+                    v_range, 2, CS_MPI_GNUM, inp->comm);
+#endif
+
+    /* Chunks are assigned to the last rank with a non-empty range starting
+       at or before their first value (or the first rank with a non-empty
+       range), so each rank reads a contiguous range of chunks, in rank
+       order; c_range[i] is the id of the first chunk read by rank i */
+
+    cs_gnum_t *c_range;
+    BFT_MALLOC(c_range, n_ranks + 1, cs_gnum_t);
+    for (int i = 0; i < n_ranks + 1; i++)
+      c_range[i] = 0;
+
+    int r_id = 0;
+    while (r_id < n_ranks && v_range[r_id*2 + 1] <= v_range[r_id*2])
+      r_id++;
+    if (r_id == n_ranks)
+      r_id = 0;
+
+    int r_next = r_id + 1;
+    for (cs_file_off_t c_id = 0; c_id < n_chunks; c_id++) {
+      for (; r_next < n_ranks; r_next++) {
+        if (v_range[r_next*2 + 1] <= v_range[r_next*2])
+          continue;
+        if (v_range[r_next*2] <= c_idx[c_id*2])
+          r_id = r_next;
+        else
+          break;
+      }
+      c_range[r_id + 1] += 1;
+    }
+
+    for (int i = 0; i < n_ranks; i++)
+      c_range[i+1] += c_range[i];
+
+    /* Read and decompress local chunks */
+
+    cs_gnum_t c_s = c_range[rank_id], c_e = c_range[rank_id + 1];
+    cs_gnum_t d_start = c_idx[c_s*2], d_end = c_idx[c_e*2];
+    cs_gnum_t b_start = c_idx[c_s*2 + 1], b_end = c_idx[c_e*2 + 1];
+
+    unsigned char *d_buf = NULL;
+
+    BFT_MALLOC(c_buf, b_end - b_start, unsigned char);
+    BFT_MALLOC(d_buf, (d_end - d_start)*type_size, unsigned char);
+
+    cs_file_read_block(inp->f, c_buf, 1, 1, b_start + 1, b_end + 1);
+
+    for (cs_gnum_t c_id = c_s; c_id < c_e; c_id++)
+      _decompress_block(c_buf + (c_idx[c_id*2 + 1] - b_start),
+                        c_idx[c_id*2 + 3] - c_idx[c_id*2 + 1],
+                        type_read,
+                        c_idx[c_id*2 + 2] - c_idx[c_id*2],
+                        swap,
+                        file_name,
+                        d_buf + (c_idx[c_id*2] - d_start)*type_size);
+
+    /* Copy or redistribute values to requesting ranks */
+
+    cs_gnum_t v_start = v_range[rank_id*2], v_end = v_range[rank_id*2 + 1];
+
+    if (n_ranks == 1) {
+      if (v_end > v_start)
+        memcpy(buf,
+               d_buf + (v_start - d_start)*type_size,
+               (v_end - v_start)*type_size);
+    }
+
+#if defined(HAVE_MPI)
+
+    else {
+
+      int *send_count, *send_shift, *recv_count, *recv_shift;
+      BFT_MALLOC(send_count, n_ranks, int);
+      BFT_MALLOC(send_shift, n_ranks, int);
+      BFT_MALLOC(recv_count, n_ranks, int);
+      BFT_MALLOC(recv_shift, n_ranks, int);
+
+      for (int i = 0; i < n_ranks; i++) {
+        cs_gnum_t s = CS_MAX(d_start, v_range[i*2]);
+        cs_gnum_t e = CS_MIN(d_end, v_range[i*2 + 1]);
+        send_count[i] = (e > s) ? e - s : 0;
+        send_shift[i] = (e > s) ? s - d_start : 0;
+        s = CS_MAX(c_idx[c_range[i]*2], v_start);
+        e = CS_MIN(c_idx[c_range[i+1]*2], v_end);
+        recv_count[i] = (e > s) ? e - s : 0;
+        recv_shift[i] = (e > s) ? s - v_start : 0;
+      }
+
+      MPI_Datatype ent_type;
+      MPI_Type_contiguous(type_size, MPI_BYTE, &ent_type);
+      MPI_Type_commit(&ent_type);
+
+      MPI_Alltoallv(d_buf, send_count, send_shift, ent_type,
+                    buf, recv_count, recv_shift, ent_type,
+                    inp->comm);
+
+      MPI_Type_free(&ent_type);
+
+      BFT_FREE(recv_shift);
+      BFT_FREE(recv_count);
+      BFT_FREE(send_shift);
+      BFT_FREE(send_count);
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    BFT_FREE(d_buf);
+    BFT_FREE(c_range);
+    BFT_FREE(v_range);
+  }
+
+  BFT_FREE(c_buf);
+  BFT_FREE(c_idx);
+
+  cs_file_seek(inp->f, body_end, CS_FILE_SEEK_SET);
+
+#else
+
+  CS_UNUSED(type_read);
+  CS_UNUSED(global_num_start);
+  CS_UNUSED(global_num_end);
+  CS_UNUSED(stride);
+  CS_UNUSED(buf);
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("File \"%s\" contains compressed data, but\n"
+              "code_saturne was built without zlib support."),
+            cs_file_get_name(inp->f));
+
+#endif /* defined(HAVE_ZLIB) */
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body.
  *
@@ -1370,7 +1887,20 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
 
     /* Read local or global values */
 
-    if (global_num_start > 0 && global_num_end > 0) {
+    if (inp->comp_vals[0] != CS_IO_COMPRESSION_NONE) {
+      _read_compressed_body(header->type_read,
+                            global_num_start,
+                            global_num_end,
+                            stride,
+                            _buf,
+                            inp);
+      if (log != NULL) {
+        int t_id = (global_num_start > 0 && global_num_end > 0) ? 1 : 0;
+        log->data_size[t_id] += n_vals*type_size;
+      }
+    }
+
+    else if (global_num_start > 0 && global_num_end > 0) {
       cs_file_read_block(inp->f,
                          _buf,
                          type_size,
@@ -1572,6 +2102,8 @@ _write_padding(size_t    align,
  *   n_location_vals  <-- number of values per location
  *   elt_type         <-- element type
  *   elts             <-- pointer to element data, if it may be embedded
+ *   comp_vals        <-- compression mode, number of chunks, and body size
+ *                        for compressed sections, or NULL
  *   outp             --> output kernel IO structure
  *
  * returns:
@@ -1579,14 +2111,15 @@ _write_padding(size_t    align,
  *----------------------------------------------------------------------------*/
 
 static bool
-_write_header(const char     *sec_name,
-              cs_gnum_t       n_vals,
-              size_t          location_id,
-              size_t          index_id,
-              size_t          n_location_vals,
-              cs_datatype_t   elt_type,
-              const void     *elts,
-              cs_io_t        *outp)
+_write_header(const char           *sec_name,
+              cs_gnum_t             n_vals,
+              size_t                location_id,
+              size_t                index_id,
+              size_t                n_location_vals,
+              cs_datatype_t         elt_type,
+              const void           *elts,
+              const cs_file_off_t   comp_vals[],
+              cs_io_t              *outp)
 {
   cs_file_off_t header_vals[6];
 
@@ -1628,10 +2161,16 @@ _write_header(const char     *sec_name,
   header_vals[5] = name_size + name_pad_size;
   header_vals[0] += (name_size + name_pad_size);
 
+  /* Compression metadata follows the section name */
+
+  if (comp_vals != NULL)
+    header_vals[0] += 24;
+
   /* Decide if data is to be embedded */
 
   if (   n_vals > 0
       && elts != NULL
+      && comp_vals == NULL
       && (header_vals[0] + data_size <= (cs_file_off_t)(outp->header_size))) {
     header_vals[0] += data_size;
     embed = true;
@@ -1703,11 +2242,24 @@ _write_header(const char     *sec_name,
 
   if (embed == true)
     outp->type_name[7] = 'e';
+  else if (comp_vals != NULL)
+    outp->type_name[4] = 'z';
 
   /* Section name */
 
   strcpy((char *)(outp->buffer) + 56, sec_name);
 
+  if (comp_vals != NULL) {
+
+    unsigned char *data =   (unsigned char *)(outp->buffer)
+                          + (56 + name_size + name_pad_size);
+
+    _convert_from_offset(data, comp_vals, 3);
+
+    if (cs_file_get_swap_endian(outp->f) == 1)
+      _swap_endian(data, 8, 3);
+  }
+
   if (embed == true) {
 
     unsigned char *data =   (unsigned char *)(outp->buffer)
@@ -1746,6 +2298,202 @@ _write_header(const char     *sec_name,
   return embed;
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a section body should be compressed.
+ *
+ * parameters:
+ *   n_g_vals <-- total number of values
+ *   elt_type <-- element type
+ *   outp     <-- output kernel IO structure
+ *
+ * returns:
+ *   true if the section body is compressed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_compress_section(cs_gnum_t        n_g_vals,
+                  cs_datatype_t    elt_type,
+                  const cs_io_t   *outp)
+{
+  bool retval = false;
+
+  if (   outp->compression != CS_IO_COMPRESSION_NONE
+      && n_g_vals*cs_datatype_size[elt_type] >= CS_IO_COMP_MIN_SIZE)
+    retval = true;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a compressed section, each associated process providing a
+ * contiguous part of the section's body.
+ *
+ * Each process compresses its own part of the data as a separate chunk,
+ * so the body consists of a table of cumulative value and byte counts for
+ * each non-empty chunk, followed by the compressed chunks.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_vals         <-- total number of values
+ *   n_vals           <-- local number of values
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   global           <-- true if only data on the root rank is written
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_compressed_body(const char     *sec_name,
+                       cs_gnum_t       n_g_vals,
+                       size_t          n_vals,
+                       size_t          location_id,
+                       size_t          index_id,
+                       size_t          n_location_vals,
+                       cs_datatype_t   elt_type,
+                       bool            global,
+                       const void     *elts,
+                       cs_io_t        *outp)
+{
+#if defined(HAVE_ZLIB)
+
+  double t_start = 0.;
+  size_t c_size = 0;
+  cs_io_log_t  *log = NULL;
+  int rank_id = 0, n_ranks = 1;
+
+  if (outp->log_id > -1) {
+    log = _cs_io_log[outp->mode] + outp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+#if defined(HAVE_MPI)
+  if (outp->comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(outp->comm, &rank_id);
+    MPI_Comm_size(outp->comm, &n_ranks);
+  }
+#endif
+
+  if (global && rank_id > 0)
+    n_vals = 0;
+
+  unsigned char *c_buf
+    = _compress_block(elts,
+                      elt_type,
+                      n_vals,
+                      outp->compression,
+                      outp->comp_tolerance,
+                      (cs_file_get_swap_endian(outp->f) == 1) ? true : false,
+                      cs_file_get_name(outp->f),
+                      &c_size);
+
+  /* Build chunk table on root rank */
+
+  cs_gnum_t c_vals[2] = {n_vals, c_size};
+  cs_gnum_t c_start = 0, c_total = c_size;
+  cs_gnum_t n_chunks = (c_size > 0) ? 1 : 0;
+
+  cs_gnum_t *c_counts = NULL;
+  uint64_t *c_idx = NULL;
+
+  if (rank_id == 0)
+    BFT_MALLOC(c_counts, n_ranks*2, cs_gnum_t);
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1) {
+    cs_gnum_t l_sum[2] = {c_size, n_chunks}, g_sum[2];
+    MPI_Gather(c_vals, 2, CS_MPI_GNUM, c_counts, 2, CS_MPI_GNUM, 0,
+               outp->comm);
+    MPI_Exscan(c_vals + 1, &c_start, 1, CS_MPI_GNUM, MPI_SUM, outp->comm);
+    MPI_Allreduce(l_sum, g_sum, 2, CS_MPI_GNUM, MPI_SUM, outp->comm);
+    if (rank_id == 0)
+      c_start = 0;
+    c_total = g_sum[0];
+    n_chunks = g_sum[1];
+  }
+#endif
+
+  if (n_ranks == 1) {
+    c_counts[0] = c_vals[0];
+    c_counts[1] = c_vals[1];
+  }
+
+  if (rank_id == 0) {
+    cs_gnum_t v_end = 0, b_end = 0, j = 0;
+    BFT_MALLOC(c_idx, n_chunks*2, uint64_t);
+    for (int i = 0; i < n_ranks; i++) {
+      if (c_counts[i*2 + 1] == 0)
+        continue;
+      v_end += c_counts[i*2];
+      b_end += c_counts[i*2 + 1];
+      c_idx[j*2] = v_end;
+      c_idx[j*2 + 1] = b_end;
+      j++;
+    }
+    assert(j == n_chunks);
+    BFT_FREE(c_counts);
+  }
+
+  /* Now write header, chunk table, and chunks */
+
+  cs_file_off_t comp_vals[3] = {outp->compression,
+                                n_chunks,
+                                n_chunks*16 + c_total};
+
+  _write_header(sec_name,
+                n_g_vals,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                comp_vals,
+                outp);
+
+  _write_padding(outp->body_align, outp);
+
+  cs_file_write_global(outp->f, c_idx, 8, n_chunks*2);
+
+  size_t n_written = cs_file_write_block_buffer(outp->f,
+                                                c_buf,
+                                                1,
+                                                1,
+                                                c_start + 1,
+                                                c_start + c_size + 1);
+
+  if (n_written != c_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing %llu bytes to file \"%s\"."),
+              (unsigned long long)c_size, cs_file_get_name(outp->f));
+
+  BFT_FREE(c_idx);
+  BFT_FREE(c_buf);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    int t_id = (global) ? 0 : 1;
+    log->wtimes[t_id] += t_end - t_start;
+    log->data_size[t_id] += c_size;
+  }
+
+#else
+
+  CS_UNUSED(sec_name);
+  CS_UNUSED(n_g_vals);
+  CS_UNUSED(n_vals);
+  CS_UNUSED(location_id);
+  CS_UNUSED(index_id);
+  CS_UNUSED(n_location_vals);
+  CS_UNUSED(elt_type);
+  CS_UNUSED(global);
+  CS_UNUSED(elts);
+  CS_UNUSED(outp);
+
+#endif /* defined(HAVE_ZLIB) */
+}
+
 /*----------------------------------------------------------------------------
  * Dump a kernel IO file handle's metadata.
  *
@@ -2105,6 +2853,94 @@ cs_io_get_echo(const cs_io_t  *cs_io)
   return (size_t)(cs_io->echo);
 }
 
+/*----------------------------------------------------------------------------
+ * Allow or disallow asynchronous block writes for a kernel IO structure.
+ *
+ * Block data is then copied to staging buffers and written in the
+ * background when possible (see cs_file_set_async_write()).
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *   async <-- true if asynchronous writes are allowed
+ *
+ * returns:
+ *   true if asynchronous writes are active
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_async_write(cs_io_t  *cs_io,
+                      bool      async)
+{
+  assert(cs_io != NULL);
+
+  bool retval = false;
+
+  if (cs_io->f != NULL && cs_io->mode == CS_IO_MODE_WRITE)
+    retval = cs_file_set_async_write(cs_io->f, async);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Set compression mode for sections written to a kernel IO structure.
+ *
+ * Compression applies to non-embedded section bodies written after this
+ * call. With lossy compression, floating-point values are quantized so
+ * that the absolute error is bounded by the given tolerance.
+ *
+ * If the library was built without zlib support, compression is ignored.
+ *
+ * parameters:
+ *   cs_io       <-> kernel IO structure
+ *   compression <-- compression mode
+ *   tolerance   <-- absolute error bound for lossy compression
+ *
+ * returns:
+ *   true if compression is active
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_compression(cs_io_t              *cs_io,
+                      cs_io_compression_t   compression,
+                      double                tolerance)
+{
+  assert(cs_io != NULL);
+
+#if defined(HAVE_ZLIB)
+  cs_io->compression = compression;
+  cs_io->comp_tolerance = tolerance;
+#else
+  CS_UNUSED(compression);
+  CS_UNUSED(tolerance);
+#endif
+
+  return (cs_io->compression != CS_IO_COMPRESSION_NONE) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Release staging buffers of completed asynchronous block writes
+ * for a kernel IO structure.
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *
+ * returns:
+ *   number of local writes still pending
+ *----------------------------------------------------------------------------*/
+
+int
+cs_io_test_async_write(cs_io_t  *cs_io)
+{
+  assert(cs_io != NULL);
+
+  int retval = 0;
+
+  if (cs_io->f != NULL)
+    retval = cs_file_test_async_write(cs_io->f);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section header.
  *
@@ -2203,6 +3039,16 @@ cs_io_read_header(cs_io_t             *inp,
   if (header_vals[1] > 0 && inp->type_name[7] == 'e')
     inp->data = inp->buffer + 56 + header_vals[5];
 
+  for (int i = 0; i < 3; i++)
+    inp->comp_vals[i] = 0;
+
+  if (header_vals[1] > 0 && inp->type_name[4] == 'z') {
+    unsigned char *comp_data = inp->buffer + 56 + header_vals[5];
+    if (cs_file_get_swap_endian(inp->f) == 1)
+      _swap_endian(comp_data, 8, 3);
+    _convert_to_offset(comp_data, inp->comp_vals, 3);
+  }
+
   inp->type_size = 0;
 
   /* Return immediately if we have an end-of file marker */
@@ -2359,6 +3205,9 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   inp->n_loc_vals  = header->n_location_vals;
   inp->type_size   = cs_datatype_size[header->type_read];
 
+  for (int i = 0; i < 3; i++)
+    inp->comp_vals[i] = inp->index->comp[3*id + i];
+
   /* The following values are not taken from the header buffer as
      usual, but are base on the index */
 
@@ -2762,6 +3611,122 @@ cs_io_read_index_block(cs_io_sec_header_t  *header,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Return a read-only view of a section body's values for a given block,
+ * without copying them.
+ *
+ * This is possible only when the underlying file is mapped to memory
+ * (see cs_file_set_default_mmap_read()), and the section's values may be
+ * used as-is, i.e. are not embedded in the header, compressed, or stored
+ * with a different type. Pages of the file are loaded only when the view
+ * is accessed, so each rank only pages in the part of the section it uses.
+ * If the file's endianness differs from that of the system, the block's
+ * pages are mapped privately (copy-on-write) and byte-swapped in place
+ * (see cs_file_get_map_range()).
+ *
+ * Contrary to cs_io_read_block(), blocks may overlap, so for a section
+ * representing an index, global_num_end may simply be increased by 1 on
+ * each rank to access the past-the-end index value directly.
+ *
+ * In all cases, this function must be called by all ranks of the
+ * associated communicator. If a view is returned, the file position is
+ * set after the section body, as for a read; otherwise, NULL is returned
+ * on all ranks and the body may be read using the usual functions.
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   cs_io            <-> kernel IO structure
+ *
+ * returns:
+ *   pointer to mapped values for the given block, or NULL
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_io_map_block(const cs_io_sec_header_t  *header,
+                cs_gnum_t                  global_num_start,
+                cs_gnum_t                  global_num_end,
+                cs_io_t                   *cs_io)
+{
+  const unsigned char *retval = NULL;
+  const unsigned char *map = NULL;
+  cs_file_off_t map_size = 0;
+  size_t stride = 1;
+  int mappable = 1;
+
+  assert(cs_io != NULL);
+  assert(global_num_start > 0);
+  assert(global_num_end >= global_num_start);
+
+  if (header->n_location_vals > 1)
+    stride = header->n_location_vals;
+
+  size_t type_size = cs_datatype_size[header->type_read];
+
+  if (   cs_io->data != NULL
+      || cs_io->f == NULL
+      || type_size == 0
+      || cs_io->comp_vals[0] != CS_IO_COMPRESSION_NONE
+      || header->type_read != header->elt_type
+      || (global_num_end - 1)*stride > (cs_gnum_t)(header->n_vals))
+    mappable = 0;
+
+  if (mappable)
+    map = cs_file_get_map(cs_io->f, &map_size);
+
+  if (map == NULL)
+    mappable = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_io->comm != MPI_COMM_NULL) {
+    int _mappable = mappable;
+    MPI_Allreduce(&_mappable, &mappable, 1, MPI_INT, MPI_MIN, cs_io->comm);
+  }
+#endif
+
+  if (mappable == 0)
+    return NULL;
+
+  /* Position at start of body (which must be suitably aligned) */
+
+  cs_file_off_t offset = cs_file_tell(cs_io->f);
+
+  if (cs_io->body_align > 0) {
+    size_t ba = cs_io->body_align;
+    offset += (ba - (offset % ba)) % ba;
+  }
+
+  if (offset % type_size != 0)
+    return NULL;
+
+  cs_file_off_t body_end = offset + header->n_vals*type_size;
+
+  if (body_end > map_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Premature end of file \"%s\""),
+              cs_file_get_name(cs_io->f));
+
+  retval = cs_file_get_map_range(cs_io->f,
+                                 offset
+                                 + (global_num_start - 1)*stride*type_size,
+                                 type_size,
+                                 (global_num_end - global_num_start)*stride);
+
+  /* Move file position past section body */
+
+  cs_file_seek(cs_io->f, body_end, CS_FILE_SEEK_SET);
+
+  if (cs_io->log_id > -1) {
+    cs_io_log_t *log = _cs_io_log[cs_io->mode] + cs_io->log_id;
+    log->data_size[1]
+      += (global_num_end - global_num_start)*stride*type_size;
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Write a global section.
  *
@@ -2791,20 +3756,36 @@ cs_io_write_global(const char     *sec_name,
                    cs_io_t        *outp)
 {
   bool embed = false;
+  bool compressed = false;
 
   if (outp->echo >= CS_IO_ECHO_HEADERS)
     _echo_header(sec_name, n_vals, elt_type);
 
-  embed = _write_header(sec_name,
-                        n_vals,
-                        location_id,
-                        index_id,
-                        n_location_vals,
-                        elt_type,
-                        elts,
-                        outp);
+  if (_compress_section(n_vals, elt_type, outp)) {
+    _write_compressed_body(sec_name,
+                           n_vals,
+                           n_vals,
+                           location_id,
+                           index_id,
+                           n_location_vals,
+                           elt_type,
+                           true,
+                           elts,
+                           outp);
+    compressed = true;
+  }
+  else
+    embed = _write_header(sec_name,
+                          n_vals,
+                          location_id,
+                          index_id,
+                          n_location_vals,
+                          elt_type,
+                          elts,
+                          NULL,
+                          outp);
 
-  if (n_vals > 0 && embed == false) {
+  if (n_vals > 0 && embed == false && compressed == false) {
 
     double t_start = 0.;
     cs_io_log_t  *log = NULL;
@@ -2896,6 +3877,25 @@ cs_io_write_block(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+  if (_compress_section(n_g_vals, elt_type, outp)) {
+    _write_compressed_body(sec_name,
+                           n_g_vals,
+                           n_vals,
+                           location_id,
+                           index_id,
+                           n_location_vals,
+                           elt_type,
+                           false,
+                           elts,
+                           outp);
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_g_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end -1)*stride + 1,
+                 elt_type, elts);
+    return;
+  }
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -2903,6 +3903,7 @@ cs_io_write_block(const char     *sec_name,
                 n_location_vals,
                 elt_type,
                 NULL,
+                NULL,
                 outp);
 
   if (outp->log_id > -1) {
@@ -2997,6 +3998,25 @@ cs_io_write_block_buffer(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+  if (_compress_section(n_g_vals, elt_type, outp)) {
+    _write_compressed_body(sec_name,
+                           n_g_vals,
+                           n_vals,
+                           location_id,
+                           index_id,
+                           n_location_vals,
+                           elt_type,
+                           false,
+                           elts,
+                           outp);
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_g_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end -1)*stride + 1,
+                 elt_type, elts);
+    return;
+  }
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -3004,6 +4024,7 @@ cs_io_write_block_buffer(const char     *sec_name,
                 n_location_vals,
                 elt_type,
                 NULL,
+                NULL,
                 outp);
 
   if (outp->log_id > -1) {
@@ -3077,7 +4098,10 @@ cs_io_skip(const cs_io_sec_header_t  *header,
       cs_file_off_t offset = cs_file_tell(pp_io->f);
       size_t ba = pp_io->body_align;
       offset += (ba - (offset % ba)) % ba;
-      offset += n_vals*type_size;
+      if (pp_io->comp_vals[0] != CS_IO_COMPRESSION_NONE)
+        offset += pp_io->comp_vals[2];
+      else
+        offset += n_vals*type_size;
       cs_file_seek(pp_io->f, offset, CS_FILE_SEEK_SET);
     }
 
@@ -63,6 +63,18 @@ BEGIN_C_DECLS
 
 } cs_io_mode_t;
 
+/* Section body compression */
+
+typedef enum {
+
+  CS_IO_COMPRESSION_NONE,      /* Raw binary data */
+  CS_IO_COMPRESSION_LOSSLESS,  /* Byte shuffle + deflate */
+  CS_IO_COMPRESSION_LOSSY      /* Error-bounded quantization of floating
+                                  point data + deflate (other datatypes
+                                  use lossless compression) */
+
+} cs_io_compression_t;
+
 /* Structure associated with opaque pre-processing structure object */
 
 typedef struct _cs_io_t cs_io_t;
@@ -259,6 +271,61 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
 size_t
 cs_io_get_echo(const cs_io_t  *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Allow or disallow asynchronous block writes for a kernel IO structure.
+ *
+ * Block data is then copied to staging buffers and written in the
+ * background when possible (see cs_file_set_async_write()).
+ *
+ * parameters:
+ *   pp_io <-> kernel IO structure
+ *   async <-- true if asynchronous writes are allowed
+ *
+ * returns:
+ *   true if asynchronous writes are active
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_async_write(cs_io_t  *pp_io,
+                      bool      async);
+
+/*----------------------------------------------------------------------------
+ * Set compression mode for sections written to a kernel IO structure.
+ *
+ * Compression applies to non-embedded section bodies written after this
+ * call. With lossy compression, floating-point values are quantized so
+ * that the absolute error is bounded by the given tolerance.
+ *
+ * If the library was built without zlib support, compression is ignored.
+ *
+ * parameters:
+ *   pp_io       <-> kernel IO structure
+ *   compression <-- compression mode
+ *   tolerance   <-- absolute error bound for lossy compression
+ *
+ * returns:
+ *   true if compression is active
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_compression(cs_io_t              *pp_io,
+                      cs_io_compression_t   compression,
+                      double                tolerance);
+
+/*----------------------------------------------------------------------------
+ * Release staging buffers of completed asynchronous block writes
+ * for a kernel IO structure.
+ *
+ * parameters:
+ *   pp_io <-> kernel IO structure
+ *
+ * returns:
+ *   number of local writes still pending
+ *----------------------------------------------------------------------------*/
+
+int
+cs_io_test_async_write(cs_io_t  *pp_io);
+
 /*----------------------------------------------------------------------------
  * Read a message header.
  *
@@ -443,6 +510,45 @@ cs_io_read_index_block(cs_io_sec_header_t  *header,
                        cs_gnum_t           *elts,
                        cs_io_t             *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Return a read-only view of a section body's values for a given block,
+ * without copying them.
+ *
+ * This is possible only when the underlying file is mapped to memory
+ * (see cs_file_set_default_mmap_read()), and the section's values may be
+ * used as-is, i.e. are not embedded in the header, compressed, or stored
+ * with a different type. Pages of the file are loaded only when the view
+ * is accessed, so each rank only pages in the part of the section it uses.
+ * If the file's endianness differs from that of the system, the block's
+ * pages are mapped privately (copy-on-write) and byte-swapped in place
+ * (see cs_file_get_map_range()).
+ *
+ * Contrary to cs_io_read_block(), blocks may overlap, so for a section
+ * representing an index, global_num_end may simply be increased by 1 on
+ * each rank to access the past-the-end index value directly.
+ *
+ * In all cases, this function must be called by all ranks of the
+ * associated communicator. If a view is returned, the file position is
+ * set after the section body, as for a read; otherwise, NULL is returned
+ * on all ranks and the body may be read using the usual functions.
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   cs_io            <-> kernel IO structure
+ *
+ * returns:
+ *   pointer to mapped values for the given block, or NULL
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_io_map_block(const cs_io_sec_header_t  *header,
+                cs_gnum_t                  global_num_start,
+                cs_gnum_t                  global_num_end,
+                cs_io_t                   *cs_io);
+
 /*----------------------------------------------------------------------------
  * Write a global section.
  *
@@ -72,7 +72,8 @@ BEGIN_C_DECLS
 
 const char  *cs_numbering_type_name[] = {N_("default"),
                                          N_("vectorization"),
-                                         N_("threads")};
+                                         N_("threads"),
+                                         N_("cell-based gather")};
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -500,6 +501,78 @@ _log_threading_info(cs_log_t               log,
 
 #endif /* have_MPI */
 
+/*----------------------------------------------------------------------------
+ * Log statistics for cache blocking tiles in serial mode.
+ *
+ * parameters:
+ *   log           <-- log type
+ *   numbering     <-- pointer to numbering considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_tile_info_l(cs_log_t               log,
+                 const cs_numbering_t  *numbering)
+{
+  const int n_tiles = numbering->n_tiles;
+
+  if (n_tiles < 1)
+    return;
+
+  cs_lnum_t n_elts = numbering->tile_index[n_tiles];
+
+  cs_log_printf
+    (log,
+     _("  number of cache blocking tiles:  %9u\n"
+       "  mean elements per tile:          %9u\n"),
+     (unsigned)n_tiles, (unsigned)(n_elts/n_tiles));
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Log statistics for cache blocking tiles.
+ *
+ * parameters:
+ *   log           <-- log type
+ *   numbering     <-- pointer to numbering considered
+ *   comm          <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_tile_info(cs_log_t               log,
+               const cs_numbering_t  *numbering,
+               MPI_Comm               comm)
+{
+  int n_domains = 1;
+
+  if (comm != MPI_COMM_NULL)
+    MPI_Comm_size(comm, &n_domains);
+
+  if (n_domains == 1) {
+    _log_tile_info_l(log, numbering);
+    return;
+  }
+
+  int n_tiles = numbering->n_tiles;
+  int nt_tot, nt_min, nt_max;
+
+  MPI_Allreduce(&n_tiles, &nt_tot, 1, MPI_INT, MPI_SUM, comm);
+
+  if (nt_tot < 1)
+    return;
+
+  MPI_Allreduce(&n_tiles, &nt_min, 1, MPI_INT, MPI_MIN, comm);
+  MPI_Allreduce(&n_tiles, &nt_max, 1, MPI_INT, MPI_MAX, comm);
+
+  cs_log_printf
+    (log,
+     _("                                       minimum   maximum      mean\n"
+       "  number of cache blocking tiles:    %9u %9u %9u\n"),
+     (unsigned)nt_min, (unsigned)nt_max, (unsigned)(nt_tot/n_domains));
+}
+
+#endif /* have_MPI */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -533,6 +606,9 @@ cs_numbering_create_default(cs_lnum_t  n_elts)
   numbering->n_no_adj_halo_groups = 0;
   numbering->n_no_adj_halo_elts = 0;
 
+  numbering->n_tiles = 0;
+  numbering->tile_index = NULL;
+
   BFT_MALLOC(numbering->group_index, 2, cs_lnum_t);
   numbering->group_index[0] = 0;
   numbering->group_index[1] = n_elts;
@@ -570,6 +646,9 @@ cs_numbering_create_vectorized(cs_lnum_t  n_elts,
   numbering->n_no_adj_halo_groups = 0;
   numbering->n_no_adj_halo_elts = 0;
 
+  numbering->n_tiles = 0;
+  numbering->tile_index = NULL;
+
   BFT_MALLOC(numbering->group_index, 2, cs_lnum_t);
   numbering->group_index[0] = 0;
   numbering->group_index[1] = n_elts;
@@ -613,6 +692,9 @@ cs_numbering_create_threaded(int        n_threads,
   numbering->n_no_adj_halo_groups = 0;
   numbering->n_no_adj_halo_elts = 0;
 
+  numbering->n_tiles = 0;
+  numbering->tile_index = NULL;
+
   BFT_MALLOC(numbering->group_index, n_threads*2*n_groups, cs_lnum_t);
 
   memcpy(numbering->group_index,
@@ -622,6 +704,40 @@ cs_numbering_create_threaded(int        n_threads,
   return numbering;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cache blocking tiles for a numbering information structure.
+ *
+ * Tiles are ranges of consecutive elements, in increasing order. A tile
+ * may be empty.
+ *
+ * \param[in, out]  numbering   pointer to cs_numbering_t structure
+ * \param[in]       n_tiles     number of tiles (0 to remove tiles)
+ * \param[in]       tile_index  start and past-the-end ids of elements
+ *                              in each tile (size: n_tiles + 1)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_set_tiles(cs_numbering_t   *numbering,
+                       int               n_tiles,
+                       const cs_lnum_t   tile_index[])
+{
+  BFT_FREE(numbering->tile_index);
+  numbering->n_tiles = 0;
+
+  if (n_tiles < 1)
+    return;
+
+  numbering->n_tiles = n_tiles;
+
+  BFT_MALLOC(numbering->tile_index, n_tiles + 1, cs_lnum_t);
+
+  memcpy(numbering->tile_index,
+         tile_index,
+         (n_tiles + 1) * sizeof(cs_lnum_t));
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy a numbering information structure.
@@ -639,6 +755,7 @@ cs_numbering_destroy(cs_numbering_t  **numbering)
     cs_numbering_t  *_n = *numbering;
 
     BFT_FREE(_n->group_index);
+    BFT_FREE(_n->tile_index);
 
     BFT_FREE(*numbering);
   }
@@ -668,15 +785,15 @@ cs_numbering_log_info(cs_log_t               log,
 
   if (cs_glob_n_ranks > 1) {
 
-    int type_counts[3];
-    int type_counts_l[3] = {0, 0, 0};
+    int type_counts[4];
+    int type_counts_l[4] = {0, 0, 0, 0};
     type_counts_l[numbering->type] = 1;
 
-    MPI_Allreduce(type_counts_l, type_counts, 3, MPI_INT,
+    MPI_Allreduce(type_counts_l, type_counts, 4, MPI_INT,
                   MPI_SUM, cs_glob_mpi_comm);
 
     MPI_Comm comm = cs_glob_mpi_comm;
-    for (cs_numbering_type_t i = 0; i <= CS_NUMBERING_THREADS; i++) {
+    for (cs_numbering_type_t i = 0; i <= CS_NUMBERING_GATHER; i++) {
 
       if (type_counts[i] > 0) {
 
@@ -693,6 +810,7 @@ cs_numbering_log_info(cs_log_t               log,
 
         switch(i) {
         case CS_NUMBERING_DEFAULT:
+        case CS_NUMBERING_GATHER:
           _log_default_info(log, numbering, comm);
           break;
         case CS_NUMBERING_VECTORIZE:
@@ -707,6 +825,8 @@ cs_numbering_log_info(cs_log_t               log,
 
     }
 
+    _log_tile_info(log, numbering, cs_glob_mpi_comm);
+
     if (comm != cs_glob_mpi_comm)
       MPI_Comm_free(&comm);
 
@@ -721,6 +841,7 @@ cs_numbering_log_info(cs_log_t               log,
 
     switch(numbering->type) {
     case CS_NUMBERING_DEFAULT:
+    case CS_NUMBERING_GATHER:
       _log_default_info_l(log, numbering);
       break;
     case CS_NUMBERING_VECTORIZE:
@@ -731,6 +852,8 @@ cs_numbering_log_info(cs_log_t               log,
       break;
     }
 
+    _log_tile_info_l(log, numbering);
+
   }
 }
 
@@ -758,12 +881,14 @@ cs_numbering_dump(const cs_numbering_t  *numbering)
              "  n_threads:             %d\n"
              "  n_groups:              %d\n"
              "  n_no_adj_halo_groups:  %d\n"
-             "  n_no_adj_halo_elts:    %ld\n",
+             "  n_no_adj_halo_elts:    %ld\n"
+             "  n_tiles:               %d\n",
              (const void *)numbering, cs_numbering_type_name[numbering->type],
              numbering->vector_size,
              numbering->n_threads, numbering->n_groups,
              numbering->n_no_adj_halo_groups,
-             (long)(numbering->n_no_adj_halo_elts));
+             (long)(numbering->n_no_adj_halo_elts),
+             numbering->n_tiles);
 
   if (numbering->group_index != NULL) {
 
@@ -782,6 +907,18 @@ cs_numbering_dump(const cs_numbering_t  *numbering)
     }
   }
 
+  if (numbering->tile_index != NULL) {
+
+    bft_printf("\n  tile start index:\n"
+               "\n    tile_id start_index\n");
+
+    for (i = 0; i < numbering->n_tiles; i++)
+      bft_printf("      %4d   %d\n",
+                 i, (int)(numbering->tile_index[i]));
+    bft_printf("                 %d\n",
+               (int)(numbering->tile_index[numbering->n_tiles]));
+  }
+
   bft_printf("\n\n");
 }
 
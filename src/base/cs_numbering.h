@@ -74,7 +74,8 @@ typedef enum {
 
   CS_NUMBERING_DEFAULT,    /* Default numbering */
   CS_NUMBERING_VECTORIZE,  /* Numbered for vectorization */
-  CS_NUMBERING_THREADS     /* Numbered for threads */
+  CS_NUMBERING_THREADS,    /* Numbered for threads */
+  CS_NUMBERING_GATHER      /* No coloring; face values gathered by cells */
 
 } cs_numbering_type_t;
 
@@ -102,6 +103,14 @@ typedef struct {
                                      group_index[t*n_groups*2 + g + 1].
                                      (size: n_groups * n_threads * 2) */
 
+  int   n_tiles;                  /* Number of cache blocking tiles
+                                     (0 if not tiled) */
+
+  cs_lnum_t *tile_index;          /* For tile t, the start and past-the-end
+                                     ids for entities are respectively:
+                                     tile_index[t] and tile_index[t+1]
+                                     (size: n_tiles + 1, or NULL) */
+
 } cs_numbering_t;
 
 /*=============================================================================
@@ -171,6 +180,25 @@ cs_numbering_create_threaded(int        n_threads,
                              int        n_groups,
                              cs_lnum_t  group_index[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cache blocking tiles for a numbering information structure.
+ *
+ * Tiles are ranges of consecutive elements, in increasing order. A tile
+ * may be empty.
+ *
+ * \param[in, out]  numbering   pointer to cs_numbering_t structure
+ * \param[in]       n_tiles     number of tiles (0 to remove tiles)
+ * \param[in]       tile_index  start and past-the-end ids of elements
+ *                              in each tile (size: n_tiles + 1)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_set_tiles(cs_numbering_t   *numbering,
+                       int               n_tiles,
+                       const cs_lnum_t   tile_index[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy a numbering information structure.
@@ -458,6 +458,12 @@ cs_param_get_solver_name(cs_param_itsol_type_t  solver)
   case CS_PARAM_ITSOL_MUMPS_LDLT:
     return "MUMPS (LDLT factorization)";
     break;
+  case CS_PARAM_ITSOL_PIPELINED_BICGSTAB:
+    return "Pipelined.BiCGstab";
+    break;
+  case CS_PARAM_ITSOL_PIPELINED_CG:
+    return "Pipelined.CG";
+    break;
   case CS_PARAM_ITSOL_SYM_GAUSS_SEIDEL:
     return "Symmetric.Gauss.Seidel";
     break;
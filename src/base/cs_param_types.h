@@ -677,6 +677,14 @@ typedef enum {
  * \var CS_PARAM_ITSOL_MUMPS_LDLT
  * MUMPS direct solver (LDLT factorization also known as Cholesky factorization)
  *
+ * \var CS_PARAM_ITSOL_PIPELINED_BICGSTAB
+ * Pipelined BiCGstab, overlapping global reductions with preconditioning
+ * and matrix-vector products (useful for non-symmetric systems)
+ *
+ * \var CS_PARAM_ITSOL_PIPELINED_CG
+ * Pipelined conjuguate gradient, overlapping global reductions with
+ * preconditioning and matrix-vector products
+ *
  * \var CS_PARAM_ITSOL_SYM_GAUSS_SEIDEL
  * Symmetric Gauss-Seidel
  *
@@ -701,6 +709,8 @@ typedef enum {
   CS_PARAM_ITSOL_MINRES,           /*!< Only with PETsc */
   CS_PARAM_ITSOL_MUMPS,            /*!< Only with PETsc/MUMPS */
   CS_PARAM_ITSOL_MUMPS_LDLT,       /*!< Only with PETsc/MUMPS */
+  CS_PARAM_ITSOL_PIPELINED_BICGSTAB,
+  CS_PARAM_ITSOL_PIPELINED_CG,
   CS_PARAM_ITSOL_SYM_GAUSS_SEIDEL,
 
   CS_PARAM_N_ITSOL_TYPES
@@ -100,10 +100,34 @@ struct _cs_part_to_block_t {
 
   const cs_gnum_t   *global_ent_num;  /* Shared global entity numbers */
   cs_gnum_t         *_global_ent_num; /* Private global entity numbers */
+
+  bool               persistent;      /* true if owned by the persistent
+                                         distributors cache */
+  uint64_t           gnum_hash;       /* Hash of global entity numbers
+                                         (for persistent distributors) */
+  unsigned long long last_use;        /* Last use counter
+                                         (for persistent distributors) */
 };
 
 #endif /* defined(HAVE_MPI) */
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/* Persistent distributors cache (maximum number of distributors
+   kept per communicator, and cached distributors) */
+
+static int                   _n_persistent_max = 16;
+static int                   _n_persistent = 0;
+static cs_part_to_block_t  **_persistent = NULL;
+
+static unsigned long long    _persistent_use_count = 0;
+
+#endif /* defined(HAVE_MPI) */
+
 /*============================================================================
  * Local function defintions
  *============================================================================*/
@@ -182,9 +206,94 @@ _part_to_block_create(MPI_Comm comm)
   d->global_ent_num = NULL;
   d->_global_ent_num = NULL;
 
+  d->persistent = false;
+  d->gnum_hash = 0;
+  d->last_use = 0;
+
   return d;
 }
 
+/*----------------------------------------------------------------------------
+ * Free a partition to block distributor structure.
+ *
+ * arguments:
+ *   d <-> pointer to partition to block distributor structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_part_to_block_free(cs_part_to_block_t  **d)
+{
+  cs_part_to_block_t *_d = *d;
+
+  if (_d->d != NULL)
+    cs_all_to_all_destroy(&(_d->d));
+
+  BFT_FREE(_d->recv_count);
+  BFT_FREE(_d->recv_displ);
+
+  BFT_FREE(_d->block_rank_id);
+  BFT_FREE(_d->send_block_id);
+  BFT_FREE(_d->recv_block_id);
+
+  if (_d->_global_ent_num != NULL)
+    BFT_FREE(_d->_global_ent_num);
+
+  BFT_FREE(*d);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a hash of global entity numbers (64-bit FNV-1a variant,
+ * applied to values rather than bytes).
+ *
+ * arguments:
+ *   n_ents         <-- number of elements in partition
+ *   global_ent_num <-- global entity numbers
+ *
+ * returns:
+ *   hash value
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_gnum_hash(cs_lnum_t        n_ents,
+           const cs_gnum_t  global_ent_num[])
+{
+  uint64_t h = 14695981039346656037ULL;
+
+  h = (h ^ (uint64_t)n_ents) * 1099511628211ULL;
+
+  for (cs_lnum_t i = 0; i < n_ents; i++)
+    h = (h ^ (uint64_t)global_ent_num[i]) * 1099511628211ULL;
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if block distribution info structures are identical.
+ *
+ * arguments:
+ *   a <-- first block distribution info
+ *   b <-- second block distribution info
+ *
+ * returns:
+ *   true if identical, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_block_dist_is_equal(const cs_block_dist_info_t  *a,
+                     const cs_block_dist_info_t  *b)
+{
+  bool retval = false;
+
+  if (   a->gnum_range[0] == b->gnum_range[0]
+      && a->gnum_range[1] == b->gnum_range[1]
+      && a->n_ranks == b->n_ranks
+      && a->rank_step == b->rank_step
+      && a->block_size == b->block_size)
+    retval = true;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize partition to block distributor based on global element numbers,
  * using gather to rank 0 when only one block is active.
@@ -578,9 +687,160 @@ cs_part_to_block_create_by_gnum(MPI_Comm               comm,
   return d;
 }
 
+/*----------------------------------------------------------------------------
+ * Return a persistent partition to block distributor based on global
+ * entity numbers.
+ *
+ * If a distributor built for the same communicator, block distribution
+ * and global entity numbers on all ranks is present in the persistent
+ * distributors cache, it is returned; otherwise, a new distributor is
+ * built and added to the cache (replacing the least recently used
+ * distributor for that communicator if the cache is full).
+ *
+ * Unlike distributors built with cs_part_to_block_create_by_gnum(),
+ * a persistent distributor's exchange metadata (counts, displacements,
+ * and block ids) is exchanged only once, and reused for any datatype
+ * and stride, so that repeated redistributions of a same set of entities
+ * (such as for postprocessing output or checkpointing) avoid that cost.
+ * It does not reference global_ent_num[] after this call, and calling
+ * cs_part_to_block_destroy() on it only sets the pointer to NULL.
+ *
+ * This is a collective operation on communicator comm.
+ *
+ * arguments:
+ *   comm           <-- communicator
+ *   bi             <-- block size and range info
+ *   n_ents         <-- number of elements in partition
+ *   global_ent_num <-- global entity numbers
+ *
+ * returns:
+ *   initialized partition to block distributor
+ *----------------------------------------------------------------------------*/
+
+cs_part_to_block_t *
+cs_part_to_block_create_by_gnum_persistent(MPI_Comm              comm,
+                                           cs_block_dist_info_t  bi,
+                                           cs_lnum_t             n_ents,
+                                           const cs_gnum_t       global_ent_num[])
+{
+  cs_part_to_block_t *d = NULL;
+
+  if (_n_persistent_max < 1)
+    return cs_part_to_block_create_by_gnum(comm, bi, n_ents, global_ent_num);
+
+  uint64_t gnum_hash = _gnum_hash(n_ents, global_ent_num);
+
+  /* Check for matching distributors on this communicator; creation
+     and eviction are collective on a given communicator, so the list
+     of matching candidates is the same on all its ranks */
+
+  int n_c = 0, c_lru = -1;
+  int *c_id = NULL, *c_match = NULL;
+
+  BFT_MALLOC(c_id, _n_persistent, int);
+  BFT_MALLOC(c_match, _n_persistent, int);
+
+  for (int i = 0; i < _n_persistent; i++) {
+    cs_part_to_block_t *_d = _persistent[i];
+    if (_d->comm != comm)
+      continue;
+    c_id[n_c] = i;
+    c_match[n_c] = 0;
+    if (   _d->n_part_ents == (size_t)n_ents
+        && _d->gnum_hash == gnum_hash
+        && _block_dist_is_equal(&(_d->bi), &bi))
+      c_match[n_c] = 1;
+    if (c_lru < 0 || _d->last_use < _persistent[c_id[c_lru]]->last_use)
+      c_lru = n_c;
+    n_c++;
+  }
+
+  if (n_c > 0)
+    MPI_Allreduce(MPI_IN_PLACE, c_match, n_c, MPI_INT, MPI_MIN, comm);
+
+  for (int j = 0; j < n_c; j++) {
+    if (c_match[j]) {
+      d = _persistent[c_id[j]];
+      break;
+    }
+  }
+
+  /* Build new distributor if no match was found */
+
+  if (d == NULL) {
+
+    if (n_c >= _n_persistent_max) {
+      int i = c_id[c_lru];
+      _part_to_block_free(_persistent + i);
+      for (int k = i + 1; k < _n_persistent; k++)
+        _persistent[k-1] = _persistent[k];
+      _n_persistent -= 1;
+    }
+
+    d = cs_part_to_block_create_by_gnum(comm, bi, n_ents, global_ent_num);
+
+    d->global_ent_num = NULL;
+    d->persistent = true;
+    d->gnum_hash = gnum_hash;
+
+    BFT_REALLOC(_persistent, _n_persistent + 1, cs_part_to_block_t *);
+    _persistent[_n_persistent] = d;
+    _n_persistent += 1;
+
+  }
+
+  BFT_FREE(c_match);
+  BFT_FREE(c_id);
+
+  _persistent_use_count += 1;
+  d->last_use = _persistent_use_count;
+
+  return d;
+}
+
+/*----------------------------------------------------------------------------
+ * Set the maximum number of persistent partition to block distributors
+ * kept per communicator.
+ *
+ * Existing persistent distributors are freed. A value of 0 disables
+ * the persistent distributors cache, in which case
+ * cs_part_to_block_create_by_gnum_persistent() is equivalent to
+ * cs_part_to_block_create_by_gnum().
+ *
+ * arguments:
+ *   n_max <-- maximum number of persistent distributors per communicator
+ *----------------------------------------------------------------------------*/
+
+void
+cs_part_to_block_set_n_persistent_max(int  n_max)
+{
+  cs_part_to_block_free_persistent();
+
+  _n_persistent_max = CS_MAX(n_max, 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Free all persistent partition to block distributors.
+ *
+ * Pointers to persistent distributors obtained previously are invalid
+ * after this call.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_part_to_block_free_persistent(void)
+{
+  for (int i = 0; i < _n_persistent; i++)
+    _part_to_block_free(_persistent + i);
+
+  BFT_FREE(_persistent);
+  _n_persistent = 0;
+}
+
 /*----------------------------------------------------------------------------
  * Destroy a partition to block distributor structure.
  *
+ * For a persistent distributor, the pointer is simply set to NULL.
+ *
  * arguments:
  *   d <-> pointer to partition to block distributor structure pointer
  *----------------------------------------------------------------------------*/
@@ -590,20 +850,13 @@ cs_part_to_block_destroy(cs_part_to_block_t  **d)
 {
   cs_part_to_block_t *_d = *d;
 
-  if (_d->d != NULL)
-    cs_all_to_all_destroy(&(_d->d));
+  /* Persistent distributors are only released by the caller */
 
-  BFT_FREE(_d->recv_count);
-  BFT_FREE(_d->recv_displ);
-
-  BFT_FREE(_d->block_rank_id);
-  BFT_FREE(_d->send_block_id);
-  BFT_FREE(_d->recv_block_id);
+  if (_d->persistent)
+    *d = NULL;
 
-  if (_d->_global_ent_num != NULL)
-    BFT_FREE(_d->_global_ent_num);
-
-  BFT_FREE(*d);
+  else
+    _part_to_block_free(d);
 }
 
 /*----------------------------------------------------------------------------
@@ -621,6 +874,14 @@ void
 cs_part_to_block_transfer_gnum(cs_part_to_block_t  *d,
                                cs_gnum_t            global_ent_num[])
 {
+  /* Persistent distributors do not reference global numbers
+     once built, so the array is simply freed */
+
+  if (d->persistent) {
+    BFT_FREE(global_ent_num);
+    return;
+  }
+
   assert(d->global_ent_num == global_ent_num);
 
   d->_global_ent_num = global_ent_num;
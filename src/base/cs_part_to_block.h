@@ -83,9 +83,73 @@ cs_part_to_block_create_by_gnum(MPI_Comm              comm,
                                 cs_lnum_t             n_ents,
                                 const cs_gnum_t       global_ent_num[]);
 
+/*----------------------------------------------------------------------------
+ * Return a persistent partition to block distributor based on global
+ * entity numbers.
+ *
+ * If a distributor built for the same communicator, block distribution
+ * and global entity numbers on all ranks is present in the persistent
+ * distributors cache, it is returned; otherwise, a new distributor is
+ * built and added to the cache (replacing the least recently used
+ * distributor for that communicator if the cache is full).
+ *
+ * Unlike distributors built with cs_part_to_block_create_by_gnum(),
+ * a persistent distributor's exchange metadata (counts, displacements,
+ * and block ids) is exchanged only once, and reused for any datatype
+ * and stride, so that repeated redistributions of a same set of entities
+ * (such as for postprocessing output or checkpointing) avoid that cost.
+ * It does not reference global_ent_num[] after this call, and calling
+ * cs_part_to_block_destroy() on it only sets the pointer to NULL.
+ *
+ * This is a collective operation on communicator comm.
+ *
+ * arguments:
+ *   comm           <-- communicator
+ *   bi             <-- block size and range info
+ *   n_ents         <-- number of elements in partition
+ *   global_ent_num <-- global entity numbers
+ *
+ * returns:
+ *   initialized partition to block distributor
+ *----------------------------------------------------------------------------*/
+
+cs_part_to_block_t *
+cs_part_to_block_create_by_gnum_persistent(MPI_Comm              comm,
+                                           cs_block_dist_info_t  bi,
+                                           cs_lnum_t             n_ents,
+                                           const cs_gnum_t       global_ent_num[]);
+
+/*----------------------------------------------------------------------------
+ * Set the maximum number of persistent partition to block distributors
+ * kept per communicator.
+ *
+ * Existing persistent distributors are freed. A value of 0 disables
+ * the persistent distributors cache, in which case
+ * cs_part_to_block_create_by_gnum_persistent() is equivalent to
+ * cs_part_to_block_create_by_gnum().
+ *
+ * arguments:
+ *   n_max <-- maximum number of persistent distributors per communicator
+ *----------------------------------------------------------------------------*/
+
+void
+cs_part_to_block_set_n_persistent_max(int  n_max);
+
+/*----------------------------------------------------------------------------
+ * Free all persistent partition to block distributors.
+ *
+ * Pointers to persistent distributors obtained previously are invalid
+ * after this call.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_part_to_block_free_persistent(void);
+
 /*----------------------------------------------------------------------------
  * Destroy a partition to block distributor structure.
  *
+ * For a persistent distributor, the pointer is simply set to NULL.
+ *
  * arguments:
  *   d <-> pointer to partition to block distributor structure pointer
  *----------------------------------------------------------------------------*/
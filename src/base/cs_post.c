@@ -3759,6 +3759,22 @@ _check_non_transient(const cs_post_writer_t  *writer,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b async to use deferred, non-blocking writes (for \c \b EnSight
+ *         with MPI-IO); files written at a given output time step are only
+ *         completed and closed when the writer is flushed at the end of
+ *         the next output time step, so that writing overlaps with
+ *         computation in between.
+ * - \c \b precision_bits=<n> to keep only n mantissa bits (1 to 23) of
+ *         output field values (for \c \b EnSight, whose values are single
+ *         precision floats), so that output compresses much better;
+ *         \c \b precision_bits:<field_name>=<n> sets the precision for a
+ *         given field (whose name may not contain spaces or commas).
+ * - \c \b slice_x=<x>, \c \b slice_y=<y>, \c \b slice_z=<z> to extract
+ *         field samples on the matching planes, and \c \b iso=<v> to
+ *         extract samples on the iso-surface of value v of each field
+ *         (or of its magnitude), in addition to histograms (for
+ *         \c \b histogram); the reduced samples are written as CSV
+ *         files, alongside the histogram output.
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
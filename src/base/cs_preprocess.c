@@ -45,19 +45,30 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_all_to_all.h"
+#include "cs_block_dist.h"
+#include "cs_boundary_conditions.h"
 #include "cs_boundary_zone.h"
+#include "cs_cell_to_vertex.h"
 #include "cs_ext_neighborhood.h"
+#include "cs_field.h"
+#include "cs_gradient.h"
+#include "cs_gradient_perio.h"
 #include "cs_gui.h"
 #include "cs_gui_mesh.h"
+#include "cs_halo_perio.h"
 #include "cs_internal_coupling.h"
 #include "cs_join.h"
 #include "cs_log.h"
 #include "cs_map.h"
+#include "cs_matrix_default.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_mesh_cartesian.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
+#include "cs_part_to_block.h"
 #include "cs_renumber.h"
 #include "cs_mesh_save.h"
 #include "cs_mesh_to_builder.h"
@@ -101,6 +112,17 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Field-owned array saved in block distribution during repartitioning */
+
+typedef struct {
+
+  int          location_id;  /* Base mesh location id */
+  int          stride;       /* Number of values per element */
+  cs_real_t  **p_val;        /* Pointer to array pointer in field */
+  cs_real_t   *b_val;        /* Values in block distribution */
+
+} _block_array_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -160,6 +182,338 @@ extern void cs_f_majgeo(const cs_lnum_t    *ncel,
  * Private function definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Return global numbering info for a base mesh location.
+ *
+ * parameters:
+ *   m           <-- pointer to mesh structure
+ *   location_id <-- base mesh location id
+ *   n_elts      --> number of local elements
+ *   n_g_elts    --> global number of elements
+ *
+ * returns:
+ *   pointer to global element numbers, or NULL for unhandled locations
+ *----------------------------------------------------------------------------*/
+
+static const cs_gnum_t *
+_location_gnum(const cs_mesh_t  *m,
+               int               location_id,
+               cs_lnum_t        *n_elts,
+               cs_gnum_t        *n_g_elts)
+{
+  const cs_gnum_t *gnum = NULL;
+
+  *n_elts = 0;
+  *n_g_elts = 0;
+
+  switch(location_id) {
+  case CS_MESH_LOCATION_CELLS:
+    gnum = m->global_cell_num;
+    *n_elts = m->n_cells;
+    *n_g_elts = m->n_g_cells;
+    break;
+  case CS_MESH_LOCATION_INTERIOR_FACES:
+    gnum = m->global_i_face_num;
+    *n_elts = m->n_i_faces;
+    *n_g_elts = m->n_g_i_faces;
+    break;
+  case CS_MESH_LOCATION_BOUNDARY_FACES:
+    gnum = m->global_b_face_num;
+    *n_elts = m->n_b_faces;
+    *n_g_elts = m->n_g_b_faces;
+    break;
+  case CS_MESH_LOCATION_VERTICES:
+    gnum = m->global_vtx_num;
+    *n_elts = m->n_vertices;
+    *n_g_elts = m->n_g_vertices;
+    break;
+  default:
+    break;
+  }
+
+  return gnum;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a field-owned array to the list of arrays to migrate.
+ *
+ * parameters:
+ *   location_id <-- base mesh location id
+ *   stride      <-- number of values per element
+ *   p_val       <-- pointer to array pointer in field
+ *   n_arrays    <-> number of arrays to migrate
+ *   arrays      <-> arrays to migrate
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_arrays_add(int               location_id,
+                  int               stride,
+                  cs_real_t       **p_val,
+                  int              *n_arrays,
+                  _block_array_t  **arrays)
+{
+  if (*p_val == NULL)
+    return;
+
+  int i = *n_arrays;
+
+  BFT_REALLOC(*arrays, i+1, _block_array_t);
+
+  _block_array_t *a = (*arrays) + i;
+
+  a->location_id = location_id;
+  a->stride = stride;
+  a->p_val = p_val;
+  a->b_val = NULL;
+
+  *n_arrays = i+1;
+}
+
+/*----------------------------------------------------------------------------
+ * Save values of field-owned arrays on base mesh locations to a
+ * block distribution based on global element numbers.
+ *
+ * The field arrays are freed once saved.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh structure
+ *   n_arrays  --> number of saved arrays
+ *   arrays    --> saved arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_arrays_save(const cs_mesh_t   *m,
+                   int               *n_arrays,
+                   _block_array_t   **arrays)
+{
+  *n_arrays = 0;
+  *arrays = NULL;
+
+  const int n_fields = cs_field_n_fields();
+  const int coupled_key_id = cs_field_key_id_try("coupled");
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    if (   f->is_owner == false
+        || f->location_id < CS_MESH_LOCATION_CELLS
+        || f->location_id > CS_MESH_LOCATION_VERTICES)
+      continue;
+
+    for (int kk = 0; kk < f->n_time_vals; kk++)
+      _block_arrays_add(f->location_id, f->dim, &(f->vals[kk]),
+                        n_arrays, arrays);
+
+    cs_field_bc_coeffs_t *bc = f->bc_coeffs;
+
+    if (bc != NULL) {
+
+      int a_mult = f->dim, b_mult = f->dim;
+      if ((f->type & CS_FIELD_VARIABLE) && coupled_key_id > -1) {
+        if (cs_field_get_key_int(f, coupled_key_id))
+          b_mult *= f->dim;
+      }
+
+      const int l_id = bc->location_id;
+
+      _block_arrays_add(l_id, a_mult, &(bc->a), n_arrays, arrays);
+      _block_arrays_add(l_id, b_mult, &(bc->b), n_arrays, arrays);
+      _block_arrays_add(l_id, a_mult, &(bc->af), n_arrays, arrays);
+      _block_arrays_add(l_id, b_mult, &(bc->bf), n_arrays, arrays);
+      _block_arrays_add(l_id, a_mult, &(bc->ad), n_arrays, arrays);
+      _block_arrays_add(l_id, b_mult, &(bc->bd), n_arrays, arrays);
+      _block_arrays_add(l_id, a_mult, &(bc->ac), n_arrays, arrays);
+      _block_arrays_add(l_id, b_mult, &(bc->bc), n_arrays, arrays);
+      _block_arrays_add(l_id, 1, &(bc->hint), n_arrays, arrays);
+      _block_arrays_add(l_id, 1, &(bc->hext), n_arrays, arrays);
+    }
+
+    f->val = NULL;
+    f->val_pre = NULL;
+  }
+
+  /* Distribute arrays to blocks, location by location */
+
+  for (int l_id = CS_MESH_LOCATION_CELLS;
+       l_id <= CS_MESH_LOCATION_VERTICES;
+       l_id++) {
+
+    cs_lnum_t n_elts;
+    cs_gnum_t n_g_elts;
+    const cs_gnum_t *gnum = _location_gnum(m, l_id, &n_elts, &n_g_elts);
+
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                          cs_glob_n_ranks,
+                                                          1,
+                                                          0,
+                                                          n_g_elts);
+
+    cs_lnum_t n_b_elts = bi.gnum_range[1] - bi.gnum_range[0];
+
+    cs_part_to_block_t *d = NULL;
+
+    for (int i = 0; i < *n_arrays; i++) {
+
+      _block_array_t *a = (*arrays) + i;
+      if (a->location_id != l_id)
+        continue;
+
+      if (d == NULL)
+        d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                            bi,
+                                            n_elts,
+                                            gnum);
+
+      BFT_MALLOC(a->b_val, n_b_elts*a->stride, cs_real_t);
+
+      cs_part_to_block_copy_array(d,
+                                  CS_REAL_TYPE,
+                                  a->stride,
+                                  *(a->p_val),
+                                  a->b_val);
+
+      BFT_FREE(*(a->p_val));
+    }
+
+    if (d != NULL)
+      cs_part_to_block_destroy(&d);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Restore field-owned arrays from a block distribution, using the
+ * current mesh's global element numbers.
+ *
+ * Fields owning values on other locations (except CS_MESH_LOCATION_NONE,
+ * whose size does not depend on the partition) are reallocated and
+ * reinitialized to zero, and are logged.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh structure
+ *   n_arrays  <-- number of saved arrays
+ *   arrays    <-> saved arrays (block values freed on exit)
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_arrays_restore(const cs_mesh_t  *m,
+                      int               n_arrays,
+                      _block_array_t   *arrays)
+{
+  for (int l_id = CS_MESH_LOCATION_CELLS;
+       l_id <= CS_MESH_LOCATION_VERTICES;
+       l_id++) {
+
+    cs_lnum_t n_elts;
+    cs_gnum_t n_g_elts;
+    const cs_gnum_t *gnum = _location_gnum(m, l_id, &n_elts, &n_g_elts);
+
+    const cs_lnum_t *n_l_elts = cs_mesh_location_get_n_elts(l_id);
+
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                          cs_glob_n_ranks,
+                                                          1,
+                                                          0,
+                                                          n_g_elts);
+
+    cs_all_to_all_t *d = NULL;
+    cs_lnum_t n_r = 0;
+    cs_gnum_t *r_gnum = NULL;
+    cs_real_t *r_val = NULL;
+
+    for (int i = 0; i < n_arrays; i++) {
+
+      _block_array_t *a = arrays + i;
+      if (a->location_id != l_id)
+        continue;
+
+      const int stride = a->stride;
+
+      if (d == NULL) {
+        d = cs_all_to_all_create_from_block(n_elts,
+                                            0, /* flags */
+                                            gnum,
+                                            bi,
+                                            cs_glob_mpi_comm);
+        r_gnum = cs_all_to_all_copy_array(d,
+                                          CS_GNUM_TYPE,
+                                          1,
+                                          false, /* reverse */
+                                          gnum,
+                                          NULL);
+        n_r = cs_all_to_all_n_elts_dest(d);
+      }
+
+      BFT_REALLOC(r_val, n_r*stride, cs_real_t);
+
+      for (cs_lnum_t j = 0; j < n_r; j++) {
+        const cs_real_t *b_val
+          = a->b_val + (r_gnum[j] - bi.gnum_range[0])*stride;
+        for (int k = 0; k < stride; k++)
+          r_val[j*stride + k] = b_val[k];
+      }
+
+      BFT_FREE(a->b_val);
+
+      BFT_MALLOC(*(a->p_val), n_l_elts[2]*stride, cs_real_t);
+
+      cs_all_to_all_copy_array(d,
+                               CS_REAL_TYPE,
+                               stride,
+                               true, /* reverse */
+                               r_val,
+                               *(a->p_val));
+
+      if (l_id == CS_MESH_LOCATION_CELLS && m->halo != NULL) {
+        cs_halo_sync_untyped(m->halo,
+                             CS_HALO_EXTENDED,
+                             stride*sizeof(cs_real_t),
+                             *(a->p_val));
+        if (stride == 3)
+          cs_halo_perio_sync_var_vect(m->halo,
+                                      CS_HALO_EXTENDED,
+                                      *(a->p_val),
+                                      stride);
+      }
+    }
+
+    BFT_FREE(r_val);
+    BFT_FREE(r_gnum);
+
+    if (d != NULL)
+      cs_all_to_all_destroy(&d);
+  }
+
+  /* Update field value pointers */
+
+  const int n_fields = cs_field_n_fields();
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    if (f->is_owner == false || f->location_id == CS_MESH_LOCATION_NONE)
+      continue;
+
+    if (   f->location_id < CS_MESH_LOCATION_CELLS
+        || f->location_id > CS_MESH_LOCATION_VERTICES) {
+      cs_field_allocate_values(f);
+      bft_printf(_("   field \"%s\" on location \"%s\" reset to zero\n"),
+                 f->name, cs_mesh_location_get_name(f->location_id));
+    }
+
+    else {
+      f->val = f->vals[0];
+      if (f->n_time_vals > 1)
+        f->val_pre = f->vals[1];
+    }
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -593,6 +947,212 @@ cs_preprocess_mesh_update_fortran(void)
               mq->dofij);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the load imbalance of the global mesh's partition.
+ *
+ * The imbalance is defined as the ratio of the maximum to the mean
+ * per-rank sum of cell weights, so a perfectly balanced partition has an
+ * imbalance of 1.
+ *
+ * \param[in]  cell_weight  cell cost weights, or NULL for uniform weights
+ *
+ * \return  load imbalance ratio
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_preprocess_mesh_imbalance(const cs_real_t  cell_weight[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  double w_l = m->n_cells;
+
+  if (cell_weight != NULL) {
+    w_l = 0;
+    for (cs_lnum_t i = 0; i < m->n_cells; i++)
+      w_l += CS_MAX(cell_weight[i], 0.);
+  }
+
+  double w_max = w_l, w_sum = w_l;
+
+  cs_parall_max(1, CS_DOUBLE, &w_max);
+  cs_parall_sum(1, CS_DOUBLE, &w_sum);
+
+  double imbalance = 1.;
+  if (w_sum > 0)
+    imbalance = w_max / (w_sum / cs_glob_n_ranks);
+
+  return imbalance;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition the global mesh at the setup stage, based on cell
+ *        weights, and migrate field values to the new partition.
+ *
+ * Cells are redistributed using the main partitioning algorithm
+ * (see \ref cs_partition_set_algorithm), with the given weights.
+ * Mesh quantities, selectors, locations, zones, and mesh-dependent
+ * algebra structures are rebuilt.
+ *
+ * Values and boundary condition coefficients of fields owning their values
+ * on cells, interior faces, boundary faces or vertices are migrated.
+ * Owner fields on other partition-dependent locations (such as locations
+ * based on zones) are reallocated and reset to zero, and are listed in
+ * the log; it is up to the caller to recompute them if needed.
+ * Fields mapping external arrays, Lagrangian particles, internal
+ * couplings, and turbomachinery data are not migrated, so this function
+ * should only be called at a point where these do not need to be
+ * preserved. Postprocessing meshes should be defined as time-varying.
+ *
+ * This function is intended for the setup stage, once the mesh has
+ * been preprocessed and cell costs may be estimated, but before the
+ * computation starts. As boundary condition and Fortran work arrays
+ * (itypfb, ...) are sized for the current partition and are not
+ * migrated, it may not be called once they have been allocated
+ * (i.e. during the time loop of the legacy finite-volume scheme),
+ * and leads to an error in that case. Repartitioning during the
+ * time loop is not supported.
+ *
+ * This function does nothing in serial mode.
+ *
+ * \param[in]  cell_weight  cell cost weights, or NULL for uniform weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocess_mesh_repartition(const cs_real_t  cell_weight[])
+{
+  if (cs_glob_n_ranks < 2)
+    return;
+
+#if defined(HAVE_MPI)
+
+  double t1, t2;
+
+  int t_stat_id = cs_timer_stats_id_by_name("mesh_processing");
+
+  int t_top_id = cs_timer_stats_switch(t_stat_id);
+
+  t1 = cs_timer_wtime();
+
+  /* Boundary condition and Fortran module arrays are not migrated */
+
+  if (cs_glob_bc_type != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: the mesh may not be repartitioned once boundary\n"
+                "condition and Fortran work arrays have been allocated."),
+              __func__);
+
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_halo_type_t halo_type = m->halo_type;
+
+  double imbalance_0 = cs_preprocess_mesh_imbalance(cell_weight);
+
+  /* Save field values to block distribution */
+
+  int n_arrays = 0;
+  _block_array_t *arrays = NULL;
+
+  _block_arrays_save(m, &n_arrays, &arrays);
+
+  /* Transfer mesh to builder and repartition */
+
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  if (cell_weight != NULL) {
+
+    mb->cell_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                              cs_glob_n_ranks,
+                                              mb->min_rank_step,
+                                              0,
+                                              m->n_g_cells);
+
+    BFT_MALLOC(mb->cell_weight,
+               (mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0]),
+               cs_real_t);
+
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        mb->cell_bi,
+                                        m->n_cells,
+                                        m->global_cell_num);
+
+    cs_part_to_block_copy_array(d,
+                                CS_REAL_TYPE,
+                                1,
+                                cell_weight,
+                                mb->cell_weight);
+
+    cs_part_to_block_destroy(&d);
+
+  }
+
+  cs_mesh_to_builder(m, mb, true, NULL);
+
+  cs_partition(m, mb, CS_PARTITION_MAIN);
+  cs_mesh_from_builder(m, mb);
+  cs_mesh_init_halo(m, mb, halo_type);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&mb);
+
+  m->n_b_faces_all = m->n_b_faces;
+  m->n_g_b_faces_all = m->n_g_b_faces;
+
+  cs_renumber_mesh(m);
+
+  cs_mesh_init_group_classes(m);
+
+  /* Recompute geometric quantities related to the mesh */
+
+  cs_mesh_quantities_free_all(mq);
+  cs_mesh_quantities_compute(m, mq);
+  cs_mesh_bad_cells_detect(m, mq);
+
+  cs_ext_neighborhood_reduce(m, mq);
+
+  /* Rebuild selectors, locations and zones */
+
+  cs_mesh_init_selectors();
+  cs_mesh_location_build(m, -1);
+  cs_volume_zone_build_all(true);
+  cs_boundary_zone_build_all(true);
+
+  /* Migrate field values */
+
+  _block_arrays_restore(m, n_arrays, arrays);
+
+  BFT_FREE(arrays);
+
+  /* Update mesh-dependent structures */
+
+  cs_preprocess_mesh_update_fortran();
+
+  cs_gradient_free_quantities();
+  cs_cell_to_vertex_free();
+  cs_mesh_adjacencies_update_mesh();
+
+  cs_gradient_perio_update_mesh();
+  cs_matrix_update_mesh();
+
+  t2 = cs_timer_wtime();
+
+  double imbalance_1 = cs_preprocess_mesh_imbalance(NULL);
+
+  bft_printf(_("\n Mesh repartitioned (%.3g s)\n"
+               "   load imbalance before repartitioning: %.3g\n"
+               "   cell count imbalance after:           %.3g\n"),
+             t2-t1, imbalance_0, imbalance_1);
+
+  cs_timer_stats_switch(t_top_id);
+
+#endif /* defined(HAVE_MPI) */
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -109,6 +109,40 @@ cs_preprocess_mesh_selected_b_faces_ignore(cs_mesh_t             *m,
 void
 cs_preprocess_mesh_update_fortran(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the load imbalance of the global mesh's partition.
+ *
+ * The imbalance is defined as the ratio of the maximum to the mean
+ * per-rank sum of cell weights, so a perfectly balanced partition has an
+ * imbalance of 1.
+ *
+ * \param[in]  cell_weight  cell cost weights, or NULL for uniform weights
+ *
+ * \return  load imbalance ratio
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_preprocess_mesh_imbalance(const cs_real_t  cell_weight[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition the global mesh at the setup stage, based on cell
+ *        weights, and migrate field values to the new partition.
+ *
+ * Values and boundary condition coefficients of fields owning their values
+ * on cells, interior faces, boundary faces or vertices are migrated.
+ * This is a setup-stage function: it may not be called during the
+ * time loop. See the function definition for limitations.
+ *
+ * \param[in]  cell_weight  cell cost weights, or NULL for uniform weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocess_mesh_repartition(const cs_real_t  cell_weight[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -1697,7 +1697,8 @@ _read_data(int                 file_id,
         cs_lnum_t ii;
         cs_lnum_t idx_offset_shift = 0;
         cs_gnum_t idx_gnum_shift = 0;
-        cs_gnum_t *_g_face_vertices_idx = NULL;
+        const cs_gnum_t *_g_face_vertices_idx = NULL;
+        cs_gnum_t *_g_face_vertices_idx_r = NULL;
 
         /* Compute range for current file  */
         _data_range(&header,
@@ -1722,11 +1723,19 @@ _read_data(int                 file_id,
         if (val_offset_cur > 0)
           idx_offset_shift = mb->face_vertices_idx[val_offset_cur];
 
-        /* Read data */
+        /* Read data (using a view of the file if mapped to memory,
+           as past-the-end values may then be accessed directly) */
         cs_io_set_cs_gnum(&header, pp_in);
-        BFT_MALLOC(_g_face_vertices_idx, n_vals_cur+1, cs_gnum_t);
-        cs_io_read_index_block(&header, gnum_range_cur[0], gnum_range_cur[1],
-                               _g_face_vertices_idx, pp_in);
+        _g_face_vertices_idx = cs_io_map_block(&header,
+                                               gnum_range_cur[0],
+                                               gnum_range_cur[1] + 1,
+                                               pp_in);
+        if (_g_face_vertices_idx == NULL) {
+          BFT_MALLOC(_g_face_vertices_idx_r, n_vals_cur+1, cs_gnum_t);
+          cs_io_read_index_block(&header, gnum_range_cur[0], gnum_range_cur[1],
+                                 _g_face_vertices_idx_r, pp_in);
+          _g_face_vertices_idx = _g_face_vertices_idx_r;
+        }
 
         /* save start and end values for next read */
         face_vtx_range[1] = _g_face_vertices_idx[n_vals_cur - 1];
@@ -1740,7 +1749,7 @@ _read_data(int                 file_id,
             = _face_vtx_idx + idx_offset_shift;
         }
 
-        BFT_FREE(_g_face_vertices_idx);
+        BFT_FREE(_g_face_vertices_idx_r);
       }
 
       else if (strncmp(header.sec_name, "face_vertices",
@@ -154,6 +154,12 @@ BEGIN_C_DECLS
   \var CS_RENUMBER_I_FACES_SIMD
        Renumber to allow SIMD operations in interior face->cell gather
        operations (such as SpMV products with native matrix representation).
+  \var CS_RENUMBER_I_FACES_GATHER
+       Cell-based gather of interior face values. Operations supporting it
+       compute face values in a face-parallel loop, then gather them by cell
+       using the cells -> faces adjacency (see
+       \ref cs_mesh_adjacencies_gather_c2f), so no thread groups are needed.
+       Other operations use a multipass face numbering.
   \var CS_RENUMBER_I_FACES_NONE
        No interior face renumbering.
 
@@ -217,6 +223,8 @@ static int _cs_renumber_n_threads = 0;
 static cs_lnum_t  _min_i_subset_size = 256;
 static cs_lnum_t  _min_b_subset_size = 256;
 
+static size_t  _tile_cache_size = 0;
+
 static bool _renumber_ghost_cells = true;
 static bool _cells_adjacent_to_halo_last = false;
 static bool _i_faces_adjacent_to_halo_last = false;
@@ -259,6 +267,7 @@ static const char *_i_face_renum_name[]
   = {N_("coloring, no shared cell in block"),
      N_("multipass"),
      N_("vectorizing"),
+     N_("cell-based gather"),
      N_("adjacent cells")};
 
 static const char *_b_face_renum_name[]
@@ -1407,7 +1416,7 @@ _order_i_faces_by_cell_adjacency(const cs_mesh_t         *mesh,
         cs_lnum_t c_id_1 = i_face_cells[f_id][1];
         if (c_id_0 >= n_cells)
           faces_keys[f_id*3] = halo_class[c_id_0 - n_cells];
-        else if (c_id_1 > n_cells)
+        else if (c_id_1 >= n_cells)
           faces_keys[f_id*3] = halo_class[c_id_1 - n_cells];
         else {
           faces_keys[f_id*3] = 0;
@@ -1462,7 +1471,7 @@ _order_i_faces_by_cell_adjacency(const cs_mesh_t         *mesh,
 
         for (cs_lnum_t i = 0; i < n_i_faces; i++) {
           cs_lnum_t f_id = order[i];
-          if (faces_keys[f_id*2 + 1] > n_cells)
+          if (faces_keys[f_id*2 + 1] >= n_cells)
             break;
           else
             n_no_adj_halo += 1;
@@ -1504,7 +1513,7 @@ _order_i_faces_by_cell_adjacency(const cs_mesh_t         *mesh,
 
       for (cs_lnum_t i = 0; i < n_i_faces; i++) {
         cs_lnum_t f_id = order[i];
-        if (faces_keys[f_id*2] > n_cells)
+        if (faces_keys[f_id*2] >= n_cells)
           break;
         else
           n_no_adj_halo += 1;
@@ -1620,6 +1629,239 @@ _renumber_b_faces_by_cell_adjacency(cs_mesh_t  *mesh)
   BFT_FREE(new_to_old_b);
 }
 
+/*----------------------------------------------------------------------------
+ * Define cache blocking tiles for cells.
+ *
+ * Tiles are ranges of consecutive cells, sized so that the data accessed
+ * by typical face-based kernels for the cells of a tile and their faces
+ * fits in the tile cache size. Cells are assumed to be already numbered
+ * for locality, so consecutive cells are mostly neighbors.
+ *
+ * parameters:
+ *   mesh <-> pointer to global mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_cell_tiles(cs_mesh_t  *mesh)
+{
+  if (_tile_cache_size == 0 || mesh->cell_numbering == NULL)
+    return;
+
+  /* Estimated working set per cell: cell values and geometry, and
+     about 3 interior faces per cell (face -> cells connectivity,
+     normal, center, weight and fluxes) */
+
+  const size_t cell_size =   12*sizeof(cs_real_t)
+                           + 3*(2*sizeof(cs_lnum_t) + 9*sizeof(cs_real_t));
+
+  cs_lnum_t tile_size = _tile_cache_size / cell_size;
+  if (tile_size < 64)
+    tile_size = 64;
+
+  /* Cells adjacent to the halo (when placed last) start a new tile */
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  cs_lnum_t n_no_adj = mesh->cell_numbering->n_no_adj_halo_elts;
+  if (n_no_adj <= 0 || n_no_adj > n_cells)
+    n_no_adj = n_cells;
+
+  const cs_lnum_t range[3] = {0, n_no_adj, n_cells};
+
+  int n_tiles = 0;
+  cs_lnum_t *tile_index = NULL;
+  BFT_MALLOC(tile_index, n_cells/tile_size + 3, cs_lnum_t);
+
+  tile_index[0] = 0;
+
+  for (int r = 0; r < 2; r++) {
+    cs_lnum_t n_r_cells = range[r+1] - range[r];
+    if (n_r_cells < 1)
+      continue;
+    cs_lnum_t n_r_tiles = (n_r_cells + tile_size - 1) / tile_size;
+    for (cs_lnum_t t_id = 0; t_id < n_r_tiles; t_id++) {
+      n_tiles++;
+      tile_index[n_tiles] = range[r] + n_r_cells*(t_id+1)/n_r_tiles;
+    }
+  }
+
+  cs_numbering_set_tiles(mesh->cell_numbering, n_tiles, tile_index);
+
+  BFT_FREE(tile_index);
+}
+
+/*----------------------------------------------------------------------------
+ * Build the cell -> tile id array matching cell tiles.
+ *
+ * parameters:
+ *   mesh <-- pointer to global mesh structure
+ *
+ * returns:
+ *   pointer to allocated cell tile ids (size: n_cells), or NULL
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t *
+_cell_tile_ids(const cs_mesh_t  *mesh)
+{
+  const cs_numbering_t *c_num = mesh->cell_numbering;
+
+  if (c_num == NULL || c_num->n_tiles < 1)
+    return NULL;
+
+  cs_lnum_t *c_tile_id;
+  BFT_MALLOC(c_tile_id, mesh->n_cells, cs_lnum_t);
+
+  for (int t_id = 0; t_id < c_num->n_tiles; t_id++) {
+    for (cs_lnum_t c_id = c_num->tile_index[t_id];
+         c_id < c_num->tile_index[t_id+1];
+         c_id++)
+      c_tile_id[c_id] = t_id;
+  }
+
+  return c_tile_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if interior faces may be ordered and grouped by tiles.
+ *
+ * Ordering faces by tile of their lowest adjacent cell preserves the
+ * lexicographical ordering by lowest adjacent cell id, but would undo
+ * an ordering by highest adjacent cell id or the placement of faces
+ * adjacent to ghost cells last, so tiles are not used in these cases.
+ *
+ * returns:
+ *   true if interior face tiles may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_i_faces_tiles_allowed(void)
+{
+  if (   _i_faces_adjacent_to_halo_last
+      || _i_faces_base_ordering != CS_RENUMBER_ADJACENT_LOW)
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Order interior faces by tile of their lowest adjacent cell, preserving
+ * the existing order inside each tile.
+ *
+ * parameters:
+ *   mesh <-> pointer to global mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_renumber_i_faces_by_tiles(cs_mesh_t  *mesh)
+{
+  cs_lnum_t *c_tile_id = _cell_tile_ids(mesh);
+
+  if (c_tile_id == NULL)
+    return;
+
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+
+  cs_lnum_t *new_to_old_i, *ft_num;
+  BFT_MALLOC(new_to_old_i, n_i_faces, cs_lnum_t);
+  BFT_MALLOC(ft_num, n_i_faces*2, cs_lnum_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t c_id = CS_MIN(mesh->i_face_cells[f_id][0],
+                            mesh->i_face_cells[f_id][1]);
+    ft_num[f_id*2] = c_tile_id[c_id];
+    ft_num[f_id*2 + 1] = f_id;
+  }
+
+  cs_order_lnum_allocated_s(NULL, ft_num, 2, new_to_old_i, n_i_faces);
+
+  BFT_FREE(ft_num);
+  BFT_FREE(c_tile_id);
+
+  /* Check numbering is non trivial */
+
+  {
+    cs_lnum_t f_id = 0;
+    while (f_id < n_i_faces) {
+      if (new_to_old_i[f_id] != f_id)
+        break;
+      else
+        f_id++;
+    }
+    if (f_id == n_i_faces)
+      BFT_FREE(new_to_old_i);
+  }
+
+  /* Update connectivity */
+
+  if (new_to_old_i != NULL)
+    _cs_renumber_update_i_faces(mesh, new_to_old_i);
+
+  BFT_FREE(new_to_old_i);
+}
+
+/*----------------------------------------------------------------------------
+ * Define cache blocking tiles for faces, based on cell tiles.
+ *
+ * Faces of tile t are those whose lowest adjacent cell belongs to
+ * cell tile t. Tiles are defined only if faces are ordered tile by tile,
+ * which is not the case for faces colored for threads or vectorization.
+ *
+ * parameters:
+ *   mesh       <-- pointer to global mesh structure
+ *   n_faces    <-- number of faces
+ *   stride     <-- number of adjacent cells per face (2 or 1)
+ *   face_cells <-- face -> cells connectivity
+ *   numbering  <-> associated face numbering
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_face_tiles(const cs_mesh_t  *mesh,
+                   cs_lnum_t         n_faces,
+                   int               stride,
+                   const cs_lnum_t   face_cells[],
+                   cs_numbering_t   *numbering)
+{
+  const cs_numbering_t *c_num = mesh->cell_numbering;
+
+  if (c_num == NULL || c_num->n_tiles < 1 || numbering == NULL)
+    return;
+
+  const int n_tiles = c_num->n_tiles;
+  const cs_lnum_t *c_tile_index = c_num->tile_index;
+
+  cs_lnum_t *tile_index;
+  BFT_MALLOC(tile_index, n_tiles + 1, cs_lnum_t);
+
+  int t_id = 0;
+  tile_index[0] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+
+    cs_lnum_t c_id = face_cells[f_id*stride];
+    for (int i = 1; i < stride; i++)
+      c_id = CS_MIN(c_id, face_cells[f_id*stride + i]);
+
+    if (c_id < c_tile_index[t_id]) { /* faces not ordered by tiles */
+      BFT_FREE(tile_index);
+      return;
+    }
+
+    while (c_id >= c_tile_index[t_id+1]) {
+      t_id++;
+      tile_index[t_id] = f_id;
+    }
+
+  }
+
+  while (t_id < n_tiles) {
+    t_id++;
+    tile_index[t_id] = n_faces;
+  }
+
+  cs_numbering_set_tiles(numbering, n_tiles, tile_index);
+
+  BFT_FREE(tile_index);
+}
+
 /*----------------------------------------------------------------------------
  * Build groups including independent faces.
  *
@@ -4905,6 +5147,8 @@ _renumber_cells(cs_mesh_t  *mesh)
     bft_printf(_("\n Cell renumbering (%s) failed.\n"),
                _cell_renum_name[_cells_algorithm[1]]);
 
+  _define_cell_tiles(mesh);
+
   if (_cells_algorithm[1] != CS_RENUMBER_CELLS_NONE)
     bft_printf
       ("\n ----------------------------------------------------------\n");
@@ -5004,9 +5248,24 @@ _renumber_i_faces(cs_mesh_t  *mesh)
                                             new_to_old_i);
     break;
 
+  case CS_RENUMBER_I_FACES_GATHER:
+    /* Operations supporting it gather face values by cell (see
+       cs_mesh_adjacencies_gather_c2f); other face loops still
+       use the multipass thread groups. */
+    numbering_type = CS_NUMBERING_THREADS;
+    retval = _renum_face_multipass(mesh,
+                                   n_i_threads,
+                                   new_to_old_i,
+                                   &n_i_groups,
+                                   &n_i_no_adj_halo_groups,
+                                   &i_group_index);
+    break;
+
   case CS_RENUMBER_I_FACES_NONE:
   default:
     _renumber_i_faces_by_cell_adjacency(mesh);
+    if (_i_faces_tiles_allowed())
+      _renumber_i_faces_by_tiles(mesh);
     retval = -1;
     break;
   }
@@ -5044,6 +5303,13 @@ _renumber_i_faces(cs_mesh_t  *mesh)
     mesh->i_face_numbering
       = cs_numbering_create_default(mesh->n_i_faces);
 
+  if (_i_faces_tiles_allowed())
+    _define_face_tiles(mesh,
+                       mesh->n_i_faces,
+                       2,
+                       (const cs_lnum_t *)mesh->i_face_cells,
+                       mesh->i_face_numbering);
+
   if (mesh->verbosity > 0)
     cs_numbering_log_info(CS_LOG_DEFAULT,
                           _("interior faces"),
@@ -5163,6 +5429,12 @@ _renumber_b_faces(cs_mesh_t  *mesh)
 
   mesh->b_face_numbering->n_no_adj_halo_groups = 0;
 
+  _define_face_tiles(mesh,
+                     mesh->n_b_faces,
+                     1,
+                     mesh->b_face_cells,
+                     mesh->b_face_numbering);
+
   if (mesh->verbosity > 0)
     cs_numbering_log_info(CS_LOG_DEFAULT,
                           _("boundary faces"),
@@ -5646,6 +5918,11 @@ _renumber_mesh(cs_mesh_t  *mesh)
        _(no_yes[c_halo_adj_last]),
        _(_cell_renum_name[_cells_algorithm[1]]));
 
+    if (_tile_cache_size > 0)
+      bft_printf
+        (_("     cache blocking tiles size:           %llu KiB\n"),
+         (unsigned long long)(_tile_cache_size/1024));
+
     bft_printf
       (_("\n"
          "   renumbering for interior faces:\n"
@@ -5775,6 +6052,47 @@ cs_renumber_get_min_subset_size(cs_lnum_t  *min_i_subset_size,
     *min_b_subset_size = _min_b_subset_size;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the cache size used to define cache blocking tiles.
+ *
+ * When non-zero, cells are grouped into tiles of consecutive cells whose
+ * data (and that of their faces) should fit in the given cache size.
+ * Faces are then ordered tile by tile when their numbering is not
+ * colored for threads or vectorization, and tile boundaries are stored
+ * in the cell and face numberings, so that face and cell loops may be
+ * fused tile by tile.
+ *
+ * Interior faces are not ordered or grouped by tiles when they are placed
+ * by highest adjacent cell id first, or when faces adjacent to ghost cells
+ * are placed last (see \ref cs_renumber_set_algorithm), as this would
+ * override those orderings; loops are not fused in this case.
+ *
+ * \param[in]  cache_size  target cache size in bytes (usually the
+ *                         L2 cache size per core), or 0 for no tiles
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_tile_cache_size(size_t  cache_size)
+{
+  _tile_cache_size = cache_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cache size used to define cache blocking tiles.
+ *
+ * \return  target cache size in bytes, or 0 if tiles are not used
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_renumber_get_tile_cache_size(void)
+{
+  return _tile_cache_size;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Select the algorithm for mesh renumbering.
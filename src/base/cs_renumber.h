@@ -66,6 +66,7 @@ typedef enum {
   CS_RENUMBER_I_FACES_BLOCK,         /* No shared cell in block */
   CS_RENUMBER_I_FACES_MULTIPASS,     /* Use multipass face numbering */
   CS_RENUMBER_I_FACES_SIMD,          /* Renumber for vector (SIMD) operations */
+  CS_RENUMBER_I_FACES_GATHER,        /* Gather by cells where supported */
   CS_RENUMBER_I_FACES_NONE           /* No interior face numbering */
 
 } cs_renumber_i_faces_type_t;
@@ -150,6 +151,29 @@ void
 cs_renumber_get_min_subset_size(cs_lnum_t  *min_i_subset_size,
                                 cs_lnum_t  *min_b_subset_size);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the cache size used to define cache blocking tiles.
+ *
+ * \param[in]  cache_size  target cache size in bytes (usually the
+ *                         L2 cache size per core), or 0 for no tiles
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_tile_cache_size(size_t  cache_size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cache size used to define cache blocking tiles.
+ *
+ * \return  target cache size in bytes, or 0 if tiles are not used
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_renumber_get_tile_cache_size(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Select the algorithm for mesh renumbering.
@@ -97,6 +97,12 @@ BEGIN_C_DECLS
  * Local macro definitions
  *============================================================================*/
 
+/* Number of locations always defined first (cells, interior faces,
+   boundary faces, and vertices), on which delta checkpoints may
+   omit sections */
+
+#define _N_MESH_LOCATIONS  4
+
 /*============================================================================
  * Local type definitions
  *============================================================================*/
@@ -122,12 +128,22 @@ struct _cs_restart_t {
   cs_io_t           *fh;             /* Pointer to associated file handle */
   int                rank_step;      /* Block rank step for parallel IO */
   int                min_block_size; /* Minimum block size for parallel IO */
+  bool               async;          /* Asynchronous block writes active */
 
   size_t             n_locations;    /* Number of locations */
   _location_t       *location;       /* Location definition array */
 
   cs_restart_mode_t  mode;           /* Read or write */
 
+  int                writer_id;      /* Associated multiwriter id
+                                        (write mode), or -1 */
+  bool               delta;          /* Only write sections which changed
+                                        since the last full checkpoint */
+
+  struct _cs_restart_t  *base;       /* Full checkpoint on which a delta
+                                        checkpoint is based (read mode),
+                                        or NULL */
+
 };
 
 typedef struct {
@@ -142,6 +158,19 @@ typedef struct {
   int    n_prev_files_tot;  /* Total number of times this file has already
                                been written */
   char **prev_files;        /* Names of the previous versions */
+  bool  *prev_full;         /* Are previous versions full checkpoints */
+
+  bool   last_full;         /* Is the last version a full checkpoint */
+  int    n_deltas;          /* Number of delta checkpoints since the
+                               last full checkpoint */
+  char  *base_file;         /* Path of the last full checkpoint, relative
+                               to the checkpoint directory, or NULL */
+
+  int                  n_base_sections;    /* Number of sections in last
+                                              full checkpoint */
+  char               **base_sec_name;      /* Section names */
+  int                 *base_sec_location;  /* Section location ids */
+  unsigned long long  *base_sec_hash;      /* Section contents hash */
 
 } _restart_multiwriter_t;
 
@@ -208,6 +237,24 @@ static double _checkpoint_wt_interval = -1.; /* wall-clock interval */
 static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
+/* Asynchronous checkpoint writing */
+
+static bool       _checkpoint_async = false; /* write blocks asynchronously */
+static int        _n_pending_io = 0;         /* number of closed checkpoint
+                                                files with pending writes */
+static cs_io_t  **_pending_io = NULL;        /* closed checkpoint files
+                                                with pending writes */
+
+/* Checkpoint section compression */
+
+static cs_io_compression_t  _checkpoint_compression = CS_IO_COMPRESSION_NONE;
+static double               _checkpoint_comp_tolerance = 0.;
+
+/* Incremental checkpoints: number of delta checkpoints between
+   full checkpoints */
+
+static int        _checkpoint_n_deltas = 0;
+
 /* Are we restarting from a NCFD file ? */
 
 static int    _restart_from_ncfd = 0;
@@ -376,6 +423,11 @@ _add_file(cs_restart_t  *r)
                                hints,
                                block_comm,
                                comm);
+      if (_checkpoint_async)
+        r->async = cs_io_set_async_write(r->fh, true);
+      cs_io_set_compression(r->fh,
+                            _checkpoint_compression,
+                            _checkpoint_comp_tolerance);
     }
   }
 #else
@@ -395,6 +447,9 @@ _add_file(cs_restart_t  *r)
                                CS_IO_MODE_WRITE,
                                method,
                                echo);
+      cs_io_set_compression(r->fh,
+                            _checkpoint_compression,
+                            _checkpoint_comp_tolerance);
     }
   }
 #endif
@@ -405,6 +460,223 @@ _add_file(cs_restart_t  *r)
   _restart_n_opens[r->mode] += 1;
 }
 
+/*----------------------------------------------------------------------------
+ * Ensure progress of pending asynchronous checkpoint writes, releasing
+ * staging buffers of completed writes.
+ *----------------------------------------------------------------------------*/
+
+static void
+_restart_async_progress(void)
+{
+  for (int i = 0; i < _n_pending_io; i++)
+    cs_io_test_async_write(_pending_io[i]);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete pending asynchronous checkpoint writes and close
+ * associated files.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   name <-- if non-NULL, only complete writes to the file with this name
+ *----------------------------------------------------------------------------*/
+
+static void
+_restart_async_wait(const char  *name)
+{
+  if (_n_pending_io == 0)
+    return;
+
+  double t0 = cs_timer_wtime();
+
+  int j = 0;
+  for (int i = 0; i < _n_pending_io; i++) {
+    if (name == NULL || strcmp(cs_io_get_name(_pending_io[i]), name) == 0)
+      cs_io_finalize(&(_pending_io[i]));
+    else
+      _pending_io[j++] = _pending_io[i];
+  }
+  _n_pending_io = j;
+
+  if (_n_pending_io == 0)
+    BFT_FREE(_pending_io);
+
+  _restart_wtime[CS_RESTART_MODE_WRITE] += cs_timer_wtime() - t0;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the id of the location of the base checkpoint matching a given
+ * location of a delta checkpoint.
+ *
+ * parameters:
+ *   r           <-- associated restart file pointer
+ *   location_id <-- location id in r
+ *
+ * returns:
+ *   matching location id in r->base, or -1 if not found
+ *----------------------------------------------------------------------------*/
+
+static int
+_base_location_id(const cs_restart_t  *r,
+                  int                  location_id)
+{
+  if (location_id <= 0)
+    return location_id;
+
+  if (location_id > (int)(r->n_locations))
+    return -1;
+
+  const char *name = (r->location[location_id-1]).name;
+
+  for (size_t i = 0; i < r->base->n_locations; i++) {
+    if (strcmp((r->base->location[i]).name, name) == 0)
+      return i + 1;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Open the full checkpoint on which a delta checkpoint file is based,
+ * if this file references one.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer (read mode)
+ *----------------------------------------------------------------------------*/
+
+static void
+_open_base_checkpoint(cs_restart_t  *r)
+{
+  size_t index_size = cs_io_get_index_size(r->fh);
+
+  for (size_t rec_id = 0; rec_id < index_size; rec_id++) {
+
+    cs_io_sec_header_t h = cs_io_get_indexed_sec_header(r->fh, rec_id);
+
+    if (strcmp(h.sec_name, "checkpoint:base") != 0 || h.elt_type != CS_CHAR)
+      continue;
+
+    char *base_name = NULL, *dir_name = NULL;
+    BFT_MALLOC(base_name, h.n_vals + 1, char);
+
+    cs_io_set_indexed_position(r->fh, &h, rec_id);
+    cs_io_read_global(&h, base_name, r->fh);
+    base_name[h.n_vals] = '\0';
+
+    /* Base path is relative to the top-level checkpoint directory,
+       which is the parent of the directory containing this file if
+       it has been moved to a "previous_dump_<n>" sub-directory */
+
+    BFT_MALLOC(dir_name, strlen(r->name) + 1, char);
+    strcpy(dir_name, r->name);
+    char *sep = strrchr(dir_name, _dir_separator);
+    if (sep != NULL)
+      *sep = '\0';
+    else
+      strcpy(dir_name, ".");
+
+    sep = strrchr(dir_name, _dir_separator);
+    const char *sub_dir = (sep != NULL) ? sep + 1 : dir_name;
+    if (strncmp(sub_dir, "previous_dump_", strlen("previous_dump_")) == 0) {
+      if (sep != NULL)
+        *sep = '\0';
+      else
+        strcpy(dir_name, ".");
+    }
+
+    bft_printf(_("  %s: delta checkpoint based on \"%s\".\n"),
+               r->name, base_name);
+
+    r->base = cs_restart_create(base_name, dir_name, CS_RESTART_MODE_READ);
+
+    BFT_FREE(dir_name);
+    BFT_FREE(base_name);
+
+    break;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a hash of a section's contents.
+ *
+ * The hash depends on the partitioning, so it may only be used to compare
+ * sections written during the same computation.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- value type
+ *   val             <-- array of values
+ *
+ * returns:
+ *   hash value (identical on all ranks)
+ *----------------------------------------------------------------------------*/
+
+static unsigned long long
+_section_hash(const cs_restart_t     *r,
+              int                     location_id,
+              int                     n_location_vals,
+              cs_restart_val_type_t   val_type,
+              const void             *val)
+{
+  size_t type_size = 0;
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    type_size = 1;
+    break;
+  case CS_TYPE_int:
+    type_size = sizeof(int);
+    break;
+  case CS_TYPE_cs_gnum_t:
+    type_size = sizeof(cs_gnum_t);
+    break;
+  case CS_TYPE_cs_real_t:
+    type_size = sizeof(cs_real_t);
+    break;
+  default:
+    assert(0);
+  }
+
+  size_t n_vals = n_location_vals;
+  if (location_id > 0)
+    n_vals *= (r->location[location_id-1]).n_ents;
+
+  /* 64-bit FNV-1a hash, with a rank-dependent offset basis */
+
+  const unsigned long long fnv_prime = 1099511628211ULL;
+
+  unsigned long long h = 14695981039346656037ULL;
+  h ^= (unsigned long long)(cs_glob_rank_id + 1) * 0x9e3779b97f4a7c15ULL;
+  h *= fnv_prime;
+  h ^= ((unsigned long long)location_id << 8) | (unsigned)val_type;
+  h *= fnv_prime;
+  h ^= (unsigned long long)n_vals;
+  h *= fnv_prime;
+
+  const unsigned char *p = (const unsigned char *)val;
+  size_t n_bytes = (val != NULL) ? n_vals*type_size : 0;
+
+  for (size_t i = 0; i < n_bytes; i++) {
+    h ^= p[i];
+    h *= fnv_prime;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    unsigned long long h_l = h;
+    MPI_Allreduce(&h_l, &h, 1, MPI_UNSIGNED_LONG_LONG, MPI_BXOR,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  return h;
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -568,10 +840,10 @@ _write_ent_values(const cs_restart_t     *r,
                                    r->min_block_size / nbr_byte_ent,
                                    n_glob_ents);
 
-  d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
-                                      bi,
-                                      n_ents,
-                                      ent_global_num);
+  d = cs_part_to_block_create_by_gnum_persistent(cs_glob_mpi_comm,
+                                                 bi,
+                                                 n_ents,
+                                                 ent_global_num);
 
   /* Distribute to blocks */
 
@@ -1073,10 +1345,18 @@ _check_section(cs_restart_t           *restart,
       break;
   }
 
-  /* If the record was not found */
+  /* If the record was not found, it may be in the base checkpoint */
 
-  if (rec_id >= index_size)
+  if (rec_id >= index_size) {
+    if (restart->base != NULL)
+      return _check_section(restart->base,
+                            context,
+                            sec_name,
+                            _base_location_id(restart, location_id),
+                            n_location_vals,
+                            val_type);
     return CS_RESTART_ERR_EXISTS;
+  }
 
   /*
     If the location does not fit: we search for a location of same
@@ -1213,9 +1493,17 @@ _read_section(cs_restart_t           *restart,
       break;
   }
 
-  /* If the record was not found */
+  /* If the record was not found, it may be in the base checkpoint */
 
   if (rec_id >= index_size) {
+    if (restart->base != NULL)
+      return _read_section(restart->base,
+                           context,
+                           sec_name,
+                           _base_location_id(restart, location_id),
+                           n_location_vals,
+                           val_type,
+                           val);
     bft_printf(_("  %s: section \"%s\" not present.\n"),
                restart->name, sec_name);
     return CS_RESTART_ERR_EXISTS;
@@ -1620,6 +1908,16 @@ _restart_multiwriter_create(void)
   new_writer->n_prev_files = -1;  /* set at 0 after first (single) output */
   new_writer->n_prev_files_tot = 0;
   new_writer->prev_files = NULL;
+  new_writer->prev_full = NULL;
+
+  new_writer->last_full = true;
+  new_writer->n_deltas = 0;
+  new_writer->base_file = NULL;
+
+  new_writer->n_base_sections = 0;
+  new_writer->base_sec_name = NULL;
+  new_writer->base_sec_location = NULL;
+  new_writer->base_sec_hash = NULL;
 
   return new_writer;
 }
@@ -1743,6 +2041,9 @@ _restart_multiwriter_increment(_restart_multiwriter_t  *mw,
     BFT_MALLOC(mw->prev_files, mw->n_prev_files, char *);
   else
     BFT_REALLOC(mw->prev_files, mw->n_prev_files, char *);
+  BFT_REALLOC(mw->prev_full, mw->n_prev_files, bool);
+
+  mw->prev_full[mw->n_prev_files - 1] = mw->last_full;
 
   mw->prev_files[mw->n_prev_files - 1] = NULL;
   size_t lenf = strlen(fname) + 1;
@@ -1750,6 +2051,92 @@ _restart_multiwriter_increment(_restart_multiwriter_t  *mw,
   strcpy(mw->prev_files[mw->n_prev_files - 1], fname);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the section hashes of a multiwriter's last full checkpoint.
+ *
+ * \param[in, out] mw  pointer to the multiwriter object.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_restart_multiwriter_reset_base(_restart_multiwriter_t  *mw)
+{
+  for (int i = 0; i < mw->n_base_sections; i++)
+    BFT_FREE(mw->base_sec_name[i]);
+
+  BFT_FREE(mw->base_sec_name);
+  BFT_FREE(mw->base_sec_location);
+  BFT_FREE(mw->base_sec_hash);
+
+  mw->n_base_sections = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check whether a section needs to be written to a checkpoint file,
+ *        and record its hash for a full checkpoint.
+ *
+ * This function is collective.
+ *
+ * \param[in]  r                associated restart file pointer
+ * \param[in]  sec_name         section name
+ * \param[in]  location_id      id of corresponding location
+ * \param[in]  n_location_vals  number of values per location (interlaced)
+ * \param[in]  val_type         value type
+ * \param[in]  val              array of values
+ *
+ * \return  true if the section must be written, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_restart_section_changed(const cs_restart_t     *r,
+                         const char             *sec_name,
+                         int                     location_id,
+                         int                     n_location_vals,
+                         cs_restart_val_type_t   val_type,
+                         const void             *val)
+{
+  _restart_multiwriter_t *mw = _restart_multiwriter_by_id(r->writer_id);
+
+  if (   mw == NULL || _checkpoint_n_deltas < 1
+      || location_id < 0 || location_id > _N_MESH_LOCATIONS)
+    return true;
+
+  unsigned long long h = _section_hash(r,
+                                       location_id,
+                                       n_location_vals,
+                                       val_type,
+                                       val);
+
+  int sec_id;
+  for (sec_id = 0; sec_id < mw->n_base_sections; sec_id++) {
+    if (   mw->base_sec_location[sec_id] == location_id
+        && strcmp(mw->base_sec_name[sec_id], sec_name) == 0)
+      break;
+  }
+
+  if (r->delta)
+    return (sec_id >= mw->n_base_sections || mw->base_sec_hash[sec_id] != h);
+
+  /* Full checkpoint: record hash */
+
+  if (sec_id >= mw->n_base_sections) {
+    int n = mw->n_base_sections + 1;
+    BFT_REALLOC(mw->base_sec_name, n, char *);
+    BFT_REALLOC(mw->base_sec_location, n, int);
+    BFT_REALLOC(mw->base_sec_hash, n, unsigned long long);
+    BFT_MALLOC(mw->base_sec_name[sec_id], strlen(sec_name) + 1, char);
+    strcpy(mw->base_sec_name[sec_id], sec_name);
+    mw->base_sec_location[sec_id] = location_id;
+    mw->n_base_sections = n;
+  }
+  mw->base_sec_hash[sec_id] = h;
+
+  return true;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1913,6 +2300,93 @@ cs_restart_checkpoint_set_mesh_mode(int  mode)
   _checkpoint_mesh = mode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, section data is distributed and copied to staging
+ * buffers, but the computation resumes without waiting for the data to reach
+ * the file system. Files are closed when their writes are completed, which
+ * is ensured at the latest when a checkpoint file of the same name is
+ * written again, or when \ref cs_restart_checkpoint_wait is called.
+ *
+ * This requires MPI-IO based file access with explicit offsets
+ * positioning; otherwise, writes remain synchronous.
+ *
+ * \param[in]  async  true for asynchronous writing, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async)
+{
+  _checkpoint_async = async;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define compression of checkpoint file sections.
+ *
+ * Lossless compression is recommended for checkpoint files, as restarting
+ * from lossy data does not reproduce the original computation.
+ *
+ * \param[in]  compression  compression mode
+ * \param[in]  tolerance    absolute error bound for lossy compression
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_compression(cs_io_compression_t  compression,
+                                      double               tolerance)
+{
+  _checkpoint_compression = compression;
+  _checkpoint_comp_tolerance = tolerance;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define incremental checkpointing.
+ *
+ * With incremental checkpointing, each full checkpoint is followed by
+ * up to n_deltas delta checkpoints, in which sections defined on the
+ * main mesh locations (or global sections) are only written if they
+ * changed since the last full checkpoint. Changes are detected using a
+ * hash of each section's contents.
+ *
+ * A delta checkpoint references the full checkpoint on which it is based
+ * (renamed to a "previous_dump_<n>" sub-directory when the next checkpoint
+ * is written) through a path relative to its own directory, so the
+ * checkpoint directory structure must be kept when restarting; missing
+ * sections are then read from that full checkpoint. Full checkpoints
+ * are not removed while retained delta checkpoints depend on them.
+ *
+ * \param[in]  n_deltas  number of delta checkpoints between full
+ *                       checkpoints (0 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_incremental(int  n_deltas)
+{
+  _checkpoint_n_deltas = CS_MAX(n_deltas, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of pending asynchronous checkpoint writes,
+ *         and close the associated files.
+ *
+ * This function is collective, and must be called before the end of the
+ * computation if asynchronous checkpointing is active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void)
+{
+  _restart_async_wait(NULL);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -1973,6 +2447,8 @@ cs_restart_checkpoint_set_next_wt(double  wt_next)
 /*!
  * \brief  Check if checkpointing is recommended at a given time.
  *
+ * This also ensures progress of pending asynchronous checkpoint writes.
+ *
  * \param[in]  ts  time step status structure
  *
  * \return  true if checkpointing is recommended, false otherwise
@@ -1984,6 +2460,8 @@ cs_restart_checkpoint_required(const cs_time_step_t  *ts)
 {
   assert(ts != NULL);
 
+  _restart_async_progress();
+
   int nt = ts->nt_cur - ts->nt_prev;
   double t = ts->t_cur - ts->t_prev;
 
@@ -2136,6 +2614,9 @@ cs_restart_create(const char         *name,
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
 
+  int restart_writer_id = -1;
+  bool restart_delta = false;
+
   /* Ensure mesh checkpoint is updated on first call */
 
   if (    mode == CS_RESTART_MODE_WRITE
@@ -2209,6 +2690,9 @@ cs_restart_create(const char         *name,
 
   } else if (mode == CS_RESTART_MODE_WRITE) {
 
+    /* Complete previous asynchronous writes to this file if present */
+    _restart_async_wait(_name);
+
     /* Check if file already exists, and if so rename and delete if needed */
     int writer_id = _add_restart_multiwriter(name, _name);
     _restart_multiwriter_t *mw = _restart_multiwriter_by_id(writer_id);
@@ -2249,10 +2733,35 @@ cs_restart_create(const char         *name,
 
       _restart_multiwriter_increment(mw, _re_name);
 
+      /* Delta checkpoints reference the last full checkpoint
+         relative to the checkpoint directory */
+
+      if (mw->last_full) {
+        BFT_REALLOC(mw->base_file, lsdir + lname + 2, char);
+        strcpy(mw->base_file, _re_name + ldir + 1);
+      }
+
       BFT_FREE(_re_name);
     }
     else
       mw->n_prev_files = 0;
+
+    /* Choose between full and delta checkpoint */
+
+    restart_writer_id = writer_id;
+
+    if (   _checkpoint_n_deltas > 0 && mw->base_file != NULL
+        && mw->n_deltas < _checkpoint_n_deltas) {
+      restart_delta = true;
+      mw->n_deltas += 1;
+      mw->last_full = false;
+    }
+    else {
+      _restart_multiwriter_reset_base(mw);
+      BFT_FREE(mw->base_file);
+      mw->n_deltas = 0;
+      mw->last_full = true;
+    }
   }
 
   /* Allocate and initialize base structure */
@@ -2273,6 +2782,11 @@ cs_restart_create(const char         *name,
 
   restart->rank_step = 1;
   restart->min_block_size = 0;
+  restart->async = false;
+
+  restart->writer_id = restart_writer_id;
+  restart->delta = restart_delta;
+  restart->base = NULL;
 
   /* Initialize location data */
 
@@ -2298,6 +2812,22 @@ cs_restart_create(const char         *name,
                           mesh->n_g_vertices, mesh->n_vertices,
                           mesh->global_vtx_num);
 
+  /* Reference the base checkpoint of a delta checkpoint */
+
+  if (restart->delta) {
+    _restart_multiwriter_t *mw = _restart_multiwriter_by_id(restart_writer_id);
+    cs_io_write_global("checkpoint:base",
+                       strlen(mw->base_file),
+                       0,
+                       0,
+                       1,
+                       CS_CHAR,
+                       mw->base_file,
+                       restart->fh);
+  }
+  else if (mode == CS_RESTART_MODE_READ)
+    _open_base_checkpoint(restart);
+
   timing[1] = cs_timer_wtime();
   _restart_wtime[mode] += timing[1] - timing[0];
 
@@ -2327,9 +2857,23 @@ cs_restart_destroy(cs_restart_t  **restart)
 
   mode = r->mode;
 
+  /* With asynchronous writes, the file is closed only once pending writes
+     are completed (at the next checkpoint or at the end of the computation),
+     so as not to wait for them here */
+
+  if (r->fh != NULL && r->async) {
+    BFT_REALLOC(_pending_io, _n_pending_io + 1, cs_io_t *);
+    _pending_io[_n_pending_io] = r->fh;
+    _n_pending_io += 1;
+    r->fh = NULL;
+  }
+
   if (r->fh != NULL)
     cs_io_finalize(&(r->fh));
 
+  if (r->base != NULL)
+    cs_restart_destroy(&(r->base));
+
   /* Free locations array */
 
   if (r->n_locations > 0) {
@@ -2453,6 +2997,18 @@ cs_restart_add_location(cs_restart_t     *restart,
         (restart->location[loc_id]).ent_global_num = ent_global_num;
         (restart->location[loc_id])._ent_global_num = NULL;
 
+        /* Update matching location of base checkpoint */
+
+        if (restart->base != NULL) {
+          int base_loc_id = _base_location_id(restart, loc_id + 1);
+          if (base_loc_id > 0)
+            cs_restart_add_location(restart->base,
+                                    location_name,
+                                    n_glob_ents,
+                                    n_ents,
+                                    ent_global_num);
+        }
+
         timing[1] = cs_timer_wtime();
         _restart_wtime[restart->mode] += timing[1] - timing[0];
 
@@ -2842,6 +3398,19 @@ cs_restart_write_section(cs_restart_t           *restart,
 
   assert(restart != NULL);
 
+  /* Sections unchanged since the last full checkpoint are not
+     written to delta checkpoints */
+
+  if (!_restart_section_changed(restart,
+                                sec_name,
+                                location_id,
+                                n_location_vals,
+                                val_type,
+                                val)) {
+    _restart_wtime[restart->mode] += cs_timer_wtime() - timing[0];
+    return;
+  }
+
   _write_section_f(restart,
                    _restart_context,
                    sec_name,
@@ -4082,7 +4651,33 @@ cs_restart_clean_multiwriters_history(void)
       = mw->n_prev_files - _n_restart_directories_to_write + 1;
 
     if (n_files_to_remove > 0) {
-      for (int ii = 0; ii < n_files_to_remove; ii++) {
+
+      int n_kept = 0;
+
+      for (int ii = 0; ii < mw->n_prev_files; ii++) {
+
+        bool remove = (ii < n_files_to_remove);
+
+        /* A full checkpoint is kept as long as a retained delta
+           checkpoint depends on it */
+
+        if (remove && mw->prev_full[ii]) {
+          int jj = ii + 1;
+          while (jj < mw->n_prev_files && !mw->prev_full[jj]) {
+            if (jj >= n_files_to_remove)
+              remove = false;
+            jj++;
+          }
+          if (jj >= mw->n_prev_files && !mw->last_full)
+            remove = false;
+        }
+
+        if (!remove) {
+          mw->prev_files[n_kept] = mw->prev_files[ii];
+          mw->prev_full[n_kept] = mw->prev_full[ii];
+          n_kept++;
+          continue;
+        }
 
         if (cs_glob_rank_id <= 0) {
           char *path = mw->prev_files[ii];
@@ -4105,15 +4700,7 @@ cs_restart_clean_multiwriters_history(void)
 
       }
 
-      /* Rotate available paths */
-
-      int ii = 0;
-      for (int jj = n_files_to_remove; jj < mw->n_prev_files; jj++) {
-        mw->prev_files[ii] = mw->prev_files[jj];
-        mw->prev_files[jj] = NULL;
-      }
-
-      mw->n_prev_files -= n_files_to_remove;
+      mw->n_prev_files = n_kept;
       /* No need for extra reallocation of mw->prev_files */
     }
 
@@ -4139,6 +4726,10 @@ cs_restart_multiwriters_destroy_all(void)
       for (int j = 0; j < w->n_prev_files; j++)
         BFT_FREE(w->prev_files[j]);
       BFT_FREE(w->prev_files);
+      BFT_FREE(w->prev_full);
+
+      _restart_multiwriter_reset_base(w);
+      BFT_FREE(w->base_file);
 
       BFT_FREE(w);
 
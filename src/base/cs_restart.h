@@ -37,6 +37,7 @@
 
 #include "cs_defs.h"
 
+#include "cs_io.h"
 #include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------*/
@@ -320,6 +321,72 @@ cs_restart_checkpoint_set_defaults(int     nt_interval,
 void
 cs_restart_checkpoint_set_mesh_mode(int  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, section data is distributed and copied to staging
+ * buffers, but the computation resumes without waiting for the data to reach
+ * the file system. Files are closed when their writes are completed, which
+ * is ensured at the latest when a checkpoint file of the same name is
+ * written again, or when \ref cs_restart_checkpoint_wait is called.
+ *
+ * This requires MPI-IO based file access with explicit offsets
+ * positioning; otherwise, writes remain synchronous.
+ *
+ * \param[in]  async  true for asynchronous writing, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define compression of checkpoint file sections.
+ *
+ * Lossless compression is recommended for checkpoint files, as restarting
+ * from lossy data does not reproduce the original computation.
+ *
+ * \param[in]  compression  compression mode
+ * \param[in]  tolerance    absolute error bound for lossy compression
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_compression(cs_io_compression_t  compression,
+                                      double               tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define incremental checkpointing.
+ *
+ * With incremental checkpointing, each full checkpoint is followed by
+ * up to n_deltas delta checkpoints, in which sections defined on the
+ * main mesh locations (or global sections) are only written if they
+ * changed since the last full checkpoint.
+ *
+ * \param[in]  n_deltas  number of delta checkpoints between full
+ *                       checkpoints (0 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_incremental(int  n_deltas);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of pending asynchronous checkpoint writes,
+ *         and close the associated files.
+ *
+ * This function is collective, and must be called before the end of the
+ * computation if asynchronous checkpointing is active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -368,6 +435,8 @@ cs_restart_checkpoint_set_next_wt(double  wt_next);
 /*!
  * \brief  Check if checkpointing is recommended at a given time.
  *
+ * This also ensures progress of pending asynchronous checkpoint writes.
+ *
  * \param[in]  ts  time step status structure
  *
  * \return  true if checkpointing is recommended, false otherwise
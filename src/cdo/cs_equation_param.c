@@ -394,6 +394,10 @@ _set_key(cs_equation_param_t   *eqp,
     }
     else if (strcmp(keyval, "minres") == 0)
       eqp->sles_param->solver = CS_PARAM_ITSOL_MINRES;
+    else if (strcmp(keyval, "pipelined_bicgstab") == 0)
+      eqp->sles_param->solver = CS_PARAM_ITSOL_PIPELINED_BICGSTAB;
+    else if (strcmp(keyval, "pipelined_cg") == 0)
+      eqp->sles_param->solver = CS_PARAM_ITSOL_PIPELINED_CG;
 
     else if (strcmp(keyval, "mumps") == 0) {
       eqp->sles_param->solver = CS_PARAM_ITSOL_MUMPS;
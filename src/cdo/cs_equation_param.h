@@ -978,6 +978,10 @@ typedef struct {
  *                          systems)
  * - "cr3"              --> a 3-layer conjugate residual solver (when "cs" is
  *                          chosen as the solver family)
+ * - "pipelined_cg"     --> pipelined conjuguate gradient algorithm, with
+ *                          global reductions overlapped with computations
+ * - "pipelined_bicgstab" --> pipelined BiCG-Stab algorithm (for
+ *                          non-symmetric linear systems)
  * - "gmres"            --> robust iterative solver. Not the best choice if the
  *                          system is easy to solve
  * - "amg"              --> algebraic multigrid iterative solver. Good choice
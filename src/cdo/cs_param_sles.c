@@ -395,6 +395,14 @@ _petsc_set_krylov_solver(cs_param_sles_t    *slesp,
     KSPSetType(ksp, KSPMINRES);
     break;
 
+  case CS_PARAM_ITSOL_PIPELINED_BICGSTAB: /* Pipelined BiCGstab */
+    KSPSetType(ksp, KSPPIPEBCGS);
+    break;
+
+  case CS_PARAM_ITSOL_PIPELINED_CG: /* Pipelined Conjugate Gradient */
+    KSPSetType(ksp, KSPPIPECG);
+    break;
+
   case CS_PARAM_ITSOL_MUMPS:     /* Direct solver (factorization) */
   case CS_PARAM_ITSOL_MUMPS_LDLT:
 #if defined(PETSC_HAVE_MUMPS)
@@ -1260,6 +1268,22 @@ cs_equation_param_set_saturne_sles(bool                 use_field_id,
                            slesp->n_max_iter);
     break;
 
+  case CS_PARAM_ITSOL_PIPELINED_BICGSTAB:
+    it = cs_sles_it_define(slesp->field_id,
+                           sles_name,
+                           CS_SLES_PIPELINED_BICGSTAB,
+                           poly_degree,
+                           slesp->n_max_iter);
+    break;
+
+  case CS_PARAM_ITSOL_PIPELINED_CG:
+    it = cs_sles_it_define(slesp->field_id,
+                           sles_name,
+                           CS_SLES_PIPELINED_PCG,
+                           poly_degree,
+                           slesp->n_max_iter);
+    break;
+
   case CS_PARAM_ITSOL_SYM_GAUSS_SEIDEL:
     it = cs_sles_it_define(slesp->field_id,
                            sles_name,
@@ -32,6 +32,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <ctype.h>
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -73,6 +74,18 @@ BEGIN_C_DECLS
  * Local Type Definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Binary file with pending asynchronous writes
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_file_t   *bf;                 /* Binary file handling structure */
+  int          gen;                /* Output generation in which file
+                                      was last written */
+
+} _ensight_pending_file_t;
+
 /*----------------------------------------------------------------------------
  * EnSight Gold writer structure
  *----------------------------------------------------------------------------*/
@@ -94,6 +107,17 @@ typedef struct {
   bool         divide_polygons;    /* Option to tesselate polygonal elements */
   bool         divide_polyhedra;   /* Option to tesselate polyhedral elements */
 
+  int          precision_bits;     /* Default number of mantissa bits kept
+                                      for field values (23: full float) */
+  int          n_field_precisions; /* Number of field-specific precisions */
+  char       **field_names;        /* Names of fields with specific precision */
+  int         *field_bits;         /* Field-specific precisions */
+
+  bool         async_write;        /* Option to use asynchronous writes */
+  int          async_gen;          /* Current output generation */
+  int          n_pending;          /* Number of files with pending writes */
+  _ensight_pending_file_t  *pending;  /* Files with pending writes */
+
   fvm_to_ensight_case_t  *case_info;  /* Associated case structure */
 
 #if defined(HAVE_MPI)
@@ -114,6 +138,9 @@ typedef struct {
   FILE        *tf;                 /* Text file handing structure */
   cs_file_t   *bf;                 /* Binary file handling structure */
 
+  bool         async;              /* true if binary file uses
+                                      asynchronous writes */
+
 } _ensight_file_t;
 
 /*----------------------------------------------------------------------------
@@ -124,6 +151,7 @@ typedef struct {
 
   fvm_to_ensight_writer_t  *writer;    /* Pointer to writer structure */
   _ensight_file_t          *file;      /* Pointer to file handler structure */
+  int              precision_bits;     /* Mantissa bits kept for values */
 
 } _ensight_context_t;
 
@@ -150,21 +178,86 @@ static const int _ensight_c_order_6[6] = {0, 1, 2, 3, 5, 4};
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Complete pending asynchronous writes of EnSight Gold files and close them.
+ *
+ * Files written in the current output generation or later are kept
+ * unless all is true. This function must be called on all ranks of the
+ * writer's communicator, as closing a file is collective.
+ *
+ * parameters:
+ *   this_writer <-> pointer to Ensight Gold writer structure.
+ *   all         <-- if true, close all pending files
+ *----------------------------------------------------------------------------*/
+
+static void
+_close_pending_files(fvm_to_ensight_writer_t  *this_writer,
+                     bool                      all)
+{
+  int j = 0;
+
+  for (int i = 0; i < this_writer->n_pending; i++) {
+    _ensight_pending_file_t *p = this_writer->pending + i;
+    if (all || p->gen < this_writer->async_gen)
+      p->bf = cs_file_free(p->bf);
+    else {
+      cs_file_test_async_write(p->bf);
+      this_writer->pending[j++] = *p;
+    }
+  }
+
+  this_writer->n_pending = j;
+  if (j == 0)
+    BFT_FREE(this_writer->pending);
+}
+
+/*----------------------------------------------------------------------------
+ * Remove a file from the list of files with pending asynchronous writes.
+ *
+ * parameters:
+ *   this_writer <-> pointer to Ensight Gold writer structure.
+ *   filename    <-- name of file
+ *
+ * returns:
+ *   pointer to matching file handling structure, or NULL if none found
+ *----------------------------------------------------------------------------*/
+
+static cs_file_t *
+_pop_pending_file(fvm_to_ensight_writer_t  *this_writer,
+                  const char               *filename)
+{
+  cs_file_t *bf = NULL;
+
+  for (int i = 0; i < this_writer->n_pending; i++) {
+    if (strcmp(cs_file_get_name(this_writer->pending[i].bf), filename) == 0) {
+      bf = this_writer->pending[i].bf;
+      this_writer->n_pending -= 1;
+      this_writer->pending[i] = this_writer->pending[this_writer->n_pending];
+      break;
+    }
+  }
+
+  return bf;
+}
+
 /*----------------------------------------------------------------------------
  * Open an EnSight Gold geometry or variable file
  *
+ * If asynchronous writes are used and the file is still open with pending
+ * writes, it is reused directly when appending, or closed first otherwise.
+ *
  * parameters:
- *   this_writer <-- pointer to Ensight Gold writer structure.
+ *   this_writer <-> pointer to Ensight Gold writer structure.
  *   filename    <-- name of file to open.
  *   apend       <-- if true, append to file instead of overwriting
  *----------------------------------------------------------------------------*/
 
 static _ensight_file_t
-_open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
-                   const char                     *filename,
-                   bool                            append)
+_open_ensight_file(fvm_to_ensight_writer_t  *this_writer,
+                   const char               *filename,
+                   bool                      append)
 {
-  _ensight_file_t f = {NULL, NULL};
+  _ensight_file_t f = {NULL, NULL, false};
 
   if (this_writer->text_mode == true) {
     if (this_writer->rank == 0) {
@@ -180,6 +273,16 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
   }
   else {
 
+    if (this_writer->n_pending > 0) {
+      f.bf = _pop_pending_file(this_writer, filename);
+      if (f.bf != NULL) {
+        f.async = true;
+        if (append)
+          return f;
+        f.bf = cs_file_free(f.bf);
+      }
+    }
+
     cs_file_mode_t mode = append ? CS_FILE_MODE_APPEND : CS_FILE_MODE_WRITE;
     cs_file_access_t method;
 
@@ -203,6 +306,9 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 
     if (this_writer->swap_endian == true)
       cs_file_set_swap_endian(f.bf, 1);
+
+    if (this_writer->async_write)
+      f.async = cs_file_set_async_write(f.bf, true);
   }
 
   return f;
@@ -211,12 +317,17 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 /*----------------------------------------------------------------------------
  * close an EnSight Gold geometry or variable file
  *
+ * Binary files with asynchronous writes are only added to the writer's
+ * pending files list, and closed at a later flush.
+ *
  * parameters:
- *   f <-- pointer to file handler structure.
+ *   this_writer <-> pointer to Ensight Gold writer structure.
+ *   f           <-- pointer to file handler structure.
  *----------------------------------------------------------------------------*/
 
 static void
-_free_ensight_file(_ensight_file_t  *f)
+_free_ensight_file(fvm_to_ensight_writer_t  *this_writer,
+                   _ensight_file_t          *f)
 {
   if (f->tf != NULL) {
     if (fclose(f->tf) != 0)
@@ -226,10 +337,139 @@ _free_ensight_file(_ensight_file_t  *f)
     f->tf = NULL;
   }
 
+  else if (f->bf != NULL && f->async) {
+    int i = this_writer->n_pending;
+    BFT_REALLOC(this_writer->pending, i + 1, _ensight_pending_file_t);
+    this_writer->pending[i].bf = f->bf;
+    this_writer->pending[i].gen = this_writer->async_gen;
+    this_writer->n_pending += 1;
+    f->bf = NULL;
+  }
+
   else if (f->bf != NULL)
     f->bf = cs_file_free(f->bf);
 }
 
+/*----------------------------------------------------------------------------
+ * Parse a field precision option.
+ *
+ * Options are of the form "precision_bits=<n>" for the default precision
+ * of all fields, or "precision_bits:<field_name>=<n>" for a given field,
+ * where n is the number of mantissa bits kept (1 to 23).
+ *
+ * parameters:
+ *   this_writer <-> pointer to Ensight Gold writer structure.
+ *   option      <-- option string (not null-terminated)
+ *   l_opt       <-- option length
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_precision_option(fvm_to_ensight_writer_t  *this_writer,
+                        const char               *option,
+                        int                       l_opt)
+{
+  const int l_key = strlen("precision_bits");
+  int i_eq = l_opt - 1;
+
+  while (i_eq > l_key && option[i_eq] != '=')
+    i_eq--;
+
+  int n_bits = (i_eq < l_opt - 1) ? atoi(option + i_eq + 1) : 0;
+
+  if (option[i_eq] != '=' || n_bits < 1 || n_bits > 23) {
+    char buf[81];
+    int l = CS_MIN(l_opt, 80);
+    strncpy(buf, option, l);
+    buf[l] = '\0';
+    bft_error(__FILE__, __LINE__, 0,
+              _("EnSight writer option \"%s\" is invalid:\n"
+                "the number of mantissa bits must be in the [1, 23] range."),
+              buf);
+  }
+
+  if (i_eq == l_key)
+    this_writer->precision_bits = n_bits;
+
+  else if (option[l_key] == ':' && i_eq > l_key + 1) {
+    int i = this_writer->n_field_precisions;
+    int l_name = i_eq - l_key - 1;
+    BFT_REALLOC(this_writer->field_names, i+1, char *);
+    BFT_REALLOC(this_writer->field_bits, i+1, int);
+    BFT_MALLOC(this_writer->field_names[i], l_name + 1, char);
+    strncpy(this_writer->field_names[i], option + l_key + 1, l_name);
+    this_writer->field_names[i][l_name] = '\0';
+    this_writer->field_bits[i] = n_bits;
+    this_writer->n_field_precisions += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of mantissa bits kept for a given field's values.
+ *
+ * Field names are compared in a case-independent manner, as writer
+ * options are converted to lowercase.
+ *
+ * parameters:
+ *   this_writer <-- pointer to Ensight Gold writer structure.
+ *   name        <-- field name
+ *
+ * returns:
+ *   number of mantissa bits kept (23 for full precision)
+ *----------------------------------------------------------------------------*/
+
+static int
+_field_precision_bits(const fvm_to_ensight_writer_t  *this_writer,
+                      const char                     *name)
+{
+  for (int i = 0; i < this_writer->n_field_precisions; i++) {
+    const char *s = this_writer->field_names[i];
+    size_t j = 0;
+    while (s[j] != '\0' && s[j] == tolower((unsigned char)name[j]))
+      j++;
+    if (s[j] == '\0' && name[j] == '\0')
+      return this_writer->field_bits[i];
+  }
+
+  return this_writer->precision_bits;
+}
+
+/*----------------------------------------------------------------------------
+ * Round single-precision values to a given number of mantissa bits.
+ *
+ * Values are rounded to nearest (ties to even), and the low mantissa bits
+ * are zeroed, so the output has a much lower entropy, and compresses well
+ * with general-purpose tools. The relative error is at most 2^-(n_bits+1).
+ *
+ * parameters:
+ *   n_values <-- number of values
+ *   n_bits   <-- number of mantissa bits kept
+ *   values   <-> values to round
+ *----------------------------------------------------------------------------*/
+
+static void
+_round_float_values(size_t   n_values,
+                    int      n_bits,
+                    float    values[])
+{
+  if (n_bits >= 23)
+    return;
+
+  const uint32_t n_drop = 23 - n_bits;
+  const uint32_t mask = ~((UINT32_C(1) << n_drop) - 1);
+  const uint32_t half = (UINT32_C(1) << (n_drop - 1)) - 1;
+  const uint32_t exp_mask = UINT32_C(0x7f800000);
+
+  for (size_t i = 0; i < n_values; i++) {
+    uint32_t u;
+    memcpy(&u, values + i, sizeof(uint32_t));
+    if ((u & exp_mask) == exp_mask)    /* Inf or NaN */
+      continue;
+    uint32_t r = (u + half + ((u >> n_drop) & 1)) & mask;
+    if ((r & exp_mask) != exp_mask)    /* Keep largest values finite */
+      memcpy(values + i, &r, sizeof(uint32_t));
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Write string to a text or C binary EnSight Gold file
  *
@@ -921,6 +1161,10 @@ _field_output_g(void           *context,
 
   assert(datatype == CS_FLOAT);
 
+  _round_float_values(block_end - block_start,
+                      c->precision_bits,
+                      buffer);
+
   _write_block_floats_g(block_start,
                         block_end,
                         buffer,
@@ -2353,6 +2597,7 @@ _export_nodal_strided_g(const fvm_to_ensight_writer_t  *w,
  *                          size: n_parent_lists
  *   datatype           <-- input data type (output is real)
  *   field_values       <-- array of associated field value arrays
+ *   precision_bits     <-- number of mantissa bits kept for output values
  *   f                  <-- associated file handle
  *----------------------------------------------------------------------------*/
 
@@ -2365,6 +2610,7 @@ _export_field_values_nl(const fvm_nodal_t           *mesh,
                         const cs_lnum_t              parent_num_shift[],
                         cs_datatype_t                datatype,
                         const void            *const field_values[],
+                        int                          precision_bits,
                         _ensight_file_t              f)
 {
   int  i;
@@ -2395,6 +2641,8 @@ _export_field_values_nl(const fvm_nodal_t           *mesh,
                                            output_buffer_size,
                                            &output_size) == 0) {
 
+      _round_float_values(output_size, precision_bits, output_buffer);
+
       _write_block_floats_l(output_size,
                             output_buffer,
                             f);
@@ -2425,6 +2673,7 @@ _export_field_values_nl(const fvm_nodal_t           *mesh,
  *                        size: n_parent_lists
  *   datatype         <-- indicates the data type of (source) field values
  *   field_values     <-- array of associated field value arrays
+ *   precision_bits   <-- number of mantissa bits kept for output values
  *   f                <-- associated file handle
  *
  * returns:
@@ -2440,6 +2689,7 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
                         const cs_lnum_t                  parent_num_shift[],
                         cs_datatype_t                    datatype,
                         const void                *const field_values[],
+                        int                              precision_bits,
                         _ensight_file_t                  f)
 {
   int  i;
@@ -2492,6 +2742,8 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
                                              output_buffer_size,
                                              &output_size) == 0) {
 
+        _round_float_values(output_size, precision_bits, output_buffer);
+
         _write_block_floats_l(output_size,
                               output_buffer,
                               f);
@@ -2573,6 +2825,16 @@ fvm_to_ensight_init_writer(const char             *name,
   this_writer->divide_polygons = false;
   this_writer->divide_polyhedra = false;
 
+  this_writer->precision_bits = 23;
+  this_writer->n_field_precisions = 0;
+  this_writer->field_names = NULL;
+  this_writer->field_bits = NULL;
+
+  this_writer->async_write = false;
+  this_writer->async_gen = 0;
+  this_writer->n_pending = 0;
+  this_writer->pending = NULL;
+
   this_writer->rank = 0;
   this_writer->n_ranks = 1;
 
@@ -2644,6 +2906,13 @@ fvm_to_ensight_init_writer(const char             *name,
                && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
         this_writer->divide_polyhedra = true;
 
+      else if ((l_opt == 5) && (strncmp(options + i1, "async", l_opt) == 0))
+        this_writer->async_write = true;
+
+      else if (   (l_opt > 14)
+               && (strncmp(options + i1, "precision_bits", 14) == 0))
+        _parse_precision_option(this_writer, options + i1, l_opt);
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
@@ -2675,6 +2944,13 @@ fvm_to_ensight_finalize_writer(void  *this_writer_p)
   fvm_to_ensight_writer_t  *this_writer
                              = (fvm_to_ensight_writer_t *)this_writer_p;
 
+  _close_pending_files(this_writer, true);
+
+  for (int i = 0; i < this_writer->n_field_precisions; i++)
+    BFT_FREE(this_writer->field_names[i]);
+  BFT_FREE(this_writer->field_names);
+  BFT_FREE(this_writer->field_bits);
+
   BFT_FREE(this_writer->name);
 
   fvm_to_ensight_case_destroy(this_writer->case_info);
@@ -2776,7 +3052,7 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
   fvm_writer_section_t        *export_list = NULL;
   fvm_to_ensight_writer_t     *this_writer
                                   = (fvm_to_ensight_writer_t *)this_writer_p;
-  _ensight_file_t  f = {NULL, NULL};
+  _ensight_file_t  f = {NULL, NULL, false};
 
   const int  rank = this_writer->rank;
   const int  n_ranks = this_writer->n_ranks;
@@ -2993,7 +3269,7 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
   /* Close geometry file and update case file */
   /*------------------------------------------*/
 
-  _free_ensight_file(&f);
+  _free_ensight_file(this_writer, &f);
 
   fvm_to_ensight_case_write_case(this_writer->case_info, rank);
 }
@@ -3044,7 +3320,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
   fvm_writer_field_helper_t  *helper = NULL;
   fvm_writer_section_t  *export_list = NULL;
   fvm_to_ensight_writer_t  *w = (fvm_to_ensight_writer_t *)this_writer_p;
-  _ensight_file_t  f = {NULL, NULL};
+  _ensight_file_t  f = {NULL, NULL, false};
 
   const int  rank = w->rank;
   const int  n_ranks = w->n_ranks;
@@ -3063,6 +3339,8 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
   const int *comp_order = (dimension == 6) ? _ensight_c_order_6 : NULL;
 
+  const int precision_bits = _field_precision_bits(w, name);
+
   /* Get part number */
 
   part_num = fvm_to_ensight_case_get_part_num(w->case_info,
@@ -3154,6 +3432,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
         _ensight_context_t c;
         c.writer = w;
         c.file = &f;
+        c.precision_bits = precision_bits;
 
         fvm_writer_field_helper_output_n(helper,
                                          &c,
@@ -3180,6 +3459,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
                               parent_num_shift,
                               datatype,
                               field_values,
+                              precision_bits,
                               f);
   }
 
@@ -3206,6 +3486,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
         _ensight_context_t c;
         c.writer = w;
         c.file = &f;
+        c.precision_bits = precision_bits;
 
         export_section = fvm_writer_field_helper_output_e(helper,
                                                           &c,
@@ -3232,6 +3513,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
                                                  parent_num_shift,
                                                  datatype,
                                                  field_values,
+                                                 precision_bits,
                                                  f);
 
     } /* End of loop on sections */
@@ -3248,11 +3530,35 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
   /* Close variable file and update case file */
   /*------------------------------------------*/
 
-  _free_ensight_file(&f);
+  _free_ensight_file(w, &f);
 
   fvm_to_ensight_case_write_case(w->case_info, rank);
 }
 
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * With asynchronous writes, files written during the previous output
+ * generation are completed and closed, while those written since the
+ * previous flush remain pending, so that their writing may overlap
+ * with computation until the next flush.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_ensight_flush(void  *this_writer_p)
+{
+  fvm_to_ensight_writer_t  *this_writer
+                             = (fvm_to_ensight_writer_t *)this_writer_p;
+
+  if (this_writer->n_pending > 0)
+    _close_pending_files(this_writer, false);
+
+  this_writer->async_gen += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -192,6 +192,21 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
                             double                 time_value,
                             const void      *const field_values[]);
 
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * With asynchronous writes, files written during the previous output
+ * generation are completed and closed, while those written since the
+ * previous flush remain pending, so that their writing may overlap
+ * with computation until the next flush.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_ensight_flush(void  *this_writer_p);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
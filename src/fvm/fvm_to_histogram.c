@@ -35,6 +35,7 @@
 #include <ctype.h>
 #include <errno.h>
 #include <float.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -60,6 +61,7 @@
 
 #include "cs_block_dist.h"
 #include "cs_file.h"
+#include "cs_interface.h"
 #include "cs_parall.h"
 #include "cs_part_to_block.h"
 
@@ -509,6 +511,692 @@ _field_output(void           *context,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return the value of a scalar field, or the magnitude of a
+ * multidimensional field.
+ *
+ * parameters:
+ *   dim <-- field dimension
+ *   val <-- field values (size: dim)
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_field_magnitude(int              dim,
+                 const cs_real_t  val[])
+{
+  if (dim == 1)
+    return val[0];
+
+  cs_real_t s = 0.;
+  for (int k = 0; k < dim; k++)
+    s += val[k]*val[k];
+
+  return sqrt(s);
+}
+
+/*----------------------------------------------------------------------------
+ * Average element field magnitudes to vertices.
+ *
+ * Contributions of elements on other ranks are added for vertices on
+ * parallel boundaries, so the result does not depend on partitioning.
+ *
+ * parameters:
+ *   mesh        <-- pointer to associated nodal mesh structure
+ *   export_list <-- list of exported sections
+ *   dim         <-- field dimension
+ *   elt_vals    <-- element field values (interlaced, export list order)
+ *   vtx_f       --> vertex values
+ *----------------------------------------------------------------------------*/
+
+static void
+_element_to_vertex_magnitude(const fvm_nodal_t           *mesh,
+                             const fvm_writer_section_t  *export_list,
+                             int                          dim,
+                             const cs_real_t              elt_vals[],
+                             cs_real_t                    vtx_f[])
+{
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
+  /* Sum of values and count, interlaced */
+
+  cs_real_t *vtx_sum = NULL;
+  BFT_MALLOC(vtx_sum, n_vertices*2, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_vertices*2; i++)
+    vtx_sum[i] = 0.;
+
+  cs_lnum_t elt_id = 0;
+
+  for (const fvm_writer_section_t *ws = export_list;
+       ws != NULL;
+       ws = ws->next) {
+
+    const fvm_nodal_section_t  *section = ws->section;
+
+    for (cs_lnum_t i = 0; i < section->n_elements; i++, elt_id++) {
+
+      const cs_real_t f = _field_magnitude(dim, elt_vals + elt_id*dim);
+
+      cs_lnum_t s_id = i*section->stride, e_id = (i+1)*section->stride;
+
+      if (section->type == FVM_CELL_POLY) {
+        for (cs_lnum_t j = section->face_index[i];
+             j < section->face_index[i+1];
+             j++) {
+          cs_lnum_t f_id = CS_ABS(section->face_num[j]) - 1;
+          for (cs_lnum_t k = section->vertex_index[f_id];
+               k < section->vertex_index[f_id+1];
+               k++) {
+            cs_lnum_t v_id = section->vertex_num[k] - 1;
+            vtx_sum[v_id*2] += f;
+            vtx_sum[v_id*2 + 1] += 1.;
+          }
+        }
+        continue;
+      }
+      else if (section->type == FVM_FACE_POLY) {
+        s_id = section->vertex_index[i];
+        e_id = section->vertex_index[i+1];
+      }
+
+      for (cs_lnum_t k = s_id; k < e_id; k++) {
+        cs_lnum_t v_id = section->vertex_num[k] - 1;
+        vtx_sum[v_id*2] += f;
+        vtx_sum[v_id*2 + 1] += 1.;
+      }
+
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    /* Ranks with no vertices may not have a global numbering */
+
+    const cs_gnum_t *g_vtx_num = NULL;
+    cs_lnum_t n_g_vertices = 0;
+    if (mesh->global_vertex_num != NULL) {
+      g_vtx_num = fvm_io_num_get_global_num(mesh->global_vertex_num);
+      n_g_vertices = n_vertices;
+    }
+
+    cs_interface_set_t *ifs
+      = cs_interface_set_create(n_g_vertices,
+                                NULL,
+                                g_vtx_num,
+                                NULL,
+                                0,
+                                NULL,
+                                NULL,
+                                NULL);
+
+    cs_interface_set_sum(ifs,
+                         n_g_vertices,
+                         2,
+                         true,
+                         CS_REAL_TYPE,
+                         vtx_sum);
+
+    cs_interface_set_destroy(&ifs);
+
+  }
+
+#endif
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    if (vtx_sum[i*2 + 1] > 0.)
+      vtx_f[i] = vtx_sum[i*2] / vtx_sum[i*2 + 1];
+    else
+      vtx_f[i] = 0.;
+  }
+
+  BFT_FREE(vtx_sum);
+}
+
+/*----------------------------------------------------------------------------
+ * Return local edge definitions for a strided element type.
+ *
+ * Edges of polygonal faces (and of polyhedra faces) are handled separately,
+ * as consecutive vertex pairs.
+ *
+ * parameters:
+ *   type    <-- element type
+ *   n_edges --> number of edges (0 if type is not handled here)
+ *
+ * returns:
+ *   pointer to pairs of element-local vertex ids, or NULL
+ *----------------------------------------------------------------------------*/
+
+static const int *
+_strided_edges(fvm_element_t   type,
+               int            *n_edges)
+{
+  static const int edge_e[] = {0, 1};
+  static const int tetra_e[] = {0, 1,  1, 2,  2, 0,  0, 3,  1, 3,  2, 3};
+  static const int pyram_e[] = {0, 1,  1, 2,  2, 3,  3, 0,
+                                0, 4,  1, 4,  2, 4,  3, 4};
+  static const int prism_e[] = {0, 1,  1, 2,  2, 0,  3, 4,  4, 5,  5, 3,
+                                0, 3,  1, 4,  2, 5};
+  static const int hexa_e[] = {0, 1,  1, 2,  2, 3,  3, 0,
+                               4, 5,  5, 6,  6, 7,  7, 4,
+                               0, 4,  1, 5,  2, 6,  3, 7};
+
+  const int *e_def = NULL;
+
+  switch(type) {
+  case FVM_EDGE:
+    e_def = edge_e;
+    *n_edges = 1;
+    break;
+  case FVM_CELL_TETRA:
+    e_def = tetra_e;
+    *n_edges = 6;
+    break;
+  case FVM_CELL_PYRAM:
+    e_def = pyram_e;
+    *n_edges = 8;
+    break;
+  case FVM_CELL_PRISM:
+    e_def = prism_e;
+    *n_edges = 9;
+    break;
+  case FVM_CELL_HEXA:
+    e_def = hexa_e;
+    *n_edges = 12;
+    break;
+  default:
+    *n_edges = 0;
+  }
+
+  return e_def;
+}
+
+/*----------------------------------------------------------------------------
+ * Accumulate the intersection of an edge with the zero level of a
+ * vertex-based scalar.
+ *
+ * parameters:
+ *   v0         <-- first edge vertex id
+ *   v1         <-- second edge vertex id
+ *   vtx_s      <-- vertex scalar values (zero level is extracted)
+ *   vtx_coords <-- vertex coordinates (interlaced, size: 3 per vertex)
+ *   dim        <-- field dimension
+ *   vtx_vals   <-- vertex field values (interlaced), or NULL
+ *   acc        <-> sum of intersection coordinates and values
+ *
+ * returns:
+ *   1 if the edge crosses the zero level, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_edge_crossing(cs_lnum_t        v0,
+               cs_lnum_t        v1,
+               const cs_real_t  vtx_s[],
+               const cs_real_t  vtx_coords[],
+               int              dim,
+               const cs_real_t  vtx_vals[],
+               cs_real_t        acc[])
+{
+  const cs_real_t s0 = vtx_s[v0], s1 = vtx_s[v1];
+
+  if ((s0 < 0.) == (s1 < 0.))
+    return 0;
+
+  const cs_real_t t = s0 / (s0 - s1);
+
+  for (int k = 0; k < 3; k++)
+    acc[k] += (1.-t)*vtx_coords[v0*3 + k] + t*vtx_coords[v1*3 + k];
+
+  if (vtx_vals != NULL) {
+    for (int k = 0; k < dim; k++)
+      acc[3+k] += (1.-t)*vtx_vals[v0*dim + k] + t*vtx_vals[v1*dim + k];
+  }
+
+  return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Extract one sample per element crossed by the zero level of a
+ * vertex-based scalar (planar slice or iso-surface).
+ *
+ * Each sample is located at the mean of the element edge intersection
+ * points, with field values either interpolated along those edges
+ * (vertex-based fields) or equal to the element value (element-based
+ * fields).
+ *
+ * parameters:
+ *   export_list <-- list of exported sections
+ *   vtx_s       <-- vertex scalar values (zero level is extracted)
+ *   vtx_coords  <-- vertex coordinates (interlaced, size: 3 per vertex)
+ *   dim         <-- field dimension
+ *   vtx_vals    <-- vertex field values (interlaced), or NULL
+ *   elt_vals    <-- element field values (interlaced, export list order),
+ *                   or NULL
+ *   n_samples   --> number of extracted samples
+ *
+ * returns:
+ *   newly allocated samples array (coordinates and values interlaced,
+ *   size: n_samples * (3 + dim))
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_extract_samples(const fvm_writer_section_t  *export_list,
+                 const cs_real_t              vtx_s[],
+                 const cs_real_t              vtx_coords[],
+                 int                          dim,
+                 const cs_real_t              vtx_vals[],
+                 const cs_real_t              elt_vals[],
+                 cs_lnum_t                   *n_samples)
+{
+  const int stride = 3 + dim;
+
+  cs_lnum_t n = 0, n_max = 0, elt_id = 0;
+  cs_real_t acc[12];
+  cs_real_t *samples = NULL;
+
+  for (const fvm_writer_section_t *ws = export_list;
+       ws != NULL;
+       ws = ws->next) {
+
+    const fvm_nodal_section_t  *section = ws->section;
+    const cs_lnum_t *vertex_num = section->vertex_num;
+
+    int n_e_def = 0;
+    const int *e_def = _strided_edges(section->type, &n_e_def);
+
+    for (cs_lnum_t i = 0; i < section->n_elements; i++, elt_id++) {
+
+      int n_cross = 0;
+
+      for (int k = 0; k < stride; k++)
+        acc[k] = 0.;
+
+      if (section->type == FVM_CELL_POLY) {
+        for (cs_lnum_t j = section->face_index[i];
+             j < section->face_index[i+1];
+             j++) {
+          cs_lnum_t f_id = CS_ABS(section->face_num[j]) - 1;
+          cs_lnum_t s_id = section->vertex_index[f_id];
+          cs_lnum_t n_f_vtx = section->vertex_index[f_id+1] - s_id;
+          for (cs_lnum_t k = 0; k < n_f_vtx; k++)
+            n_cross += _edge_crossing(vertex_num[s_id + k] - 1,
+                                      vertex_num[s_id + (k+1)%n_f_vtx] - 1,
+                                      vtx_s, vtx_coords, dim, vtx_vals, acc);
+        }
+      }
+      else if (section->type == FVM_FACE_POLY) {
+        cs_lnum_t s_id = section->vertex_index[i];
+        cs_lnum_t n_f_vtx = section->vertex_index[i+1] - s_id;
+        for (cs_lnum_t k = 0; k < n_f_vtx; k++)
+          n_cross += _edge_crossing(vertex_num[s_id + k] - 1,
+                                    vertex_num[s_id + (k+1)%n_f_vtx] - 1,
+                                    vtx_s, vtx_coords, dim, vtx_vals, acc);
+      }
+      else if (e_def != NULL) {
+        const cs_lnum_t *e_vtx = vertex_num + i*section->stride;
+        for (int k = 0; k < n_e_def; k++)
+          n_cross += _edge_crossing(e_vtx[e_def[k*2]] - 1,
+                                    e_vtx[e_def[k*2 + 1]] - 1,
+                                    vtx_s, vtx_coords, dim, vtx_vals, acc);
+      }
+      else { /* triangles and quadrangles */
+        const cs_lnum_t *e_vtx = vertex_num + i*section->stride;
+        for (int k = 0; k < section->stride; k++)
+          n_cross += _edge_crossing(e_vtx[k] - 1,
+                                    e_vtx[(k+1)%section->stride] - 1,
+                                    vtx_s, vtx_coords, dim, vtx_vals, acc);
+      }
+
+      if (n_cross == 0)
+        continue;
+
+      if (n >= n_max) {
+        n_max = CS_MAX(n_max*2, 16);
+        BFT_REALLOC(samples, n_max*stride, cs_real_t);
+      }
+
+      cs_real_t *s = samples + n*stride;
+      for (int k = 0; k < stride; k++)
+        s[k] = acc[k] / n_cross;
+      if (elt_vals != NULL) {
+        for (int k = 0; k < dim; k++)
+          s[3+k] = elt_vals[elt_id*dim + k];
+      }
+
+      n++;
+    }
+
+  }
+
+  *n_samples = n;
+
+  return samples;
+}
+
+/*----------------------------------------------------------------------------
+ * Gather extracted samples on rank 0 and write them to a CSV file.
+ *
+ * parameters:
+ *   w           <-- histogram writer
+ *   file_name   <-- name of CSV file
+ *   var_name    <-- name of the variable
+ *   extract_def <-- description of extract (for file header)
+ *   dim         <-- field dimension
+ *   n_samples   <-- local number of samples
+ *   samples     <-- local samples (coordinates and values interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_samples(fvm_to_histogram_writer_t  *w,
+               const char                 *file_name,
+               const char                 *var_name,
+               const char                 *extract_def,
+               int                         dim,
+               cs_lnum_t                   n_samples,
+               const cs_real_t             samples[])
+{
+  const int stride = 3 + dim;
+
+  cs_gnum_t n_g_samples = n_samples;
+  cs_real_t *_g_samples = NULL;
+  const cs_real_t *g_samples = samples;
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
+
+    int l_count = n_samples*stride;
+    int *counts = NULL, *displs = NULL;
+
+    if (w->rank == 0) {
+      BFT_MALLOC(counts, w->n_ranks, int);
+      BFT_MALLOC(displs, w->n_ranks, int);
+    }
+
+    MPI_Gather(&l_count, 1, MPI_INT, counts, 1, MPI_INT, 0, w->comm);
+
+    if (w->rank == 0) {
+      displs[0] = 0;
+      for (int i = 1; i < w->n_ranks; i++)
+        displs[i] = displs[i-1] + counts[i-1];
+      n_g_samples = (displs[w->n_ranks-1] + counts[w->n_ranks-1]) / stride;
+      BFT_MALLOC(_g_samples, n_g_samples*stride, cs_real_t);
+    }
+
+    MPI_Gatherv(samples, l_count, CS_MPI_REAL,
+                _g_samples, counts, displs, CS_MPI_REAL,
+                0, w->comm);
+
+    BFT_FREE(counts);
+    BFT_FREE(displs);
+
+    g_samples = _g_samples;
+  }
+
+#endif
+
+  if (w->rank == 0) {
+
+    FILE *f = fopen(file_name, "w");
+
+    if (f == NULL) {
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file: \"%s\""), file_name);
+      return;
+    }
+
+    fprintf(f, "# Code_Saturne in-situ extract\n#\n");
+    if (w->nt < 0)
+      fprintf(f, "# time independent\n");
+    else {
+      fprintf(f, "# time step id: %i\n", w->nt);
+      fprintf(f, "# time:         %12.5e\n", w->t);
+    }
+    fprintf(f, "# %s\n", extract_def);
+    fprintf(f, "# number of points: %llu\n#\n",
+            (unsigned long long)n_g_samples);
+
+    fprintf(f, "x, y, z");
+    for (int k = 0; k < dim; k++) {
+      char tmpe[6];
+      fvm_writer_field_component_name(tmpe, 6, false, dim, k);
+      if (strlen(tmpe) > 0)
+        fprintf(f, ", %s[%s]", var_name, tmpe);
+      else
+        fprintf(f, ", %s", var_name);
+    }
+    fprintf(f, "\n");
+
+    for (cs_gnum_t i = 0; i < n_g_samples; i++) {
+      const cs_real_t *s = g_samples + i*stride;
+      fprintf(f, "%14.7e", s[0]);
+      for (int k = 1; k < stride; k++)
+        fprintf(f, ", %14.7e", s[k]);
+      fprintf(f, "\n");
+    }
+
+    if (fclose(f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), file_name);
+
+  }
+
+  BFT_FREE(_g_samples);
+}
+
+/*----------------------------------------------------------------------------
+ * Extract and write planar slices and iso-surfaces of a field.
+ *
+ * Iso-surfaces of multidimensional fields are based on the field
+ * magnitude. For element-based fields, the iso-surface is based on
+ * vertex values averaged from adjacent elements.
+ *
+ * parameters:
+ *   w                <-- histogram writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   export_list      <-- list of exported sections
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- number of parent lists
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_export_extracts(fvm_to_histogram_writer_t   *w,
+                 const fvm_nodal_t           *mesh,
+                 const fvm_writer_section_t  *export_list,
+                 const char                  *name,
+                 fvm_writer_var_loc_t         location,
+                 int                          dimension,
+                 cs_interlace_t               interlace,
+                 int                          n_parent_lists,
+                 const cs_lnum_t              parent_num_shift[],
+                 cs_datatype_t                datatype,
+                 const void            *const field_values[])
+{
+  if (w->n_slices + w->n_isos == 0)
+    return;
+
+  if (   (datatype != CS_FLOAT && datatype != CS_DOUBLE)
+      || dimension < 1 || dimension > 9)
+    return;
+
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
+  cs_lnum_t n_elts = 0;
+  for (const fvm_writer_section_t *ws = export_list;
+       ws != NULL;
+       ws = ws->next)
+    n_elts += ws->section->n_elements;
+
+  /* Local vertex coordinates */
+
+  cs_real_t *vtx_coords = NULL;
+  BFT_MALLOC(vtx_coords, n_vertices*3, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_vertices*3; i++)
+    vtx_coords[i] = 0.;
+
+  {
+    int n_coo_parent_lists = (mesh->parent_vertex_num != NULL) ? 1 : 0;
+    cs_lnum_t coo_num_shift[1] = {0};
+    const void *coo_ptr[1] = {mesh->vertex_coords};
+
+    fvm_convert_array(mesh->dim,
+                      0,
+                      3,
+                      0,
+                      n_vertices,
+                      CS_INTERLACE,
+                      CS_COORD_TYPE,
+                      CS_REAL_TYPE,
+                      n_coo_parent_lists,
+                      coo_num_shift,
+                      mesh->parent_vertex_num,
+                      coo_ptr,
+                      vtx_coords);
+  }
+
+  /* Local field values, and matching vertex-based scalar */
+
+  cs_real_t *vtx_vals = NULL, *elt_vals = NULL, *vtx_f = NULL;
+  BFT_MALLOC(vtx_f, n_vertices, cs_real_t);
+
+  if (location == FVM_WRITER_PER_NODE) {
+
+    BFT_MALLOC(vtx_vals, n_vertices*dimension, cs_real_t);
+
+    fvm_convert_array(dimension,
+                      0,
+                      dimension,
+                      0,
+                      n_vertices,
+                      interlace,
+                      datatype,
+                      CS_REAL_TYPE,
+                      n_parent_lists,
+                      parent_num_shift,
+                      mesh->parent_vertex_num,
+                      field_values,
+                      vtx_vals);
+
+    for (cs_lnum_t i = 0; i < n_vertices; i++)
+      vtx_f[i] = _field_magnitude(dimension, vtx_vals + i*dimension);
+
+  }
+  else {
+
+    BFT_MALLOC(elt_vals, n_elts*dimension, cs_real_t);
+
+    cs_lnum_t start_id = 0;
+
+    for (const fvm_writer_section_t *ws = export_list;
+         ws != NULL;
+         ws = ws->next) {
+
+      const fvm_nodal_section_t  *section = ws->section;
+      cs_lnum_t src_shift = (n_parent_lists == 0) ? ws->num_shift : 0;
+
+      fvm_convert_array(dimension,
+                        0,
+                        dimension,
+                        src_shift,
+                        section->n_elements + src_shift,
+                        interlace,
+                        datatype,
+                        CS_REAL_TYPE,
+                        n_parent_lists,
+                        parent_num_shift,
+                        section->parent_element_num,
+                        field_values,
+                        elt_vals + start_id*dimension);
+
+      start_id += section->n_elements;
+
+    }
+
+    if (w->n_isos > 0)
+      _element_to_vertex_magnitude(mesh,
+                                   export_list,
+                                   dimension,
+                                   elt_vals,
+                                   vtx_f);
+
+  }
+
+  /* Now extract and write slices and iso-surfaces */
+
+  cs_real_t *vtx_s = NULL;
+  BFT_MALLOC(vtx_s, n_vertices, cs_real_t);
+
+  /* Use a local file name, as the writer's file name may refer to
+     a histogram file which is still open */
+
+  char extract_def[128];
+  char *file_name = NULL;
+  size_t l =   strlen(w->path) + strlen(w->name) + strlen(name)
+             + 32 + 1;
+  BFT_MALLOC(file_name, l, char);
+
+  for (int e_id = 0; e_id < w->n_slices + w->n_isos; e_id++) {
+
+    if (e_id < w->n_slices) {
+      const char axis_name[] = {'x', 'y', 'z'};
+      const int axis = w->slice_axis[e_id];
+      for (cs_lnum_t i = 0; i < n_vertices; i++)
+        vtx_s[i] = vtx_coords[i*3 + axis] - w->slice_value[e_id];
+      snprintf(extract_def, 127, "slice: %c = %12.5e",
+               axis_name[axis], w->slice_value[e_id]);
+      sprintf(file_name, "%s%s_%s_slice%02d_%.4i.csv",
+              w->path, w->name, name, e_id + 1, w->nt);
+    }
+    else {
+      const int iso_id = e_id - w->n_slices;
+      for (cs_lnum_t i = 0; i < n_vertices; i++)
+        vtx_s[i] = vtx_f[i] - w->iso_value[iso_id];
+      snprintf(extract_def, 127, "iso-surface: %s%s = %12.5e",
+               name, (dimension > 1) ? " (magnitude)" : "",
+               w->iso_value[iso_id]);
+      sprintf(file_name, "%s%s_%s_iso%02d_%.4i.csv",
+              w->path, w->name, name, iso_id + 1, w->nt);
+    }
+
+    cs_lnum_t n_samples = 0;
+    cs_real_t *samples = _extract_samples(export_list,
+                                          vtx_s,
+                                          vtx_coords,
+                                          dimension,
+                                          vtx_vals,
+                                          elt_vals,
+                                          &n_samples);
+
+    _write_samples(w,
+                   file_name,
+                   name,
+                   extract_def,
+                   dimension,
+                   n_samples,
+                   samples);
+
+    BFT_FREE(samples);
+
+  }
+
+  BFT_FREE(file_name);
+  BFT_FREE(vtx_s);
+  BFT_FREE(vtx_f);
+  BFT_FREE(elt_vals);
+  BFT_FREE(vtx_vals);
+  BFT_FREE(vtx_coords);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -523,6 +1211,10 @@ _field_output(void           *context,
  *   tex                 output TeX (TixZ) files
  *   png                 output PNG files
  *   [n_sub]             number of subdivisions
+ *   slice_x=<x>         extract samples on plane x = <x>
+ *   slice_y=<y>         extract samples on plane y = <y>
+ *   slice_z=<z>         extract samples on plane z = <z>
+ *   iso=<v>             extract samples on iso-surface value = <v>
  *
  * parameters:
  *   name           <-- base output case name.
@@ -594,6 +1286,13 @@ fvm_to_histogram_init_writer(const char             *name,
 
   w->n_sub = 5; /* default */
 
+  w->n_slices = 0;
+  w->slice_axis = NULL;
+  w->slice_value = NULL;
+
+  w->n_isos = 0;
+  w->iso_value = NULL;
+
   /* Parse options */
 
   if (options != NULL) {
@@ -608,7 +1307,21 @@ fvm_to_histogram_init_writer(const char             *name,
       for (i2 = i1; i2 < l_tot && options[i2] != ' '; i2++);
       l_opt = i2 - i1;
 
-      if ((l_opt == 3) && (strncmp(options + i1, "txt", l_opt) == 0))
+      if ((l_opt > 8) && (strncmp(options + i1, "slice_", 6) == 0)
+          && options[i1 + 6] >= 'x' && options[i1 + 6] <= 'z'
+          && options[i1 + 7] == '=') {
+        BFT_REALLOC(w->slice_axis, w->n_slices + 1, int);
+        BFT_REALLOC(w->slice_value, w->n_slices + 1, double);
+        w->slice_axis[w->n_slices] = options[i1 + 6] - 'x';
+        w->slice_value[w->n_slices] = strtod(options + i1 + 8, NULL);
+        w->n_slices += 1;
+      }
+      else if ((l_opt > 4) && (strncmp(options + i1, "iso=", 4) == 0)) {
+        BFT_REALLOC(w->iso_value, w->n_isos + 1, double);
+        w->iso_value[w->n_isos] = strtod(options + i1 + 4, NULL);
+        w->n_isos += 1;
+      }
+      else if ((l_opt == 3) && (strncmp(options + i1, "txt", l_opt) == 0))
         w->format = CS_HISTOGRAM_TXT;
       else if ((l_opt == 3) && (strncmp(options + i1, "tex", l_opt) == 0)) {
         w->format = CS_HISTOGRAM_TEX;
@@ -671,6 +1384,10 @@ fvm_to_histogram_finalize_writer(void  *writer)
 
   BFT_FREE(w->file_name);
 
+  BFT_FREE(w->slice_axis);
+  BFT_FREE(w->slice_value);
+  BFT_FREE(w->iso_value);
+
 #if defined(HAVE_PLUGIN_CATALYST)
   if (w->format == CS_HISTOGRAM_PNG)
     cs_base_dlclose("fvm_catalyst",
@@ -707,6 +1424,10 @@ fvm_to_histogram_set_mesh_time(void    *writer,
 /*----------------------------------------------------------------------------
  * Write field associated with a nodal mesh to a histogram file.
  *
+ * If planar slices or iso-surfaces are defined for this writer, samples
+ * of the field on those surfaces (one per crossed element) are also
+ * written to CSV files.
+ *
  * Assigning a negative value to the time step indicates a time-independent
  * field (in which case the time_value argument is unused).
  *
@@ -805,6 +1526,20 @@ fvm_to_histogram_export_field(void                  *writer,
                                    field_values,
                                    _field_output);
 
+  /* Planar slices and iso-surfaces */
+
+  _export_extracts(w,
+                   mesh,
+                   export_list,
+                   name,
+                   location,
+                   dimension,
+                   interlace,
+                   n_parent_lists,
+                   parent_num_shift,
+                   datatype,
+                   field_values);
+
   BFT_FREE(export_list);
 
   /* Free helper structures */
@@ -82,6 +82,14 @@ typedef struct {
 
   int               n_sub;         /* Number of subdivisions */
 
+  int               n_slices;      /* Number of planar slices */
+  int              *slice_axis;    /* Slice plane normal axis
+                                      (0: x, 1: y, 2: z) */
+  double           *slice_value;   /* Slice plane coordinate */
+
+  int               n_isos;        /* Number of iso-surfaces */
+  double           *iso_value;     /* Iso-surface values */
+
 #if defined(HAVE_MPI)
   MPI_Comm     comm;               /* Associated MPI communicator */
 #endif
@@ -119,6 +127,10 @@ typedef void
  *   tex                 output TeX (TixZ) files
  *   png                 output PNG files
  *   [n_sub]             number of subdivisions
+ *   slice_x=<x>         extract samples on plane x = <x>
+ *   slice_y=<y>         extract samples on plane y = <y>
+ *   slice_z=<z>         extract samples on plane z = <z>
+ *   iso=<v>             extract samples on iso-surface value = <v>
  *
  * parameters:
  *   name           <-- base output case name.
@@ -179,6 +191,10 @@ fvm_to_histogram_set_mesh_time(void          *writer,
 /*----------------------------------------------------------------------------
  * Write field associated with a nodal mesh to a histogram file.
  *
+ * If planar slices or iso-surfaces are defined for this writer, samples
+ * of the field on those surfaces (one per crossed element) are also
+ * written to CSV files.
+ *
  * Assigning a negative value to the time step indicates a time-independent
  * field (in which case the time_value argument is unused).
  *
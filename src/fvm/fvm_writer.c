@@ -130,7 +130,7 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     fvm_to_ensight_needs_tesselation,  /* needs_tesselation_func */
     fvm_to_ensight_export_nodal,       /* export_nodal_func */
     fvm_to_ensight_export_field,       /* export_field_func */
-    NULL                               /* flush_func */
+    fvm_to_ensight_flush               /* flush_func */
   },
 
   /* MED writer */
@@ -1074,6 +1074,11 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   async               use deferred, non-blocking writes
+ *   precision_bits=<n>  keep only n mantissa bits of output field values
+ *                       (precision_bits:<field>=<n> for a given field)
+ *   slice_x=<x>         extract plane x = <x> (also slice_y, slice_z)
+ *   iso=<v>             extract iso-surface of value <v>
  *
  * parameters:
  *   name            <-- base name of output
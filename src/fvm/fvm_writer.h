@@ -219,6 +219,11 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   async               use deferred, non-blocking writes
+ *   precision_bits=<n>  keep only n mantissa bits of output field values
+ *                       (precision_bits:<field>=<n> for a given field)
+ *   slice_x=<x>         extract plane x = <x> (also slice_y, slice_z)
+ *   iso=<v>             extract iso-surface of value <v>
  *
  * parameters:
  *   name            <-- base name of output
@@ -472,7 +472,10 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
 
   block_size = bi.gnum_range[1] - bi.gnum_range[0];
 
-  d = cs_part_to_block_create_by_gnum(h->comm, bi, part_size, g_elt_num);
+  d = cs_part_to_block_create_by_gnum_persistent(h->comm,
+                                                 bi,
+                                                 part_size,
+                                                 g_elt_num);
 
   if (_g_elt_num != NULL)
     cs_part_to_block_transfer_gnum(d, _g_elt_num);
@@ -1436,6 +1439,10 @@ fvm_writer_count_extra_vertices(const fvm_nodal_t  *mesh,
 /*----------------------------------------------------------------------------
  * Build block info and part to block distribution helper for vertices.
  *
+ * The distributor is persistent (see
+ * cs_part_to_block_create_by_gnum_persistent), so it may be reused by
+ * successive outputs of a same mesh.
+ *
  * parameters:
  *   min_rank_step    <-- minimum step between output ranks
  *   min_block_size   <-- minimum block buffer size
@@ -1504,7 +1511,10 @@ fvm_writer_vertex_part_to_block_create(int                     min_rank_step,
 
   /* Build distribution structures */
 
-  _d = cs_part_to_block_create_by_gnum(comm, _bi, n_vertices_tot, g_num);
+  _d = cs_part_to_block_create_by_gnum_persistent(comm,
+                                                  _bi,
+                                                  n_vertices_tot,
+                                                  g_num);
 
   if (n_add_vertices > 0)
     cs_part_to_block_transfer_gnum(_d, _g_num);
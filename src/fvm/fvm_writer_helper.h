@@ -172,6 +172,10 @@ fvm_writer_count_extra_vertices(const fvm_nodal_t  *mesh,
 /*----------------------------------------------------------------------------
  * Build block info and part to block distribution helper for vertices.
  *
+ * The distributor is persistent (see
+ * cs_part_to_block_create_by_gnum_persistent), so it may be reused by
+ * successive outputs of a same mesh.
+ *
  * parameters:
  *   min_rank_step    <-- minimum step between output ranks
  *   min_block_size   <-- minimum block buffer size
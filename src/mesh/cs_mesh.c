@@ -2933,6 +2933,10 @@ cs_mesh_init_halo(cs_mesh_t          *mesh,
                         &gcell_vtx_idx,
                         &gcell_vtx_lst);
 
+    /* Exchange with ranks on the same node through shared memory */
+
+    cs_halo_init_shared_memory(mesh->halo);
+
     cs_interface_set_destroy(&face_interfaces);
 
     t2 = cs_timer_wtime();
@@ -53,6 +53,7 @@
 #include "cs_halo.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
+#include "cs_renumber.h"
 #include "cs_sort.h"
 
 /*----------------------------------------------------------------------------
@@ -463,6 +464,59 @@ _update_cell_vertices(cs_mesh_adjacencies_t  *ma,
   BFT_REALLOC(c2v->ids, c2v->idx[n_cells], cs_lnum_t);
 }
 
+/*----------------------------------------------------------------------------
+ * Update cells -> faces connectivity and associated face-parallel ranges
+ * used for cell-based gather of interior face values.
+ *
+ * These are only built if the cell-based gather interior faces renumbering
+ * algorithm is selected; the mesh's interior face numbering is then still
+ * used by face loops not supporting gather.
+ *
+ * parameters:
+ *   ma <-> mesh adjacecies structure to update
+ *   m  <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_cell_faces_gather(cs_mesh_adjacencies_t  *ma,
+                          const cs_mesh_t        *m)
+{
+  cs_adjacency_destroy(&(ma->c2f));
+  cs_numbering_destroy(&(ma->i_face_gather_numbering));
+
+  cs_renumber_i_faces_type_t i_faces_numbering;
+  cs_renumber_get_algorithm(NULL, NULL, NULL, NULL, NULL,
+                            &i_faces_numbering, NULL, NULL);
+
+  if (   m->i_face_numbering == NULL
+      || i_faces_numbering != CS_RENUMBER_I_FACES_GATHER)
+    return;
+
+  /* Interior faces first, so that face ids are not shifted */
+
+  ma->c2f = cs_mesh_adjacency_c2f(m, 1);
+
+  /* Face-parallel ranges: since face values are gathered by cells,
+     faces handled by different threads may share cells. */
+
+  const int n_threads = cs_glob_n_threads;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  cs_lnum_t *group_index;
+  BFT_MALLOC(group_index, n_threads*2, cs_lnum_t);
+
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+    group_index[t_id*2]     = (cs_gnum_t)n_i_faces*t_id / n_threads;
+    group_index[t_id*2 + 1] = (cs_gnum_t)n_i_faces*(t_id+1) / n_threads;
+  }
+
+  ma->i_face_gather_numbering
+    = cs_numbering_create_threaded(n_threads, 1, group_index);
+  ma->i_face_gather_numbering->type = CS_NUMBERING_GATHER;
+
+  BFT_FREE(group_index);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -492,6 +546,9 @@ cs_mesh_adjacencies_initialize(void)
   ma->c2v = NULL;
   ma->_c2v = NULL;
 
+  ma->c2f = NULL;
+  ma->i_face_gather_numbering = NULL;
+
   cs_glob_mesh_adjacencies = ma;
 }
 
@@ -514,6 +571,9 @@ cs_mesh_adjacencies_finalize(void)
 
   cs_adjacency_destroy(&(ma->_c2v));
 
+  cs_adjacency_destroy(&(ma->c2f));
+  cs_numbering_destroy(&(ma->i_face_gather_numbering));
+
   cs_glob_mesh_adjacencies = NULL;
 }
 
@@ -544,6 +604,10 @@ cs_mesh_adjacencies_update_mesh(void)
 
   if (ma->c2v != NULL)
     _update_cell_vertices(ma, cs_glob_mesh);
+
+  /* (re)build cell -> face connectivities for gather mode */
+
+  _update_cell_faces_gather(ma, cs_glob_mesh);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -587,6 +651,42 @@ cs_mesh_adjacencies_cell_vertices(void)
   return ma->c2v;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return cells -> faces adjacency for cell-based gather of face
+ *         values, if available for a given mesh.
+ *
+ * This adjacency is available when the \ref CS_RENUMBER_I_FACES_GATHER
+ * interior faces renumbering algorithm is selected. In this case, face-based
+ * operations may compute face values using the face-parallel thread ranges
+ * of cs_glob_mesh_adjacencies->i_face_gather_numbering, then gather them
+ * by cell, with no write conflicts. Other operations use the (threaded)
+ * interior face numbering of the mesh.
+ *
+ * For each cell, interior faces are listed first, by increasing id, with
+ * a positive sign if the cell is the first adjacent cell; boundary faces
+ * follow, with ids shifted by the number of interior faces.
+ *
+ * \param[in]  m  pointer to mesh structure
+ *
+ * \return  pointer to cells -> faces adjacency, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_adjacency_t  *
+cs_mesh_adjacencies_gather_c2f(const cs_mesh_t  *m)
+{
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+
+  if (ma == NULL || m != cs_glob_mesh || ma->c2f == NULL)
+    return NULL;
+
+  if (m->i_face_numbering == NULL || ma->c2f->n_elts != m->n_cells)
+    return NULL;
+
+  return ma->c2f;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a cs_adjacency_t structure of size n_elts
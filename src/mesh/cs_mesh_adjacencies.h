@@ -107,6 +107,18 @@ typedef struct {
   cs_adjacency_t        *_c2v;         /*!< cells to vertices adjacency if owner,
                                          NULL otherwise */
 
+  /* cells -> faces connectivity for cell-based gather of face values
+     (built only if the CS_RENUMBER_I_FACES_GATHER algorithm is used) */
+
+  cs_adjacency_t        *c2f;          /*!< cells to faces adjacency, with
+                                         boundary face ids shifted by the
+                                         number of interior faces, or NULL */
+
+  cs_numbering_t        *i_face_gather_numbering; /*!< face-parallel thread
+                                                    ranges for interior faces
+                                                    (faces of different threads
+                                                    may share cells), or NULL */
+
 } cs_mesh_adjacencies_t;
 
 /*============================================================================
@@ -171,6 +183,31 @@ cs_mesh_adjacencies_update_cell_cells_e(void);
 const cs_adjacency_t  *
 cs_mesh_adjacencies_cell_vertices(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return cells -> faces adjacency for cell-based gather of face
+ *         values, if available for a given mesh.
+ *
+ * This adjacency is available when the \ref CS_RENUMBER_I_FACES_GATHER
+ * interior faces renumbering algorithm is selected. In this case, face-based
+ * operations may compute face values using the face-parallel thread ranges
+ * of cs_glob_mesh_adjacencies->i_face_gather_numbering, then gather them
+ * by cell, with no write conflicts. Other operations use the (threaded)
+ * interior face numbering of the mesh.
+ *
+ * For each cell, interior faces are listed first, by increasing id, with
+ * a positive sign if the cell is the first adjacent cell; boundary faces
+ * follow, with ids shifted by the number of interior faces.
+ *
+ * \param[in]  m  pointer to mesh structure
+ *
+ * \return  pointer to cells -> faces adjacency, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_adjacency_t  *
+cs_mesh_adjacencies_gather_c2f(const cs_mesh_t  *m);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a cs_adjacency_t structure of size n_elts
@@ -241,7 +241,8 @@ _compute_offsetting(const cs_mesh_t             *mesh,
   cs_lnum_t  face_id, cell1, cell2;
   double  of_n, off_1, off_2;
 
-  const cs_real_t *v_of, *v_n;
+  cs_real_t v_of[3];
+  const cs_real_t *v_n;
 
   /* Loop on interior faces */
 
@@ -253,7 +254,8 @@ _compute_offsetting(const cs_mesh_t             *mesh,
     /* Compute center offsetting coefficient,
        in a manner consistent with iterative gradient reconstruction */
 
-    v_of = &(mesh_quantities->dofij[face_id*3]);
+    cs_mesh_quantities_i_face_dofij(mesh_quantities, face_id, cell1, cell2,
+                                    v_of);
     v_n = &(mesh_quantities->i_face_normal[face_id*3]);
     of_n = _MODULE_3D(v_of) * _MODULE_3D(v_n);
 
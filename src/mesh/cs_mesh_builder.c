@@ -177,6 +177,7 @@ cs_mesh_builder_create(void)
   /* Optional partitioning info */
 
   mb->cell_rank = NULL;
+  mb->cell_weight = NULL;
 
   /* Block ranges for parallel distribution */
 
@@ -234,6 +235,7 @@ cs_mesh_builder_destroy(cs_mesh_builder_t  **mb)
     /* Optional partitioning info */
 
     BFT_FREE(_mb->cell_rank);
+    BFT_FREE(_mb->cell_weight);
 
     /* Block ranges for parallel distribution */
 
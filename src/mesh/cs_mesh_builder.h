@@ -90,6 +90,8 @@ typedef struct {
   /* Optional partitioning info */
 
   int          *cell_rank;               /* Partition id for each cell */
+  cs_real_t    *cell_weight;             /* Optional cost weight for each
+                                            cell, or NULL for uniform */
 
   /* Block ranges for parallel distribution */
 
@@ -98,6 +98,10 @@ cs_mesh_quantities_t  *cs_glob_mesh_quantities = NULL;
 static int _cell_cen_algorithm = 0;
 static int _ajust_face_cog_compat_v11_v52 = 0;
 
+/* Low-memory mode: OF, II' and JJ' vectors recomputed on the fly */
+
+static int _low_memory = 0;
+
 /* Flag (mask) to activate bad cells correction
  * CS_BAD_CELLS_WARPED_CORRECTION
  * CS_FACE_DISTANCE_CLIP
@@ -1826,7 +1830,7 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
  *   weight         <--  weighting factor (Aij=pond Ai+(1-pond)Aj)
  *   dijpf          -->  vector i'j' for interior faces
  *   diipb          -->  vector ii'  for border faces
- *   dofij          -->  vector OF   for interior faces
+ *   dofij          -->  vector OF   for interior faces, or NULL
  *----------------------------------------------------------------------------*/
 
 static void
@@ -1879,6 +1883,9 @@ _compute_face_vectors(int                dim,
     dijpf[face_id*dim + 1] = dipjp*surfny;
     dijpf[face_id*dim + 2] = dipjp*surfnz;
 
+    if (dofij == NULL)
+      continue;
+
     pond = weight[face_id];
 
     /* ---> DOFIJ = OF */
@@ -2003,87 +2010,19 @@ _compute_face_sup_vectors(const cs_lnum_t    n_cells,
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
-    /* Normalized normal */
-    cs_real_3_t normal;
-    cs_math_3_normalise(i_face_normal[face_id], normal);
-
-    /* ---> IF and JF */
-    cs_real_t vec_if[3] = {
-      i_face_cog[face_id][0] - cell_cen[cell_id1][0],
-      i_face_cog[face_id][1] - cell_cen[cell_id1][1],
-      i_face_cog[face_id][2] - cell_cen[cell_id1][2]};
-
-    cs_real_t vec_jf[3] = {
-      i_face_cog[face_id][0] - cell_cen[cell_id2][0],
-      i_face_cog[face_id][1] - cell_cen[cell_id2][1],
-      i_face_cog[face_id][2] - cell_cen[cell_id2][2]};
-
-    /* ---> diipf = IF - (IF.Nij)Nij */
-    cs_math_3_orthogonal_projection(normal, vec_if, diipf[face_id]);
-
-    /* ---> djjpf = JF - (JF.Nij)Nij */
-    cs_math_3_orthogonal_projection(normal, vec_jf, djjpf[face_id]);
-
-    /* Limiter on interior face reconstruction */
-    if (cs_glob_mesh_quantities_flag & CS_FACE_RECONSTRUCTION_CLIP) {
-
-      cs_real_t surfn = cs_math_3_norm(i_face_normal[face_id]);
-      cs_real_t iip   = cs_math_3_norm(diipf[face_id]);
-
-      cs_real_t corri = 1.;
-      bool is_clipped = false;
-
-      if (0.5 * dist[face_id] < iip) {
-        is_clipped = true;
-        corri = 0.5 * dist[face_id] / iip;
-      }
-
-      diipf[face_id][0] *= corri;
-      diipf[face_id][1] *= corri;
-      diipf[face_id][2] *= corri;
-
-      iip = cs_math_3_norm(diipf[face_id]);
-
-      corri = 1.;
-
-      if (0.9 * cell_vol[cell_id1] < surfn * iip) {
-        is_clipped = true;
-        corri = 0.9 * cell_vol[cell_id1] / (surfn * iip);
-      }
-
-      diipf[face_id][0] *= corri;
-      diipf[face_id][1] *= corri;
-      diipf[face_id][2] *= corri;
-
-      cs_real_t jjp = cs_math_3_norm(djjpf[face_id]);
-
-      cs_real_t corrj = 1.;
-
-      if (0.5 * dist[face_id] < jjp) {
-        is_clipped = true;
-        corrj = 0.5 * dist[face_id] / jjp;
-      }
-
-      djjpf[face_id][0] *= corrj;
-      djjpf[face_id][1] *= corrj;
-      djjpf[face_id][2] *= corrj;
-
-      jjp = cs_math_3_norm(djjpf[face_id]);
-
-      corrj = 1.;
-      if (0.9 * cell_vol[cell_id2] < surfn * jjp) {
-        is_clipped = true;
-        corrj = 0.9 * cell_vol[cell_id2] / (surfn * jjp);
-      }
-
-      if (is_clipped && cell_id1 < n_cells)
-        w_count++;
-
-      djjpf[face_id][0] *= corrj;
-      djjpf[face_id][1] *= corrj;
-      djjpf[face_id][2] *= corrj;
-
-    }
+    bool is_clipped
+      = cs_mesh_quantities_i_face_sup_vectors_eval(i_face_normal[face_id],
+                                                   i_face_cog[face_id],
+                                                   cell_cen[cell_id1],
+                                                   cell_cen[cell_id2],
+                                                   cell_vol[cell_id1],
+                                                   cell_vol[cell_id2],
+                                                   dist[face_id],
+                                                   diipf[face_id],
+                                                   djjpf[face_id]);
+
+    if (is_clipped && cell_id1 < n_cells)
+      w_count++;
   }
 
   cs_parall_counter(&w_count, 1);
@@ -2201,6 +2140,34 @@ cs_mesh_quantities_face_cog_choice(int  algo_choice)
   return _ajust_face_cog_compat_v11_v52;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query or modification of the low-memory mode for mesh quantities.
+ *
+ * In low-memory mode, the interior face vectors OF, II' and JJ'
+ * (dofij, diipf, djjpf) are not stored, but recomputed where needed
+ * (see \ref cs_mesh_quantities_i_face_dofij and
+ * \ref cs_mesh_quantities_i_face_sup_vectors).
+ *
+ * This must be set before mesh quantities are computed.
+ *
+ * \param[in]  mode  < 0 : query
+ *                      0 : store all quantities (default)
+ *                      1 : low-memory mode
+ *
+ * \return  0 or 1 according to the selected mode
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_mesh_quantities_low_memory_choice(int  mode)
+{
+  if (mode > -1 && mode < 2)
+    _low_memory = mode;
+
+  return _low_memory;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create a mesh quantities structure.
@@ -2601,14 +2568,21 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
   if (mq->diipb == NULL)
     BFT_MALLOC(mq->diipb, n_b_faces*dim, cs_real_t);
 
-  if (mq->dofij == NULL)
-    BFT_MALLOC(mq->dofij, n_i_faces*dim, cs_real_t);
+  if (_low_memory) {
+    BFT_FREE(mq->dofij);
+    BFT_FREE(mq->diipf);
+    BFT_FREE(mq->djjpf);
+  }
+  else {
+    if (mq->dofij == NULL)
+      BFT_MALLOC(mq->dofij, n_i_faces*dim, cs_real_t);
 
-  if (mq->diipf == NULL)
-    BFT_MALLOC(mq->diipf, n_i_faces*dim, cs_real_t);
+    if (mq->diipf == NULL)
+      BFT_MALLOC(mq->diipf, n_i_faces*dim, cs_real_t);
 
-  if (mq->djjpf == NULL)
-    BFT_MALLOC(mq->djjpf, n_i_faces*dim, cs_real_t);
+    if (mq->djjpf == NULL)
+      BFT_MALLOC(mq->djjpf, n_i_faces*dim, cs_real_t);
+  }
 
   if (mq->b_sym_flag == NULL) {
     BFT_MALLOC(mq->b_sym_flag, n_b_faces, int);
@@ -2651,19 +2625,21 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
                         mq->diipb,
                         mq->dofij);
 
-  /* Compute additional vectors relative to faces to handle non-orthogonalities */
-
-  _compute_face_sup_vectors
-    (m->n_cells,
-     m->n_i_faces,
-     (const cs_lnum_2_t *)(m->i_face_cells),
-     (const cs_real_3_t *)(mq->i_face_normal),
-     (const cs_real_3_t *)(mq->i_face_cog),
-     (const cs_real_3_t *)(mq->cell_cen),
-     mq->cell_vol,
-     mq->i_dist,
-     (cs_real_3_t *)(mq->diipf),
-     (cs_real_3_t *)(mq->djjpf));
+  /* Compute additional vectors relative to faces to handle non-orthogonalities
+     (recomputed on the fly in low-memory mode) */
+
+  if (mq->diipf != NULL)
+    _compute_face_sup_vectors
+      (m->n_cells,
+       m->n_i_faces,
+       (const cs_lnum_2_t *)(m->i_face_cells),
+       (const cs_real_3_t *)(mq->i_face_normal),
+       (const cs_real_3_t *)(mq->i_face_cog),
+       (const cs_real_3_t *)(mq->cell_cen),
+       mq->cell_vol,
+       mq->i_dist,
+       (cs_real_3_t *)(mq->diipf),
+       (cs_real_3_t *)(mq->djjpf));
 
   /* Build the geometrical matrix linear gradient correction */
   if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
@@ -2809,6 +2785,9 @@ cs_mesh_quantities_sup_vectors(const cs_mesh_t       *mesh,
   cs_lnum_t  dim = mesh->dim;
   cs_lnum_t  n_i_faces = mesh->n_i_faces;
 
+  if (_low_memory)
+    return;
+
   if (mesh_quantities->diipf == NULL)
     BFT_MALLOC(mesh_quantities->diipf, n_i_faces*dim, cs_real_t);
 
@@ -3428,7 +3407,8 @@ cs_mesh_quantities_b_thickness_f(const cs_mesh_t             *m,
 void
 cs_mesh_quantities_log_setup(void)
 {
-  if (cs_glob_mesh_quantities_flag != 0 || _cell_cen_algorithm != 1)
+  if (   cs_glob_mesh_quantities_flag != 0 || _cell_cen_algorithm != 1
+      || _low_memory != 0)
     cs_log_printf(CS_LOG_SETUP, _("\n"
                                   "Mesh quantity computation options\n"
                                   "---------------------------------\n\n"));
@@ -3439,6 +3419,11 @@ cs_mesh_quantities_log_setup(void)
                 _("  Cell centers: %s\n"),
                 _(cen_type_name[_cell_cen_algorithm]));
 
+  if (_low_memory)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Low-memory mode: OF, II' and JJ' face vectors\n"
+                    "                   computed on the fly\n"));
+
   if (cs_glob_mesh_quantities_flag != 0) {
 
     const char *correction_name[] = {"CS_BAD_CELLS_WARPED_CORRECTION",
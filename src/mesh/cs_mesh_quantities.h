@@ -32,6 +32,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_base.h"
+#include "cs_math.h"
 #include "cs_mesh.h"
 
 /*----------------------------------------------------------------------------*/
@@ -159,6 +160,207 @@ extern cs_mesh_quantities_t  *cs_glob_mesh_quantities;
 /* Flag (mask) to activate bad cells correction */
 extern unsigned cs_glob_mesh_quantities_flag;
 
+/*=============================================================================
+ * Inline static function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate vectors II' and JJ' for an interior face.
+ *
+ * I' and J' are the orthogonal projections of cell centers I and J on the
+ * line orthogonal to the face passing through its center of gravity F:
+ *   II' = IF - (IF.Nij)Nij
+ *   JJ' = JF - (JF.Nij)Nij
+ *
+ * These vectors are clipped if \ref CS_FACE_RECONSTRUCTION_CLIP is set.
+ *
+ * \param[in]   face_normal  face surface normal
+ * \param[in]   face_cog     face center of gravity
+ * \param[in]   cell_cen_i   center of first adjacent cell
+ * \param[in]   cell_cen_j   center of second adjacent cell
+ * \param[in]   cell_vol_i   volume of first adjacent cell
+ * \param[in]   cell_vol_j   volume of second adjacent cell
+ * \param[in]   dist         distance IJ.Nij
+ * \param[out]  diipf        vector II'
+ * \param[out]  djjpf        vector JJ'
+ *
+ * \return  true if vectors were clipped, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+cs_mesh_quantities_i_face_sup_vectors_eval(const cs_real_t  face_normal[3],
+                                           const cs_real_t  face_cog[3],
+                                           const cs_real_t  cell_cen_i[3],
+                                           const cs_real_t  cell_cen_j[3],
+                                           cs_real_t        cell_vol_i,
+                                           cs_real_t        cell_vol_j,
+                                           cs_real_t        dist,
+                                           cs_real_t        diipf[3],
+                                           cs_real_t        djjpf[3])
+{
+  bool is_clipped = false;
+
+  /* Normalized normal */
+  cs_real_3_t normal;
+  cs_math_3_normalise(face_normal, normal);
+
+  /* ---> IF and JF */
+  cs_real_t vec_if[3] = {face_cog[0] - cell_cen_i[0],
+                         face_cog[1] - cell_cen_i[1],
+                         face_cog[2] - cell_cen_i[2]};
+
+  cs_real_t vec_jf[3] = {face_cog[0] - cell_cen_j[0],
+                         face_cog[1] - cell_cen_j[1],
+                         face_cog[2] - cell_cen_j[2]};
+
+  /* ---> diipf = IF - (IF.Nij)Nij */
+  cs_math_3_orthogonal_projection(normal, vec_if, diipf);
+
+  /* ---> djjpf = JF - (JF.Nij)Nij */
+  cs_math_3_orthogonal_projection(normal, vec_jf, djjpf);
+
+  /* Limiter on interior face reconstruction */
+  if (cs_glob_mesh_quantities_flag & CS_FACE_RECONSTRUCTION_CLIP) {
+
+    cs_real_t surfn = cs_math_3_norm(face_normal);
+    cs_real_t iip   = cs_math_3_norm(diipf);
+
+    cs_real_t corri = 1.;
+
+    if (0.5 * dist < iip) {
+      is_clipped = true;
+      corri = 0.5 * dist / iip;
+    }
+
+    diipf[0] *= corri;
+    diipf[1] *= corri;
+    diipf[2] *= corri;
+
+    iip = cs_math_3_norm(diipf);
+
+    corri = 1.;
+
+    if (0.9 * cell_vol_i < surfn * iip) {
+      is_clipped = true;
+      corri = 0.9 * cell_vol_i / (surfn * iip);
+    }
+
+    diipf[0] *= corri;
+    diipf[1] *= corri;
+    diipf[2] *= corri;
+
+    cs_real_t jjp = cs_math_3_norm(djjpf);
+
+    cs_real_t corrj = 1.;
+
+    if (0.5 * dist < jjp) {
+      is_clipped = true;
+      corrj = 0.5 * dist / jjp;
+    }
+
+    djjpf[0] *= corrj;
+    djjpf[1] *= corrj;
+    djjpf[2] *= corrj;
+
+    jjp = cs_math_3_norm(djjpf);
+
+    corrj = 1.;
+    if (0.9 * cell_vol_j < surfn * jjp) {
+      is_clipped = true;
+      corrj = 0.9 * cell_vol_j / (surfn * jjp);
+    }
+
+    djjpf[0] *= corrj;
+    djjpf[1] *= corrj;
+    djjpf[2] *= corrj;
+
+  }
+
+  return is_clipped;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get vectors II' and JJ' for an interior face.
+ *
+ * Stored values are used if present; otherwise (in low-memory mode),
+ * they are recomputed from base quantities.
+ *
+ * \param[in]   mq      pointer to mesh quantities structure
+ * \param[in]   f_id    interior face id
+ * \param[in]   c_id_i  id of first adjacent cell
+ * \param[in]   c_id_j  id of second adjacent cell
+ * \param[out]  diipf   vector II'
+ * \param[out]  djjpf   vector JJ'
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+cs_mesh_quantities_i_face_sup_vectors(const cs_mesh_quantities_t  *mq,
+                                      cs_lnum_t                    f_id,
+                                      cs_lnum_t                    c_id_i,
+                                      cs_lnum_t                    c_id_j,
+                                      cs_real_t                    diipf[3],
+                                      cs_real_t                    djjpf[3])
+{
+  if (mq->diipf != NULL) {
+    for (int k = 0; k < 3; k++) {
+      diipf[k] = mq->diipf[f_id*3 + k];
+      djjpf[k] = mq->djjpf[f_id*3 + k];
+    }
+  }
+  else
+    cs_mesh_quantities_i_face_sup_vectors_eval(mq->i_face_normal + f_id*3,
+                                               mq->i_face_cog + f_id*3,
+                                               mq->cell_cen + c_id_i*3,
+                                               mq->cell_cen + c_id_j*3,
+                                               mq->cell_vol[c_id_i],
+                                               mq->cell_vol[c_id_j],
+                                               mq->i_dist[f_id],
+                                               diipf,
+                                               djjpf);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get vector OF for an interior face.
+ *
+ * O is the intersection of the segment IJ joining adjacent cell centers
+ * with the face plane, and F the face center of gravity.
+ *
+ * Stored values are used if present; otherwise (in low-memory mode),
+ * they are recomputed from base quantities.
+ *
+ * \param[in]   mq      pointer to mesh quantities structure
+ * \param[in]   f_id    interior face id
+ * \param[in]   c_id_i  id of first adjacent cell
+ * \param[in]   c_id_j  id of second adjacent cell
+ * \param[out]  dofij   vector OF
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+cs_mesh_quantities_i_face_dofij(const cs_mesh_quantities_t  *mq,
+                                cs_lnum_t                    f_id,
+                                cs_lnum_t                    c_id_i,
+                                cs_lnum_t                    c_id_j,
+                                cs_real_t                    dofij[3])
+{
+  if (mq->dofij != NULL) {
+    for (int k = 0; k < 3; k++)
+      dofij[k] = mq->dofij[f_id*3 + k];
+  }
+  else {
+    const cs_real_t pond = mq->weight[f_id];
+    for (int k = 0; k < 3; k++)
+      dofij[k] = mq->i_face_cog[f_id*3 + k]
+        - (        pond *mq->cell_cen[c_id_i*3 + k]
+           + (1. - pond)*mq->cell_cen[c_id_j*3 + k]);
+  }
+}
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -194,6 +396,28 @@ cs_mesh_quantities_cell_cen_choice(int  algo_choice);
 int
 cs_mesh_quantities_face_cog_choice(int  algo_choice);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query or modification of the low-memory mode for mesh quantities.
+ *
+ * In low-memory mode, the interior face vectors OF, II' and JJ'
+ * (dofij, diipf, djjpf) are not stored, but recomputed where needed
+ * (see \ref cs_mesh_quantities_i_face_dofij and
+ * \ref cs_mesh_quantities_i_face_sup_vectors).
+ *
+ * This must be set before mesh quantities are computed.
+ *
+ * \param[in]  mode  < 0 : query
+ *                      0 : store all quantities (default)
+ *                      1 : low-memory mode
+ *
+ * \return  0 or 1 according to the selected mode
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_mesh_quantities_low_memory_choice(int  mode);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create a mesh quantities structure.
@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <locale.h>
 #include <math.h>
 #include <stdio.h>
@@ -936,6 +937,250 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
   BFT_FREE(weight);
 }
 
+/*----------------------------------------------------------------------------
+ * Return the multiplier applied to cell weights so that, as for graph
+ * partitioning (see _cell_weights_for_graph), a cell of mean weight
+ * costs 10 times the unit base cost of each cell.
+ *
+ * parameters:
+ *   n_g_cells <-- global number of cells
+ *   w_sum     <-- sum of (positive) weights of all cells
+ *
+ * returns:
+ *   weight multiplier (0 if all weights are zero)
+ *----------------------------------------------------------------------------*/
+
+static double
+_cell_weight_mult(cs_gnum_t  n_g_cells,
+                  double     w_sum)
+{
+  double w_mult = 0;
+  if (w_sum > 0 && n_g_cells > 0)
+    w_mult = 10. * (double)n_g_cells / w_sum;
+
+  return w_mult;
+}
+
+/*----------------------------------------------------------------------------
+ * Assign ranks to cells ordered along a space-filling curve, so that
+ * each rank receives a contiguous curve segment of similar total cost.
+ *
+ * The cost of each cell is 1 + w_mult.weight, so that zero-weight
+ * cells are also distributed, and all-zero weights lead to a uniform
+ * distribution.
+ *
+ * parameters:
+ *   n_cells     <-- number of cells in ordered section
+ *   n_ranks     <-- number of ranks in partition
+ *   w_start     <-- sum of costs of cells preceding this section
+ *   w_tot       <-- sum of costs of all cells
+ *   w_mult      <-- weight multiplier
+ *   cell_weight <-- weight of each cell in ordered section
+ *   cell_rank   --> rank of each cell in ordered section
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_rank_by_weight(cs_lnum_t        n_cells,
+                     int              n_ranks,
+                     double           w_start,
+                     double           w_tot,
+                     double           w_mult,
+                     const cs_real_t  cell_weight[],
+                     int              cell_rank[])
+{
+  double w_sum = w_start;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+
+    double w = 1. + CS_MAX(cell_weight[i], 0.) * w_mult;
+    int r = 0;
+
+    /* Rank based on the middle of the cell's curve segment */
+
+    if (w_tot > 0)
+      r = (w_sum + 0.5*w) / w_tot * n_ranks;
+
+    cell_rank[i] = CS_MAX(CS_MIN(r, n_ranks - 1), 0);
+
+    w_sum += w;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Define cell ranks from their position along a space-filling curve,
+ * based on cell weights.
+ *
+ * parameters:
+ *   n_g_cells   <-- global number of cells
+ *   n_ranks     <-- number of ranks in partition
+ *   n_cells     <-- number of local cells
+ *   cell_num    <-- global cell number along space-filling curve
+ *   cell_weight <-- cell weight
+ *   cell_rank   --> cell rank
+ *   comm        <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_cell_rank_by_sfc_weight(cs_gnum_t         n_g_cells,
+                         int               n_ranks,
+                         cs_lnum_t         n_cells,
+                         const cs_gnum_t   cell_num[],
+                         const cs_real_t   cell_weight[],
+                         int               cell_rank[],
+                         MPI_Comm          comm)
+
+#else
+
+static void
+_cell_rank_by_sfc_weight(cs_gnum_t         n_g_cells,
+                         int               n_ranks,
+                         cs_lnum_t         n_cells,
+                         const cs_gnum_t   cell_num[],
+                         const cs_real_t   cell_weight[],
+                         int               cell_rank[])
+
+#endif
+{
+  int comm_size = 1;
+
+#if defined(HAVE_MPI)
+
+  if (comm != MPI_COMM_NULL)
+    MPI_Comm_size(comm, &comm_size);
+
+  if (comm_size > 1) {
+
+    int comm_rank;
+    MPI_Comm_rank(comm, &comm_rank);
+
+    /* Distribute weights to blocks ordered along the curve */
+
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(comm_rank,
+                                                          comm_size,
+                                                          1,
+                                                          0,
+                                                          n_g_cells);
+
+    cs_lnum_t n_b_cells = 0;
+    if (bi.gnum_range[1] > bi.gnum_range[0])
+      n_b_cells = bi.gnum_range[1] - bi.gnum_range[0];
+
+    cs_all_to_all_t *d = cs_all_to_all_create_from_block(n_cells,
+                                                         0, /* flags */
+                                                         cell_num,
+                                                         bi,
+                                                         comm);
+
+    cs_gnum_t *r_num = cs_all_to_all_copy_array(d,
+                                                CS_GNUM_TYPE,
+                                                1,
+                                                false, /* reverse */
+                                                cell_num,
+                                                NULL);
+
+    cs_real_t *r_weight = cs_all_to_all_copy_array(d,
+                                                   CS_REAL_TYPE,
+                                                   1,
+                                                   false, /* reverse */
+                                                   cell_weight,
+                                                   NULL);
+
+    cs_lnum_t n_r = cs_all_to_all_n_elts_dest(d);
+
+    cs_real_t *b_weight;
+    int *b_rank;
+    BFT_MALLOC(b_weight, n_b_cells, cs_real_t);
+    BFT_MALLOC(b_rank, n_b_cells, int);
+
+    for (cs_lnum_t i = 0; i < n_b_cells; i++)
+      b_weight[i] = 0;
+
+    for (cs_lnum_t i = 0; i < n_r; i++)
+      b_weight[r_num[i] - bi.gnum_range[0]] = r_weight[i];
+
+    BFT_FREE(r_weight);
+
+    /* Position of local block along the curve */
+
+    double w_l = 0, w_start = 0, w_tot = 0;
+
+    for (cs_lnum_t i = 0; i < n_b_cells; i++)
+      w_l += CS_MAX(b_weight[i], 0.);
+
+    MPI_Exscan(&w_l, &w_start, 1, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Allreduce(&w_l, &w_tot, 1, MPI_DOUBLE, MPI_SUM, comm);
+
+    if (comm_rank == 0)
+      w_start = 0;
+
+    /* Convert to costs, including the unit base cost of each cell */
+
+    double w_mult = _cell_weight_mult(n_g_cells, w_tot);
+
+    w_start = (double)(bi.gnum_range[0] - 1) + w_start*w_mult;
+    w_tot = (double)n_g_cells + w_tot*w_mult;
+
+    _cell_rank_by_weight(n_b_cells, n_ranks, w_start, w_tot, w_mult,
+                         b_weight, b_rank);
+
+    BFT_FREE(b_weight);
+
+    /* Return ranks to cells */
+
+    int *r_rank;
+    BFT_MALLOC(r_rank, n_r, int);
+
+    for (cs_lnum_t i = 0; i < n_r; i++)
+      r_rank[i] = b_rank[r_num[i] - bi.gnum_range[0]];
+
+    BFT_FREE(b_rank);
+    BFT_FREE(r_num);
+
+    cs_all_to_all_copy_array(d,
+                             CS_INT_TYPE,
+                             1,
+                             true, /* reverse */
+                             r_rank,
+                             cell_rank);
+
+    BFT_FREE(r_rank);
+
+    cs_all_to_all_destroy(&d);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (comm_size == 1) {
+
+    cs_real_t *s_weight;
+    int *s_rank;
+    BFT_MALLOC(s_weight, n_cells, cs_real_t);
+    BFT_MALLOC(s_rank, n_cells, int);
+
+    double w_tot = 0;
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      s_weight[cell_num[i] - 1] = cell_weight[i];
+      w_tot += CS_MAX(cell_weight[i], 0.);
+    }
+
+    double w_mult = _cell_weight_mult(n_g_cells, w_tot);
+
+    w_tot = (double)n_cells + w_tot*w_mult;
+
+    _cell_rank_by_weight(n_cells, n_ranks, 0, w_tot, w_mult,
+                         s_weight, s_rank);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_rank[i] = s_rank[cell_num[i] - 1];
+
+    BFT_FREE(s_rank);
+    BFT_FREE(s_weight);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Define cell ranks using a space-filling curve.
  *
@@ -1017,9 +1262,22 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
   if (n_g_cells % n_ranks)
     block_size += 1;
 
-  /* Determine rank based on global numbering with SFC ordering; */
+  /* Determine rank based on global numbering with SFC ordering;
+     with cell weights, curve segments of similar weight are used. */
+
+  if (mb->cell_weight != NULL) {
+
+#if defined(HAVE_MPI)
+    _cell_rank_by_sfc_weight(n_g_cells, n_ranks, n_cells, cell_num,
+                             mb->cell_weight, cell_rank, comm);
+#else
+    _cell_rank_by_sfc_weight(n_g_cells, n_ranks, n_cells, cell_num,
+                             mb->cell_weight, cell_rank);
+#endif
 
-  if (_part_uniform_sfc_block_size == false) {
+  }
+
+  else if (_part_uniform_sfc_block_size == false) {
 
     cs_gnum_t cells_per_rank = n_g_cells / n_ranks;
     cs_lnum_t rmdr = n_g_cells - cells_per_rank * (cs_gnum_t)n_ranks;
@@ -1364,6 +1622,7 @@ _metis_cell_cells(size_t       n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
@@ -1372,6 +1631,7 @@ _part_metis(size_t   n_cells,
             int      n_parts,
             idx_t   *cell_idx,
             idx_t   *cell_neighbors,
+            int     *cell_weight,
             int     *cell_part)
 {
   size_t i;
@@ -1384,6 +1644,7 @@ _part_metis(size_t   n_cells,
   idx_t   _n_cells = n_cells;
   idx_t   _n_parts = n_parts;
   idx_t  *_cell_part = NULL;
+  idx_t  *_cell_weight = NULL;
 
   start_time = cs_timer_wtime();
 
@@ -1393,6 +1654,16 @@ _part_metis(size_t   n_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, idx_t);
 
+  if (cell_weight != NULL) {
+    if (sizeof(idx_t) == sizeof(int))
+      _cell_weight = (idx_t *)cell_weight;
+    else {
+      BFT_MALLOC(_cell_weight, n_cells, idx_t);
+      for (i = 0; i < n_cells; i++)
+        _cell_weight[i] = cell_weight[i];
+    }
+  }
+
   if (n_parts < 8) {
 
     bft_printf(_("\n"
@@ -1404,7 +1675,7 @@ _part_metis(size_t   n_cells,
                              &_n_constraints,
                              cell_idx,
                              cell_neighbors,
-                             NULL,       /* vwgt:   cell weights */
+                             _cell_weight, /* vwgt: cell weights */
                              NULL,       /* vsize:  size of the vertices */
                              NULL,       /* adjwgt: face weights */
                              &_n_parts,
@@ -1427,7 +1698,7 @@ _part_metis(size_t   n_cells,
                         &_n_constraints,
                         cell_idx,
                         cell_neighbors,
-                        NULL,       /* vwgt:   cell weights */
+                        _cell_weight, /* vwgt: cell weights */
                         NULL,       /* vsize:  size of the vertices */
                         NULL,       /* adjwgt: face weights */
                         &_n_parts,
@@ -1455,6 +1726,7 @@ _part_metis(size_t   n_cells,
     for (i = 0; i < n_cells; i++)
       cell_part[i] = _cell_part[i];
     BFT_FREE(_cell_part);
+    BFT_FREE(_cell_weight);
   }
 }
 
@@ -1471,6 +1743,7 @@ _part_metis(size_t   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1481,6 +1754,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                int         n_parts,
                idx_t      *cell_idx,
                idx_t      *cell_neighbors,
+               int        *cell_weight,
                int        *cell_part,
                MPI_Comm    comm)
 {
@@ -1495,6 +1769,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
   idx_t     vtxend = cell_range[1] - 1;
   idx_t    *vtxdist = NULL;
   idx_t    *_cell_part = NULL;
+  idx_t    *_cell_weight = NULL;
   MPI_Datatype mpi_idx_t = MPI_DATATYPE_NULL;
 
   start_time = cs_timer_wtime();
@@ -1519,6 +1794,16 @@ _part_parmetis(cs_gnum_t   n_g_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, idx_t);
 
+  if (cell_weight != NULL) {
+    if (sizeof(idx_t) == sizeof(int))
+      _cell_weight = (idx_t *)cell_weight;
+    else {
+      BFT_MALLOC(_cell_weight, n_cells, idx_t);
+      for (i = 0; i < n_cells; i++)
+        _cell_weight[i] = cell_weight[i];
+    }
+  }
+
   bft_printf(_("\n"
                " Partitioning %llu cells to %d domains on %d ranks\n"
                "   (ParMETIS_V3_PartKway).\n"),
@@ -1543,6 +1828,9 @@ _part_parmetis(cs_gnum_t   n_g_cells,
     idx_t  numflag  = 0; /* 0 to n-1 numbering (C type) */
     idx_t  wgtflag  = 0; /* No weighting for faces or cells */
 
+    if (_cell_weight != NULL)
+      wgtflag = 2;       /* Weights on cells only */
+
     real_t wgt = 1.0/n_parts;
     real_t ubvec[]  = {1.5};
     real_t *tpwgts = NULL;
@@ -1556,7 +1844,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                    (vtxdist,
                     cell_idx,
                     cell_neighbors,
-                    NULL,       /* vwgt:   cell weights */
+                    _cell_weight, /* vwgt: cell weights */
                     NULL,       /* adjwgt: face weights */
                     &wgtflag,
                     &numflag,
@@ -1602,6 +1890,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
     for (i = 0; i < n_cells; i++)
       cell_part[i] = _cell_part[i];
     BFT_FREE(_cell_part);
+    BFT_FREE(_cell_weight);
   }
 }
 
@@ -1865,6 +2154,7 @@ _scotch_cell_cells(size_t        n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
@@ -1873,6 +2163,7 @@ _part_scotch(SCOTCH_Num   n_cells,
              int          n_parts,
              SCOTCH_Num  *cell_idx,
              SCOTCH_Num  *cell_neighbors,
+             int         *cell_weight,
              int         *cell_part)
 {
   SCOTCH_Num  i;
@@ -1885,6 +2176,7 @@ _part_scotch(SCOTCH_Num   n_cells,
 
   SCOTCH_Num    edgecut = 0; /* <-- Number of faces on partition */
   SCOTCH_Num  *_cell_part = NULL;
+  SCOTCH_Num  *_cell_weight = NULL;
 
   /* Initialization */
 
@@ -1895,6 +2187,16 @@ _part_scotch(SCOTCH_Num   n_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, SCOTCH_Num);
 
+  if (cell_weight != NULL) {
+    if (sizeof(SCOTCH_Num) == sizeof(int))
+      _cell_weight = (SCOTCH_Num *)cell_weight;
+    else {
+      BFT_MALLOC(_cell_weight, n_cells, SCOTCH_Num);
+      for (i = 0; i < n_cells; i++)
+        _cell_weight[i] = cell_weight[i];
+    }
+  }
+
   bft_printf(_("\n"
                " Partitioning %llu cells to %d domains\n"
                "   (SCOTCH_graphPart).\n"),
@@ -1910,7 +2212,7 @@ _part_scotch(SCOTCH_Num   n_cells,
                         n_cells,            /* vertnbr */
                         cell_idx,           /* verttab */
                         NULL,               /* vendtab: verttab + 1 or NULL */
-                        NULL,               /* velotab: vertex weights */
+                        _cell_weight,       /* velotab: vertex weights */
                         NULL,               /* vlbltab; vertex labels */
                         cell_idx[n_cells],  /* edgenbr */
                         cell_neighbors,     /* edgetab */
@@ -1934,6 +2236,7 @@ _part_scotch(SCOTCH_Num   n_cells,
     for (i = 0; i < n_cells; i++)
       cell_part[i] = _cell_part[i];
     BFT_FREE(_cell_part);
+    BFT_FREE(_cell_weight);
   }
 
   /* Compute edge cut */
@@ -1986,6 +2289,7 @@ _part_scotch(SCOTCH_Num   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1996,6 +2300,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                int          n_parts,
                SCOTCH_Num  *cell_idx,
                SCOTCH_Num  *cell_neighbors,
+               int         *cell_weight,
                int         *cell_part,
                MPI_Comm     comm)
 {
@@ -2010,6 +2315,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
   SCOTCH_Num    n_cells = cell_range[1] - cell_range[0];
   SCOTCH_Num  *_cell_part = NULL;
+  SCOTCH_Num  *_cell_weight = NULL;
 
   /* Initialization */
 
@@ -2022,6 +2328,16 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, SCOTCH_Num);
 
+  if (cell_weight != NULL) {
+    if (sizeof(SCOTCH_Num) == sizeof(int))
+      _cell_weight = (SCOTCH_Num *)cell_weight;
+    else {
+      BFT_MALLOC(_cell_weight, n_cells, SCOTCH_Num);
+      for (i = 0; i < n_cells; i++)
+        _cell_weight[i] = cell_weight[i];
+    }
+  }
+
   bft_printf(_("\n"
                " Partitioning %llu cells to %d domains on %d ranks\n"
                "   (SCOTCH_dgraphPart).\n"),
@@ -2039,7 +2355,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                 n_cells,            /* vertlocmax (= vertlocnbr) */
                 cell_idx,           /* vertloctab */
                 NULL,               /* vendloctab: vertloctab + 1 or NULL */
-                NULL,               /* veloloctab: vertex weights */
+                _cell_weight,       /* veloloctab: vertex weights */
                 NULL,               /* vlblloctab; vertex labels */
                 cell_idx[n_cells],  /* edgelocnbr */
                 cell_idx[n_cells],  /* edgelocsiz */
@@ -2066,6 +2382,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
     for (i = 0; i < n_cells; i++)
       cell_part[i] = _cell_part[i];
     BFT_FREE(_cell_part);
+    BFT_FREE(_cell_weight);
   }
 
   /* Finalization */
@@ -2256,6 +2573,113 @@ _prepare_input(const cs_mesh_t           *mesh,
 #if   defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
    || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
 
+/*----------------------------------------------------------------------------
+ * Build integer graph vertex weights from optional mesh builder cell weights.
+ *
+ * Weights are redistributed to the partitioner's block distribution if
+ * needed, and scaled relative to the mean weight so that a cell of mean
+ * weight has an integer weight of 11.
+ *
+ * parameters:
+ *   mb           <-- pointer to mesh builder structure
+ *   n_g_cells    <-- global number of cells
+ *   rank_step    <-- Step between active partitioning ranks
+ *   cell_range   <-- first and past-the-last cell numbers for this rank
+ *
+ * returns:
+ *   pointer to allocated integer weights, or NULL if unweighted
+ *----------------------------------------------------------------------------*/
+
+static int *
+_cell_weights_for_graph(const cs_mesh_builder_t  *mb,
+                        cs_gnum_t                 n_g_cells,
+                        int                       rank_step,
+                        const cs_gnum_t           cell_range[2])
+{
+  if (mb->cell_weight == NULL)
+    return NULL;
+
+  cs_lnum_t n_cells = cell_range[1] - cell_range[0];
+
+  const cs_real_t *b_weight = mb->cell_weight;
+  cs_real_t *_b_weight = NULL;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1 && mb->cell_bi.rank_step != rank_step) {
+
+    cs_lnum_t n_mb_cells = 0;
+    if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+      n_mb_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+    cs_gnum_t *cell_num;
+    BFT_MALLOC(cell_num, n_mb_cells, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_mb_cells; i++)
+      cell_num[i] = mb->cell_bi.gnum_range[0] + (cs_gnum_t)i;
+
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                          cs_glob_n_ranks,
+                                                          rank_step,
+                                                          0,
+                                                          n_g_cells);
+
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        bi,
+                                        n_mb_cells,
+                                        cell_num);
+
+    BFT_MALLOC(_b_weight, n_cells, cs_real_t);
+
+    cs_part_to_block_copy_array(d,
+                                CS_REAL_TYPE,
+                                1,
+                                mb->cell_weight,
+                                _b_weight);
+
+    cs_part_to_block_destroy(&d);
+    BFT_FREE(cell_num);
+
+    b_weight = _b_weight;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Scale weights relative to mean */
+
+  double w_sum = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    w_sum += CS_MAX(b_weight[i], 0.);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double _w_sum = w_sum;
+    MPI_Allreduce(&_w_sum, &w_sum, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+  }
+#endif
+
+  double w_mult = _cell_weight_mult(n_g_cells, w_sum);
+
+  /* Graph partitioners may use 32-bit integers for weights and their sums,
+     so limit the multiplier to keep the total weight below INT_MAX/2 */
+
+  double w_tot_max = 0.5*INT_MAX - (double)n_g_cells;
+  if (w_sum * w_mult > w_tot_max)
+    w_mult = (w_tot_max > 0) ? w_tot_max / w_sum : 0;
+
+  int *cell_weight;
+  BFT_MALLOC(cell_weight, n_cells, int);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    double w = 1. + CS_MAX(b_weight[i], 0.) * w_mult;
+    cell_weight[i] = (w < INT_MAX) ? (int)w : INT_MAX;
+  }
+
+  BFT_FREE(_b_weight);
+
+  return cell_weight;
+}
+
 /*----------------------------------------------------------------------------
  * Distribute partitioning info so as to match mesh builder block info.
  *
@@ -3127,8 +3551,10 @@ cs_partition(cs_mesh_t             *mesh,
   /* Read cell rank data if available */
 
   if (cs_glob_n_ranks > 1) {
-    if (   stage != CS_PARTITION_MAIN
-        || cs_partition_get_preprocess() == false) {
+    /* Cell weights imply computing a new partition */
+    if (   (   stage != CS_PARTITION_MAIN
+            || cs_partition_get_preprocess() == false)
+        && mb->cell_weight == NULL) {
       _read_cell_rank(mesh, mb, CS_IO_ECHO_OPEN_CLOSE);
       if (mb->have_cell_rank)
         return;
@@ -3184,6 +3610,7 @@ cs_partition(cs_mesh_t             *mesh,
     int  i;
     cs_timer_t  t2;
     idx_t  *cell_idx = NULL, *cell_neighbors = NULL;
+    int  *cell_weight = NULL;
 
     _metis_cell_cells(n_cells,
                       n_faces,
@@ -3195,6 +3622,11 @@ cs_partition(cs_mesh_t             *mesh,
     if (face_cells != mb->face_cells)
       BFT_FREE(face_cells);
 
+    cell_weight = _cell_weights_for_graph(mb,
+                                          mesh->n_g_cells,
+                                          _part_rank_step[stage],
+                                          cell_range);
+
     t2 = cs_timer_time();
     dt = cs_timer_diff(&t0, &t2);
 
@@ -3234,6 +3666,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         cell_weight,
                          cell_part,
                          part_comm);
 
@@ -3281,6 +3714,7 @@ cs_partition(cs_mesh_t             *mesh,
                       n_ranks,
                       cell_idx,
                       cell_neighbors,
+                      cell_weight,
                       cell_part);
 
         _distribute_output(mb,
@@ -3300,6 +3734,7 @@ cs_partition(cs_mesh_t             *mesh,
 
     BFT_FREE(cell_idx);
     BFT_FREE(cell_neighbors);
+    BFT_FREE(cell_weight);
   }
 
 #endif /* defined(HAVE_METIS) || defined(HAVE_PARMETIS) */
@@ -3311,6 +3746,7 @@ cs_partition(cs_mesh_t             *mesh,
     int  i;
     cs_timer_t  t2;
     SCOTCH_Num  *cell_idx = NULL, *cell_neighbors = NULL;
+    int  *cell_weight = NULL;
 
     _scotch_cell_cells(n_cells,
                        n_faces,
@@ -3322,6 +3758,11 @@ cs_partition(cs_mesh_t             *mesh,
     if (face_cells != mb->face_cells)
       BFT_FREE(face_cells);
 
+    cell_weight = _cell_weights_for_graph(mb,
+                                          mesh->n_g_cells,
+                                          _part_rank_step[stage],
+                                          cell_range);
+
     t2 = cs_timer_time();
     dt = cs_timer_diff(&t0, &t2);
 
@@ -3361,6 +3802,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         cell_weight,
                          cell_part,
                          part_comm);
 
@@ -3408,6 +3850,7 @@ cs_partition(cs_mesh_t             *mesh,
                        n_ranks,
                        cell_idx,
                        cell_neighbors,
+                       cell_weight,
                        cell_part);
 
         _distribute_output(mb,
@@ -3427,6 +3870,7 @@ cs_partition(cs_mesh_t             *mesh,
 
     BFT_FREE(cell_idx);
     BFT_FREE(cell_neighbors);
+    BFT_FREE(cell_weight);
   }
 
 #endif /* defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
@@ -575,27 +575,35 @@ _les_balance_compute_gradients(void)
   if (_les_balance.type & CS_LES_BALANCE_TUI) {
 
     const int keysca = cs_field_key_id("scalar_id");
+    const int n_fields = cs_field_n_fields();
     int iii = 0;
 
-    for (int f_id = 0; f_id < cs_field_n_fields(); f_id ++) {
+    /* Gradients of all scalars are computed together */
+
+    const cs_field_t **f_sca;
+    cs_real_3_t **grad_sca;
+    BFT_MALLOC(f_sca, n_fields, const cs_field_t *);
+    BFT_MALLOC(grad_sca, n_fields, cs_real_3_t *);
+
+    for (int f_id = 0; f_id < n_fields; f_id ++) {
       cs_field_t *f = cs_field_by_id(f_id);
       int isca = cs_field_get_key_int(f, keysca);
       if (isca > 0) {
-        const cs_equation_param_t *eqps
-          = cs_field_get_equation_param_const(f);
-
-        cs_gradient_type_by_imrgra(eqps->imrgra,
-                                   &gradient_type,
-                                   &halo_type);
-
-        cs_field_gradient_scalar(f,
-                                 false, /* use_previous_t */
-                                 inc,
-                                 true, /* _recompute_cocg */
-                                 (cs_real_3_t *)_gradt[iii]->val);
-         iii++;
+        f_sca[iii] = f;
+        grad_sca[iii] = (cs_real_3_t *)_gradt[iii]->val;
+        iii++;
       }
     }
+
+    cs_field_gradient_scalar_multi(iii,
+                                   f_sca,
+                                   false, /* use_previous_t */
+                                   inc,
+                                   true, /* _recompute_cocg */
+                                   grad_sca);
+
+    BFT_FREE(grad_sca);
+    BFT_FREE(f_sca);
   }
 }
 
@@ -0,0 +1,471 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_gradient.h"
+#include "cs_halo.h"
+#include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_cartesian.h"
+#include "cs_mesh_quantities.h"
+#include "cs_preprocessor_data.h"
+#include "cs_renumber.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _N_FIELDS 3
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build a distorted cartesian mesh and associated quantities.
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(void)
+{
+  int n_cells[3] = {8, 7, 6};
+  cs_real_t xyz[6] = {0., 0., 0., 1.2, 1., 0.8};
+
+  cs_mesh_cartesian_create();
+  cs_mesh_cartesian_define_simple(n_cells, xyz);
+
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh_builder = cs_mesh_builder_create();
+
+  cs_mesh_t *m = cs_glob_mesh;
+
+  cs_preprocessor_data_read_headers(m, cs_glob_mesh_builder);
+  cs_preprocessor_data_read_mesh(m, cs_glob_mesh_builder);
+  cs_mesh_init_halo(m, cs_glob_mesh_builder, CS_HALO_EXTENDED);
+  cs_mesh_update_auxiliary(m);
+
+  /* Build default numberings (with thread groups if needed) */
+
+  cs_renumber_mesh(m);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+
+  /* Distort mesh so that reconstruction and clipping are non-trivial */
+
+  for (cs_lnum_t i = 0; i < m->n_vertices; i++) {
+    cs_real_t *x = m->vtx_coord + i*3;
+    cs_real_t s = sin(23.*x[0] + 31.*x[1] + 37.*x[2]);
+    for (int k = 0; k < 3; k++)
+      x[k] += 0.02*s*(k+1);
+  }
+
+  cs_glob_mesh_quantities = cs_mesh_quantities_create();
+  cs_mesh_quantities_compute(m, cs_glob_mesh_quantities);
+
+  cs_mesh_adjacencies_initialize();
+  cs_mesh_adjacencies_update_mesh();
+}
+
+/*----------------------------------------------------------------------------
+ * Compare gradients of multiple fields computed together with those
+ * computed separately; results must be bit for bit identical.
+ *
+ * parameters:
+ *   gradient_type <-- gradient type
+ *   halo_type     <-- halo type
+ *   inc           <-- if 0, solve on increment; 1 otherwise
+ *   clip_mode     <-- clipping mode
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_gradient_scalar_multi(cs_gradient_type_t   gradient_type,
+                             cs_halo_type_t       halo_type,
+                             int                  inc,
+                             cs_gradient_limit_t  clip_mode)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const char *name[_N_FIELDS] = {"s_0", "s_1", "s_2"};
+
+  cs_real_t *var[_N_FIELDS], *_bc_coeff_a[_N_FIELDS], *_bc_coeff_b[_N_FIELDS];
+  const cs_real_t *bc_coeff_a[_N_FIELDS], *bc_coeff_b[_N_FIELDS];
+  cs_real_3_t *grad_ref[_N_FIELDS], *grad[_N_FIELDS];
+
+  for (int v_id = 0; v_id < _N_FIELDS; v_id++) {
+
+    BFT_MALLOC(var[v_id], n_cells_ext, cs_real_t);
+    BFT_MALLOC(_bc_coeff_a[v_id], n_b_faces, cs_real_t);
+    BFT_MALLOC(_bc_coeff_b[v_id], n_b_faces, cs_real_t);
+    BFT_MALLOC(grad_ref[v_id], n_cells_ext, cs_real_3_t);
+    BFT_MALLOC(grad[v_id], n_cells_ext, cs_real_3_t);
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+      const cs_real_t *x = cell_cen[c_id];
+      var[v_id][c_id] =   sin((v_id+3)*x[0]) + x[1]*x[2]*(v_id+1)
+                        + 0.1*cos(17.*x[1]);
+    }
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+      _bc_coeff_a[v_id][f_id] = 0.1*sin(f_id + v_id);
+      _bc_coeff_b[v_id][f_id] = 0.5*v_id;
+    }
+
+    bc_coeff_a[v_id] = _bc_coeff_a[v_id];
+    bc_coeff_b[v_id] = _bc_coeff_b[v_id];
+
+  }
+
+  /* Last field uses default (homogeneous Neumann) boundary conditions */
+
+  bc_coeff_a[_N_FIELDS-1] = NULL;
+  bc_coeff_b[_N_FIELDS-1] = NULL;
+
+  for (int v_id = 0; v_id < _N_FIELDS; v_id++)
+    cs_gradient_scalar(name[v_id],
+                       gradient_type,
+                       halo_type,
+                       inc,
+                       true,          /* recompute_cocg */
+                       2,             /* n_r_sweeps */
+                       0,             /* tr_dim */
+                       0,             /* hyd_p_flag */
+                       1,             /* w_stride */
+                       0,             /* verbosity */
+                       clip_mode,
+                       1e-8,          /* epsilon */
+                       1.2,           /* clip_coeff */
+                       NULL,          /* f_ext */
+                       bc_coeff_a[v_id],
+                       bc_coeff_b[v_id],
+                       var[v_id],
+                       NULL,          /* c_weight */
+                       NULL,          /* cpl */
+                       grad_ref[v_id]);
+
+  cs_gradient_scalar_multi(_N_FIELDS,
+                           name,
+                           gradient_type,
+                           halo_type,
+                           inc,
+                           true,          /* recompute_cocg */
+                           2,             /* n_r_sweeps */
+                           0,             /* verbosity */
+                           clip_mode,
+                           1e-8,          /* epsilon */
+                           1.2,           /* clip_coeff */
+                           bc_coeff_a,
+                           bc_coeff_b,
+                           var,
+                           grad);
+
+  for (int v_id = 0; v_id < _N_FIELDS; v_id++) {
+
+    cs_lnum_t n_diff = 0;
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (int k = 0; k < 3; k++) {
+        if (fabs(grad[v_id][c_id][k] - grad_ref[v_id][c_id][k]) > 0)
+          n_diff++;
+      }
+    }
+
+    if (n_diff > 0)
+      bft_error(__FILE__, __LINE__, 0,
+                "Gradient of %s (type %d, halo %d, clip %d, inc %d):\n"
+                "%ld values differ between multiple and single field\n"
+                "computations.",
+                name[v_id], (int)gradient_type, (int)halo_type,
+                (int)clip_mode, inc, (long)n_diff);
+
+    BFT_FREE(grad[v_id]);
+    BFT_FREE(grad_ref[v_id]);
+    BFT_FREE(_bc_coeff_b[v_id]);
+    BFT_FREE(_bc_coeff_a[v_id]);
+    BFT_FREE(var[v_id]);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compare scalar gradients computed using the cell-based gather of interior
+ * face contributions with those computed using the face-based scatter path,
+ * on the same mesh; results must be bit for bit identical.
+ *
+ * parameters:
+ *   inc          <-- if 0, solve on increment; 1 otherwise
+ *   use_c_weight <-- use cell weighting if true
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_gradient_scalar_gather(int   inc,
+                              bool  use_c_weight)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  cs_real_t *var, *c_weight = NULL, *bc_coeff_a, *bc_coeff_b;
+  cs_real_3_t *grad_ref, *grad;
+
+  BFT_MALLOC(var, n_cells_ext, cs_real_t);
+  BFT_MALLOC(bc_coeff_a, n_b_faces, cs_real_t);
+  BFT_MALLOC(bc_coeff_b, n_b_faces, cs_real_t);
+  BFT_MALLOC(grad_ref, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    const cs_real_t *x = cell_cen[c_id];
+    var[c_id] = sin(3.*x[0]) + x[1]*x[2] + 0.1*cos(17.*x[1]);
+  }
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    bc_coeff_a[f_id] = 0.1*sin(f_id);
+    bc_coeff_b[f_id] = 0.5;
+  }
+
+  if (use_c_weight) {
+    BFT_MALLOC(c_weight, n_cells_ext, cs_real_t);
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      c_weight[c_id] = 1. + 0.5*sin(7.*cell_cen[c_id][0]);
+  }
+
+  /* Save renumbering options, so as to switch the interior faces
+     algorithm (the mesh itself is not renumbered again) */
+
+  bool halo_adjacent_cells_last, halo_adjacent_faces_last;
+  cs_renumber_ordering_t i_faces_base_ordering;
+  cs_renumber_cells_type_t cells_pre_numbering, cells_numbering;
+  cs_renumber_i_faces_type_t i_faces_numbering;
+  cs_renumber_b_faces_type_t b_faces_numbering;
+  cs_renumber_vertices_type_t vertices_numbering;
+
+  cs_renumber_get_algorithm(&halo_adjacent_cells_last,
+                            &halo_adjacent_faces_last,
+                            &i_faces_base_ordering,
+                            &cells_pre_numbering,
+                            &cells_numbering,
+                            &i_faces_numbering,
+                            &b_faces_numbering,
+                            &vertices_numbering);
+
+  for (int gather = 0; gather < 2; gather++) {
+
+    cs_renumber_set_algorithm(halo_adjacent_cells_last,
+                              halo_adjacent_faces_last,
+                              i_faces_base_ordering,
+                              cells_pre_numbering,
+                              cells_numbering,
+                              (gather) ?
+                                CS_RENUMBER_I_FACES_GATHER : i_faces_numbering,
+                              b_faces_numbering,
+                              vertices_numbering);
+
+    cs_mesh_adjacencies_update_mesh();
+
+    if ((cs_mesh_adjacencies_gather_c2f(m) != NULL) != (gather == 1))
+      bft_error(__FILE__, __LINE__, 0,
+                "Cell-based gather adjacency %s.",
+                (gather) ? "not available" : "unexpectedly available");
+
+    cs_gradient_scalar("s_gather",
+                       CS_GRADIENT_GREEN_ITER,
+                       CS_HALO_STANDARD,
+                       inc,
+                       true,          /* recompute_cocg */
+                       100,           /* n_r_sweeps */
+                       0,             /* tr_dim */
+                       0,             /* hyd_p_flag */
+                       1,             /* w_stride */
+                       0,             /* verbosity */
+                       CS_GRADIENT_LIMIT_NONE,
+                       1e-8,          /* epsilon */
+                       1.5,           /* clip_coeff */
+                       NULL,          /* f_ext */
+                       bc_coeff_a,
+                       bc_coeff_b,
+                       var,
+                       c_weight,
+                       NULL,          /* cpl */
+                       (gather) ? grad : grad_ref);
+
+  }
+
+  cs_renumber_set_algorithm(halo_adjacent_cells_last,
+                            halo_adjacent_faces_last,
+                            i_faces_base_ordering,
+                            cells_pre_numbering,
+                            cells_numbering,
+                            i_faces_numbering,
+                            b_faces_numbering,
+                            vertices_numbering);
+
+  cs_mesh_adjacencies_update_mesh();
+
+  cs_lnum_t n_diff = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (int k = 0; k < 3; k++) {
+      if (fabs(grad[c_id][k] - grad_ref[c_id][k]) > 0)
+        n_diff++;
+    }
+  }
+
+  if (n_diff > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "Gradient (inc %d, cell weighting %d):\n"
+              "%ld values differ between cell-based gather and\n"
+              "face-based scatter computations.",
+              inc, (int)use_c_weight, (long)n_diff);
+
+  BFT_FREE(grad);
+  BFT_FREE(grad_ref);
+  BFT_FREE(c_weight);
+  BFT_FREE(bc_coeff_b);
+  BFT_FREE(bc_coeff_a);
+  BFT_FREE(var);
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Main program to check multiple field and cell-based gather
+ *          gradient computations
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+#if defined(HAVE_MPI)
+  MPI_Init(&argc, &argv);
+  cs_glob_mpi_comm = MPI_COMM_WORLD;
+  MPI_Comm_rank(cs_glob_mpi_comm, &cs_glob_rank_id);
+  MPI_Comm_size(cs_glob_mpi_comm, &cs_glob_n_ranks);
+  if (cs_glob_n_ranks < 2)
+    cs_glob_rank_id = -1;
+#else
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+#endif
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  _build_mesh();
+
+  cs_gradient_initialize();
+
+  for (int inc = 0; inc < 2; inc++) {
+    _check_gradient_scalar_multi(CS_GRADIENT_LSQ,
+                                 CS_HALO_STANDARD,
+                                 inc,
+                                 CS_GRADIENT_LIMIT_NONE);
+    _check_gradient_scalar_multi(CS_GRADIENT_LSQ,
+                                 CS_HALO_STANDARD,
+                                 inc,
+                                 CS_GRADIENT_LIMIT_CELL);
+    _check_gradient_scalar_multi(CS_GRADIENT_LSQ,
+                                 CS_HALO_EXTENDED,
+                                 inc,
+                                 CS_GRADIENT_LIMIT_FACE);
+  }
+
+  /* Fallback to single field computations */
+
+  _check_gradient_scalar_multi(CS_GRADIENT_GREEN_ITER,
+                               CS_HALO_STANDARD,
+                               1,
+                               CS_GRADIENT_LIMIT_CELL);
+
+  /* Cell-based gather of interior face contributions */
+
+  for (int inc = 0; inc < 2; inc++) {
+    _check_gradient_scalar_gather(inc, false);
+    _check_gradient_scalar_gather(inc, true);
+  }
+
+  cs_gradient_finalize();
+
+  cs_mesh_adjacencies_finalize();
+  cs_glob_mesh_quantities = cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  bft_mem_end();
+
+  if (cs_glob_rank_id < 1)
+    printf(" --> Multiple field and gather gradient tests (Done)\n");
+
+#if defined(HAVE_MPI)
+  MPI_Finalize();
+#endif
+
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,206 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_matrix.h"
+#include "cs_multigrid_smoother.h"
+#include "cs_sles_it.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _N_ROWS 200
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute the euclidean norm of the residual rhs - A.vx.
+ *
+ * parameters:
+ *   a   <-- matrix
+ *   rhs <-- right hand side
+ *   vx  <-- solution
+ *
+ * returns:
+ *   residual norm
+ *----------------------------------------------------------------------------*/
+
+static double
+_residual_norm(const cs_matrix_t  *a,
+               const cs_real_t    *rhs,
+               cs_real_t          *vx)
+{
+  cs_real_t r[_N_ROWS];
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a, vx, r);
+
+  double s = 0;
+  for (cs_lnum_t ii = 0; ii < _N_ROWS; ii++)
+    s += (rhs[ii] - r[ii])*(rhs[ii] - r[ii]);
+
+  return sqrt(s);
+}
+
+/*----------------------------------------------------------------------------
+ * Apply a smoother to a small SPD system (shifted 1D Laplacian), starting
+ * from a zero solution, and check that the residual is reduced.
+ *
+ * The work array is filled with non-finite values first, so as to check
+ * that the smoother does not depend on its initial contents.
+ *
+ * parameters:
+ *   smoother_type <-- type of smoother
+ *   n_iter        <-- number of smoothing iterations
+ *   max_ratio     <-- maximum final to initial residual ratio
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_smoother(cs_sles_it_type_t  smoother_type,
+                int                n_iter,
+                double             max_ratio)
+{
+  const cs_lnum_t n_edges = _N_ROWS - 1;
+
+  cs_lnum_2_t edges[_N_ROWS - 1];
+  cs_real_t da[_N_ROWS], xa[_N_ROWS - 1];
+  cs_real_t rhs[_N_ROWS], vx[_N_ROWS];
+
+  for (cs_lnum_t ii = 0; ii < n_edges; ii++) {
+    edges[ii][0] = ii;
+    edges[ii][1] = ii+1;
+    xa[ii] = -1.;
+  }
+
+  for (cs_lnum_t ii = 0; ii < _N_ROWS; ii++) {
+    da[ii] = 2.2 + 0.1*(ii%3);
+    rhs[ii] = sin(0.3*ii) + 0.5*((ii%2) ? 1. : -1.);
+    vx[ii] = 0.;
+  }
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_MSR,
+                                 true,
+                                 _N_ROWS,
+                                 _N_ROWS,
+                                 n_edges,
+                                 (const cs_lnum_2_t *)edges,
+                                 NULL,
+                                 NULL);
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a, true, NULL, NULL,
+                             n_edges, (const cs_lnum_2_t *)edges,
+                             da, xa);
+
+  double r_0 = _residual_norm(a, rhs, vx);
+
+  const size_t aux_size = 4*_N_ROWS*sizeof(cs_real_t) + 256;
+  cs_real_t *aux_vectors;
+  BFT_MALLOC(aux_vectors, aux_size/sizeof(cs_real_t), cs_real_t);
+
+  for (size_t ii = 0; ii < aux_size/sizeof(cs_real_t); ii++)
+    aux_vectors[ii] = NAN;
+
+  cs_sles_it_t *c = cs_multigrid_smoother_create(smoother_type, 0, n_iter);
+
+  const char *name = cs_sles_it_type_name[smoother_type];
+
+  int n_iter_done = 0;
+  double residue = 0;
+
+  cs_multigrid_smoother_setup(c, name, a, 0);
+  cs_multigrid_smoother_solve(c, name, a, 0, CS_HALO_ROTATION_COPY,
+                              1e-12, r_0, &n_iter_done, &residue,
+                              rhs, vx, aux_size, aux_vectors);
+
+  double r_1 = _residual_norm(a, rhs, vx);
+
+  void *_c = c;
+  cs_sles_it_destroy(&_c);
+
+  BFT_FREE(aux_vectors);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  printf(" %s smoother: residual %12.5e -> %12.5e (%d iterations)\n",
+         name, r_0, r_1, n_iter_done);
+
+  if (!(r_1 <= max_ratio*r_0))
+    bft_error(__FILE__, __LINE__, 0,
+              "%s smoother: residual %g not reduced below %g x %g.",
+              name, r_1, max_ratio, r_0);
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Main program to check multigrid smoothers
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  _check_smoother(CS_SLES_JACOBI, 10, 0.5);
+  _check_smoother(CS_SLES_CHEBYSHEV, 10, 0.1);
+
+  bft_mem_end();
+
+  printf(" --> Multigrid smoother tests (Done)\n");
+
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,474 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_gradient.h"
+#include "cs_halo.h"
+#include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_cartesian.h"
+#include "cs_mesh_quantities.h"
+#include "cs_numbering.h"
+#include "cs_preprocessor_data.h"
+#include "cs_renumber.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _TILE_CACHE_SIZE  16384
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build a cartesian mesh and associated quantities, using given interior
+ * face ordering options.
+ *
+ * parameters:
+ *   halo_adjacent_faces_last <-- place faces adjacent to ghost cells last
+ *   i_faces_base_ordering    <-- pre-ordering of interior faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(bool                    halo_adjacent_faces_last,
+            cs_renumber_ordering_t  i_faces_base_ordering)
+{
+  int n_cells[3] = {16, 14, 12};
+  cs_real_t xyz[6] = {0., 0., 0., 1.2, 1., 0.8};
+
+  cs_renumber_set_algorithm(false,
+                            halo_adjacent_faces_last,
+                            i_faces_base_ordering,
+                            CS_RENUMBER_CELLS_NONE,
+                            CS_RENUMBER_CELLS_NONE,
+                            CS_RENUMBER_I_FACES_NONE,
+                            CS_RENUMBER_B_FACES_NONE,
+                            CS_RENUMBER_VERTICES_NONE);
+
+  cs_mesh_cartesian_create();
+  cs_mesh_cartesian_define_simple(n_cells, xyz);
+
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh_builder = cs_mesh_builder_create();
+
+  cs_mesh_t *m = cs_glob_mesh;
+
+  cs_preprocessor_data_read_headers(m, cs_glob_mesh_builder);
+  cs_preprocessor_data_read_mesh(m, cs_glob_mesh_builder);
+  cs_mesh_init_halo(m, cs_glob_mesh_builder, CS_HALO_STANDARD);
+  cs_mesh_update_auxiliary(m);
+
+  cs_renumber_mesh(m);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+  cs_mesh_cartesian_params_destroy();
+
+  /* Distort mesh so that gradients are non-trivial */
+
+  for (cs_lnum_t i = 0; i < m->n_vertices; i++) {
+    cs_real_t *x = m->vtx_coord + i*3;
+    cs_real_t s = sin(23.*x[0] + 31.*x[1] + 37.*x[2]);
+    for (int k = 0; k < 3; k++)
+      x[k] += 0.01*s*(k+1);
+  }
+
+  cs_glob_mesh_quantities = cs_mesh_quantities_create();
+  cs_mesh_quantities_compute(m, cs_glob_mesh_quantities);
+
+  cs_mesh_adjacencies_initialize();
+  cs_mesh_adjacencies_update_mesh();
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy the mesh and associated structures.
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_mesh(void)
+{
+  cs_mesh_adjacencies_finalize();
+  cs_glob_mesh_quantities = cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+}
+
+/*----------------------------------------------------------------------------
+ * Check that a tile index covers a given number of elements.
+ *
+ * parameters:
+ *   name      <-- name of numbering (for error messages)
+ *   numbering <-- numbering structure
+ *   n_tiles   <-- expected number of tiles
+ *   n_elts    <-- number of elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_tile_index(const char            *name,
+                  const cs_numbering_t  *numbering,
+                  int                    n_tiles,
+                  cs_lnum_t              n_elts)
+{
+  if (numbering->n_tiles != n_tiles || numbering->tile_index == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s numbering: %d tiles instead of %d.",
+              name, numbering->n_tiles, n_tiles);
+
+  const cs_lnum_t *tile_index = numbering->tile_index;
+
+  if (tile_index[0] != 0 || tile_index[n_tiles] != n_elts)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s numbering: tile index range [%ld, %ld] instead of [0, %ld].",
+              name, (long)tile_index[0], (long)tile_index[n_tiles],
+              (long)n_elts);
+
+  for (int t_id = 0; t_id < n_tiles; t_id++) {
+    if (tile_index[t_id+1] < tile_index[t_id])
+      bft_error(__FILE__, __LINE__, 0,
+                "%s numbering: tile index decreasing for tile %d.",
+                name, t_id);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check the consistency of cell, interior face and boundary face tiles:
+ * each face must belong to the tile of its lowest adjacent cell.
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_tiles(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const int n_tiles = m->cell_numbering->n_tiles;
+
+  int n_tiles_min = n_tiles;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(&n_tiles, &n_tiles_min, 1, MPI_INT, MPI_MIN,
+                  cs_glob_mpi_comm);
+#endif
+
+  if (n_tiles_min < 2)
+    bft_error(__FILE__, __LINE__, 0,
+              "Mesh cells should be split in several tiles.");
+
+  _check_tile_index("cells", m->cell_numbering, n_tiles, m->n_cells);
+  _check_tile_index("interior faces", m->i_face_numbering, n_tiles,
+                    m->n_i_faces);
+  _check_tile_index("boundary faces", m->b_face_numbering, n_tiles,
+                    m->n_b_faces);
+
+  const cs_lnum_t *c_tile_index = m->cell_numbering->tile_index;
+  const cs_lnum_t *i_tile_index = m->i_face_numbering->tile_index;
+  const cs_lnum_t *b_tile_index = m->b_face_numbering->tile_index;
+
+  cs_lnum_t n_errors = 0;
+
+  for (int t_id = 0; t_id < n_tiles; t_id++) {
+
+    for (cs_lnum_t f_id = i_tile_index[t_id];
+         f_id < i_tile_index[t_id+1];
+         f_id++) {
+      cs_lnum_t c_id = CS_MIN(m->i_face_cells[f_id][0],
+                              m->i_face_cells[f_id][1]);
+      if (c_id < c_tile_index[t_id] || c_id >= c_tile_index[t_id+1])
+        n_errors++;
+    }
+
+    for (cs_lnum_t f_id = b_tile_index[t_id];
+         f_id < b_tile_index[t_id+1];
+         f_id++) {
+      cs_lnum_t c_id = m->b_face_cells[f_id];
+      if (c_id < c_tile_index[t_id] || c_id >= c_tile_index[t_id+1])
+        n_errors++;
+    }
+
+  }
+
+  if (n_errors > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "%ld faces do not belong to the tile of their lowest cell.",
+              (long)n_errors);
+}
+
+/*----------------------------------------------------------------------------
+ * Compare scalar gradients computed with loops fused by tiles with those
+ * computed with tiles disabled; results must be bit for bit identical.
+ *
+ * parameters:
+ *   inc          <-- if 0, solve on increment; 1 otherwise
+ *   use_c_weight <-- use cell weighting if true
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_gradient_tiles(int   inc,
+                      bool  use_c_weight)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  cs_real_t *var, *c_weight = NULL, *bc_coeff_a, *bc_coeff_b;
+  cs_real_3_t *grad_ref, *grad;
+
+  BFT_MALLOC(var, n_cells_ext, cs_real_t);
+  BFT_MALLOC(bc_coeff_a, n_b_faces, cs_real_t);
+  BFT_MALLOC(bc_coeff_b, n_b_faces, cs_real_t);
+  BFT_MALLOC(grad_ref, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    const cs_real_t *x = cell_cen[c_id];
+    var[c_id] = sin(3.*x[0]) + x[1]*x[2] + 0.1*cos(17.*x[1]);
+  }
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    bc_coeff_a[f_id] = 0.1*sin(f_id);
+    bc_coeff_b[f_id] = 0.5;
+  }
+
+  if (use_c_weight) {
+    BFT_MALLOC(c_weight, n_cells_ext, cs_real_t);
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      c_weight[c_id] = 1. + 0.5*sin(7.*cell_cen[c_id][0]);
+  }
+
+  /* Save cell tiles, so as to disable them for the reference computation
+     (loops are fused only when cells and faces have the same tiles) */
+
+  const int n_tiles = m->cell_numbering->n_tiles;
+  cs_lnum_t *c_tile_index;
+  BFT_MALLOC(c_tile_index, n_tiles + 1, cs_lnum_t);
+  memcpy(c_tile_index,
+         m->cell_numbering->tile_index,
+         (n_tiles + 1)*sizeof(cs_lnum_t));
+
+  for (int tiled = 1; tiled > -1; tiled--) {
+
+    if (tiled)
+      cs_numbering_set_tiles(m->cell_numbering, n_tiles, c_tile_index);
+    else
+      cs_numbering_set_tiles(m->cell_numbering, 0, NULL);
+
+    cs_gradient_scalar("s_tiles",
+                       CS_GRADIENT_GREEN_ITER,
+                       CS_HALO_STANDARD,
+                       inc,
+                       true,          /* recompute_cocg */
+                       100,           /* n_r_sweeps */
+                       0,             /* tr_dim */
+                       0,             /* hyd_p_flag */
+                       1,             /* w_stride */
+                       0,             /* verbosity */
+                       CS_GRADIENT_LIMIT_NONE,
+                       1e-8,          /* epsilon */
+                       1.5,           /* clip_coeff */
+                       NULL,          /* f_ext */
+                       bc_coeff_a,
+                       bc_coeff_b,
+                       var,
+                       c_weight,
+                       NULL,          /* cpl */
+                       (tiled) ? grad : grad_ref);
+
+  }
+
+  cs_numbering_set_tiles(m->cell_numbering, n_tiles, c_tile_index);
+  BFT_FREE(c_tile_index);
+
+  cs_lnum_t n_diff = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (int k = 0; k < 3; k++) {
+      if (fabs(grad[c_id][k] - grad_ref[c_id][k]) > 0)
+        n_diff++;
+    }
+  }
+
+  if (n_diff > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "Gradient (inc %d, cell weighting %d):\n"
+              "%ld values differ between tiled and non-tiled computations.",
+              inc, (int)use_c_weight, (long)n_diff);
+
+  BFT_FREE(grad);
+  BFT_FREE(grad_ref);
+  BFT_FREE(c_weight);
+  BFT_FREE(bc_coeff_b);
+  BFT_FREE(bc_coeff_a);
+  BFT_FREE(var);
+}
+
+/*----------------------------------------------------------------------------
+ * Check that interior faces are not tiled, and that their base ordering
+ * is preserved, when placed by highest adjacent cell id first or with
+ * faces adjacent to ghost cells last.
+ *
+ * parameters:
+ *   halo_adjacent_faces_last <-- faces adjacent to ghost cells are last
+ *   i_faces_base_ordering    <-- pre-ordering of interior faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_i_faces_ordering(bool                    halo_adjacent_faces_last,
+                        cs_renumber_ordering_t  i_faces_base_ordering)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+
+  if (m->i_face_numbering->n_tiles != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "Interior faces should not be tiled with this ordering.");
+
+  cs_lnum_t n_errors = 0;
+  cs_lnum_t c_id_max_prev = -1;
+  bool halo_adj_seen = false;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+
+    cs_lnum_t c_id_0 = m->i_face_cells[f_id][0];
+    cs_lnum_t c_id_1 = m->i_face_cells[f_id][1];
+    bool halo_adj = (c_id_0 >= n_cells || c_id_1 >= n_cells);
+
+    if (halo_adjacent_faces_last) {
+      if (halo_adj_seen && !halo_adj)
+        n_errors++;
+      halo_adj_seen = halo_adj_seen || halo_adj;
+    }
+
+    /* Faces adjacent to ghost cells are sorted by ghost cell id */
+
+    if (i_faces_base_ordering == CS_RENUMBER_ADJACENT_HIGH && !halo_adj) {
+      cs_lnum_t c_id_max = CS_MAX(c_id_0, c_id_1);
+      if (c_id_max < c_id_max_prev)
+        n_errors++;
+      c_id_max_prev = c_id_max;
+    }
+
+  }
+
+  if (n_errors > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "%ld interior faces do not follow the requested ordering.",
+              (long)n_errors);
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Main program to check cache blocking tiles in mesh renumbering
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+#if defined(HAVE_MPI)
+  MPI_Init(&argc, &argv);
+  cs_glob_mpi_comm = MPI_COMM_WORLD;
+  MPI_Comm_rank(cs_glob_mpi_comm, &cs_glob_rank_id);
+  MPI_Comm_size(cs_glob_mpi_comm, &cs_glob_n_ranks);
+  if (cs_glob_n_ranks < 2)
+    cs_glob_rank_id = -1;
+#else
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  cs_gradient_initialize();
+
+  cs_renumber_set_tile_cache_size(_TILE_CACHE_SIZE);
+
+  /* Tiles with default (lowest adjacent cell id first) ordering */
+
+  _build_mesh(false, CS_RENUMBER_ADJACENT_LOW);
+
+  _check_tiles();
+
+  for (int inc = 0; inc < 2; inc++) {
+    _check_gradient_tiles(inc, false);
+    _check_gradient_tiles(inc, true);
+  }
+
+  _destroy_mesh();
+
+  /* Orderings which are not compatible with interior face tiles */
+
+  _build_mesh(true, CS_RENUMBER_ADJACENT_LOW);
+  _check_i_faces_ordering(true, CS_RENUMBER_ADJACENT_LOW);
+  _destroy_mesh();
+
+  _build_mesh(false, CS_RENUMBER_ADJACENT_HIGH);
+  _check_i_faces_ordering(false, CS_RENUMBER_ADJACENT_HIGH);
+  _destroy_mesh();
+
+  cs_gradient_finalize();
+
+  bft_mem_end();
+
+  if (cs_glob_rank_id < 1)
+    printf(" --> Mesh renumbering tiles tests (Done)\n");
+
+#if defined(HAVE_MPI)
+  MPI_Finalize();
+#endif
+
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
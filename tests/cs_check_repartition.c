@@ -0,0 +1,397 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_boundary_zone.h"
+#include "cs_field.h"
+#include "cs_halo.h"
+#include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_cartesian.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_parall.h"
+#include "cs_preprocess.h"
+#include "cs_preprocessor_data.h"
+#include "cs_volume_zone.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Reference value associated with a global element number.
+ *
+ * parameters:
+ *   g_num <-- global element number
+ *   k     <-- component id
+ *   set   <-- value set id
+ *
+ * returns:
+ *   reference value
+ *----------------------------------------------------------------------------*/
+
+static double
+_ref_value(cs_gnum_t  g_num,
+           int        k,
+           int        set)
+{
+  return sin(0.37*g_num + k) + 10*k + 100*set;
+}
+
+/*----------------------------------------------------------------------------
+ * Global number of an element (global numbers are not defined in serial
+ * mode).
+ *
+ * parameters:
+ *   global_num <-- global element numbers, or NULL
+ *   elt_id     <-- local element id
+ *
+ * returns:
+ *   global element number
+ *----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_g_num(const cs_gnum_t  global_num[],
+       cs_lnum_t        elt_id)
+{
+  return (global_num != NULL) ? global_num[elt_id] : (cs_gnum_t)elt_id + 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Reference value associated with a point (such as a cell center).
+ *
+ * parameters:
+ *   x <-- point coordinates
+ *   k <-- component id
+ *
+ * returns:
+ *   reference value
+ *----------------------------------------------------------------------------*/
+
+static double
+_ref_value_x(const cs_real_t  x[3],
+             int              k)
+{
+  return 3*x[k] + x[(k+1)%3];
+}
+
+/*----------------------------------------------------------------------------
+ * Cell cost weights, higher in part of the domain.
+ *
+ * parameters:
+ *   cell_weight --> cell weights
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_weights(cs_real_t  cell_weight[])
+{
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  for (cs_lnum_t c_id = 0; c_id < cs_glob_mesh->n_cells; c_id++)
+    cell_weight[c_id] = (cell_cen[c_id][0] < 0.3) ? 10 : 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Define fields on cells, interior faces and vertices, and set their values
+ * so that they may be checked after repartitioning.
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_fields(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  cs_field_define_keys_base();
+
+  cs_field_t *f_c = cs_field_create("c_val",
+                                    CS_FIELD_VARIABLE,
+                                    CS_MESH_LOCATION_CELLS,
+                                    3,
+                                    true);
+  cs_field_set_key_int(f_c, cs_field_key_id("coupled"), 1);
+  cs_field_allocate_values(f_c);
+  cs_field_allocate_bc_coeffs(f_c, false, false, false, false);
+
+  cs_field_t *f_i = cs_field_create("i_val",
+                                    0,
+                                    CS_MESH_LOCATION_INTERIOR_FACES,
+                                    1,
+                                    false);
+  cs_field_allocate_values(f_i);
+
+  cs_field_t *f_v = cs_field_create("v_val",
+                                    0,
+                                    CS_MESH_LOCATION_VERTICES,
+                                    1,
+                                    false);
+  cs_field_allocate_values(f_v);
+
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+  const cs_real_3_t *i_face_cog = (const cs_real_3_t *)mq->i_face_cog;
+
+  for (cs_lnum_t c_id = 0; c_id < m->n_cells_with_ghosts; c_id++) {
+    for (int k = 0; k < 3; k++) {
+      f_c->val[c_id*3 + k] = _ref_value_x(cell_cen[c_id], k);
+      f_c->val_pre[c_id*3 + k] = f_c->val[c_id*3 + k] + 1;
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+    cs_gnum_t g_num = _g_num(m->global_b_face_num, f_id);
+    for (int k = 0; k < 3; k++)
+      f_c->bc_coeffs->a[f_id*3 + k] = _ref_value(g_num, k, 0);
+    for (int k = 0; k < 9; k++)
+      f_c->bc_coeffs->b[f_id*9 + k] = _ref_value(g_num, k, 1);
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++)
+    f_i->val[f_id] = _ref_value_x(i_face_cog[f_id], 0);
+
+  for (cs_lnum_t v_id = 0; v_id < m->n_vertices; v_id++)
+    f_v->val[v_id] = _ref_value(_g_num(m->global_vtx_num, v_id), 0, 2);
+}
+
+/*----------------------------------------------------------------------------
+ * Check field values relative to the current partition.
+ *
+ * parameters:
+ *   stage <-- name of checked stage, for messages
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_fields(const char  *stage)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+  const cs_real_3_t *i_face_cog = (const cs_real_3_t *)mq->i_face_cog;
+
+  const cs_field_t *f_c = cs_field_by_name("c_val");
+  const cs_field_t *f_i = cs_field_by_name("i_val");
+  const cs_field_t *f_v = cs_field_by_name("v_val");
+
+  cs_gnum_t n_errors = 0;
+
+  /* Cell values are checked on ghost cells also */
+
+  for (cs_lnum_t c_id = 0; c_id < m->n_cells_with_ghosts; c_id++) {
+    for (int k = 0; k < 3; k++) {
+      double v_ref = _ref_value_x(cell_cen[c_id], k);
+      if (fabs(f_c->val[c_id*3 + k] - v_ref) > 1e-10)
+        n_errors++;
+      if (fabs(f_c->val_pre[c_id*3 + k] - (v_ref + 1)) > 1e-10)
+        n_errors++;
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+    cs_gnum_t g_num = _g_num(m->global_b_face_num, f_id);
+    for (int k = 0; k < 3; k++) {
+      if (fabs(f_c->bc_coeffs->a[f_id*3 + k] - _ref_value(g_num, k, 0)) > 0)
+        n_errors++;
+    }
+    for (int k = 0; k < 9; k++) {
+      if (fabs(f_c->bc_coeffs->b[f_id*9 + k] - _ref_value(g_num, k, 1)) > 0)
+        n_errors++;
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    if (fabs(f_i->val[f_id] - _ref_value_x(i_face_cog[f_id], 0)) > 1e-10)
+      n_errors++;
+  }
+
+  for (cs_lnum_t v_id = 0; v_id < m->n_vertices; v_id++) {
+    cs_gnum_t g_num = _g_num(m->global_vtx_num, v_id);
+    if (fabs(f_v->val[v_id] - _ref_value(g_num, 0, 2)) > 0)
+      n_errors++;
+  }
+
+  cs_parall_counter(&n_errors, 1);
+
+  if (n_errors > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: %llu field values not migrated correctly.",
+              stage, (unsigned long long)n_errors);
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Main program to check mesh repartitioning with field migration
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+#if defined(HAVE_MPI)
+  MPI_Init(&argc, &argv);
+  cs_glob_mpi_comm = MPI_COMM_WORLD;
+  MPI_Comm_rank(cs_glob_mpi_comm, &cs_glob_rank_id);
+  MPI_Comm_size(cs_glob_mpi_comm, &cs_glob_n_ranks);
+  if (cs_glob_n_ranks < 2)
+    cs_glob_rank_id = -1;
+#else
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  /* Build a cartesian mesh */
+
+  int n_cells[3] = {24, 20, 16};
+  cs_real_t xyz[6] = {0., 0., 0., 1.2, 1., 0.8};
+
+  cs_mesh_cartesian_create();
+  cs_mesh_cartesian_define_simple(n_cells, xyz);
+
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh_builder = cs_mesh_builder_create();
+  cs_glob_mesh_quantities = cs_mesh_quantities_create();
+
+  cs_mesh_t *m = cs_glob_mesh;
+
+  cs_preprocessor_data_read_headers(m, cs_glob_mesh_builder);
+  cs_preprocessor_data_read_mesh(m, cs_glob_mesh_builder);
+  cs_mesh_init_halo(m, cs_glob_mesh_builder, CS_HALO_EXTENDED);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+  cs_mesh_cartesian_params_destroy();
+
+  cs_mesh_init_group_classes(m);
+  cs_mesh_quantities_compute(m, cs_glob_mesh_quantities);
+
+  cs_mesh_init_selectors();
+  cs_mesh_location_initialize();
+  cs_volume_zone_initialize();
+  cs_boundary_zone_initialize();
+  cs_mesh_location_build(m, -1);
+  cs_volume_zone_build_all(true);
+  cs_boundary_zone_build_all(true);
+
+  cs_mesh_adjacencies_initialize();
+  cs_mesh_adjacencies_update_mesh();
+
+  _define_fields();
+  _check_fields("Initial partition");
+
+  /* Repartition with non-uniform weights */
+
+  cs_real_t *cell_weight;
+
+  BFT_MALLOC(cell_weight, m->n_cells, cs_real_t);
+  _cell_weights(cell_weight);
+
+  double imbalance_0 = cs_preprocess_mesh_imbalance(cell_weight);
+
+  cs_preprocess_mesh_repartition(cell_weight);
+
+  BFT_REALLOC(cell_weight, m->n_cells, cs_real_t);
+  _cell_weights(cell_weight);
+
+  double imbalance_1 = cs_preprocess_mesh_imbalance(cell_weight);
+
+  BFT_FREE(cell_weight);
+
+  _check_fields("Weighted repartitioning");
+
+  if (cs_glob_n_ranks > 1 && imbalance_1 > 1.1)
+    bft_error(__FILE__, __LINE__, 0,
+              "Weighted load imbalance %g after repartitioning (%g before).",
+              imbalance_1, imbalance_0);
+
+  /* Repartition back with uniform weights */
+
+  cs_preprocess_mesh_repartition(NULL);
+
+  _check_fields("Uniform repartitioning");
+
+  double imbalance_2 = cs_preprocess_mesh_imbalance(NULL);
+
+  if (imbalance_2 > 1.1)
+    bft_error(__FILE__, __LINE__, 0,
+              "Cell count imbalance %g after uniform repartitioning.",
+              imbalance_2);
+
+  /* Cleanup */
+
+  cs_field_destroy_all();
+  cs_field_destroy_all_keys();
+
+  cs_mesh_adjacencies_finalize();
+  cs_boundary_zone_finalize();
+  cs_volume_zone_finalize();
+  cs_mesh_location_finalize();
+
+  cs_glob_mesh_quantities = cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  bft_mem_end();
+
+  if (cs_glob_rank_id < 1)
+    printf(" --> Mesh repartitioning tests (Done)\n");
+
+#if defined(HAVE_MPI)
+  MPI_Finalize();
+#endif
+
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
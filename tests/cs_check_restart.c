@@ -0,0 +1,343 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_io.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_cartesian.h"
+#include "cs_mesh_location.h"
+#include "cs_preprocessor_data.h"
+#include "cs_restart.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _N_CHECKPOINTS 3
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build a cartesian mesh.
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(void)
+{
+  int n_cells[3] = {6, 5, 4};
+  cs_real_t xyz[6] = {0., 0., 0., 1., 1., 1.};
+
+  cs_mesh_cartesian_create();
+  cs_mesh_cartesian_define_simple(n_cells, xyz);
+
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh_builder = cs_mesh_builder_create();
+
+  cs_mesh_t *m = cs_glob_mesh;
+
+  cs_preprocessor_data_read_headers(m, cs_glob_mesh_builder);
+  cs_preprocessor_data_read_mesh(m, cs_glob_mesh_builder);
+  cs_mesh_init_halo(m, cs_glob_mesh_builder, CS_HALO_STANDARD);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+}
+
+/*----------------------------------------------------------------------------
+ * Define values for a given checkpoint.
+ *
+ * Values of "s_var" change with each checkpoint, while values of
+ * "s_const" do not, so they are only written to full checkpoints.
+ *
+ * parameters:
+ *   ckpt_id <-- checkpoint id
+ *   s_var   --> values of changing section
+ *   s_const --> values of constant section
+ *----------------------------------------------------------------------------*/
+
+static void
+_checkpoint_values(int         ckpt_id,
+                   cs_real_t  *s_var,
+                   cs_real_t  *s_const)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
+    cs_gnum_t g_id = (m->global_cell_num != NULL) ?
+      m->global_cell_num[c_id] - 1 : (cs_gnum_t)c_id;
+    s_var[c_id] = 0.5*g_id + 100.*ckpt_id;
+    s_const[c_id] = 2.*g_id + 1.;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a section is present in a checkpoint file itself
+ * (i.e. not accounting for the base checkpoint of a delta checkpoint).
+ *
+ * parameters:
+ *   path     <-- checkpoint directory
+ *   sec_name <-- section name
+ *
+ * returns:
+ *   true if the section is present in the file's index
+ *----------------------------------------------------------------------------*/
+
+static bool
+_file_has_section(const char  *path,
+                  const char  *sec_name)
+{
+  bool retval = false;
+
+  char file_name[128];
+  snprintf(file_name, 127, "%s/main.csc", path);
+  file_name[127] = '\0';
+
+#if defined(HAVE_MPI)
+  cs_io_t *inp = cs_io_initialize_with_index(file_name,
+                                             "Checkpoint / restart, R0",
+                                             CS_FILE_STDIO_SERIAL,
+                                             CS_IO_ECHO_NONE,
+                                             MPI_INFO_NULL,
+                                             cs_glob_mpi_comm,
+                                             cs_glob_mpi_comm);
+#else
+  cs_io_t *inp = cs_io_initialize_with_index(file_name,
+                                             "Checkpoint / restart, R0",
+                                             CS_FILE_STDIO_SERIAL,
+                                             CS_IO_ECHO_NONE);
+#endif
+
+  size_t index_size = cs_io_get_index_size(inp);
+  for (size_t rec_id = 0; rec_id < index_size; rec_id++) {
+    if (strcmp(cs_io_get_indexed_sec_name(inp, rec_id), sec_name) == 0)
+      retval = true;
+  }
+
+  cs_io_finalize(&inp);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a checkpoint and check its values.
+ *
+ * For a delta checkpoint, the constant section must not be present in the
+ * checkpoint file itself, but be read from the base checkpoint.
+ *
+ * parameters:
+ *   path    <-- checkpoint directory
+ *   ckpt_id <-- expected checkpoint id
+ *   delta   <-- true if the checkpoint is expected to be a delta checkpoint
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_checkpoint(const char  *path,
+                  int          ckpt_id,
+                  bool         delta)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  /* Check file contents */
+
+  if (_file_has_section(path, "checkpoint:base") != delta)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s/main.csc: expected a %s checkpoint.",
+              path, (delta) ? "delta" : "full");
+
+  if (_file_has_section(path, "s_const") == delta)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s/main.csc: section \"s_const\" %s.",
+              path, (delta) ? "should not be written" : "missing");
+
+  if (_file_has_section(path, "s_var") == false)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s/main.csc: section \"s_var\" missing.", path);
+
+  cs_real_t *s_var, *s_const, *s_var_ref, *s_const_ref;
+  BFT_MALLOC(s_var, n_cells, cs_real_t);
+  BFT_MALLOC(s_const, n_cells, cs_real_t);
+  BFT_MALLOC(s_var_ref, n_cells, cs_real_t);
+  BFT_MALLOC(s_const_ref, n_cells, cs_real_t);
+
+  _checkpoint_values(ckpt_id, s_var_ref, s_const_ref);
+
+  cs_restart_t *r = cs_restart_create("main.csc", path, CS_RESTART_MODE_READ);
+
+  /* Sections absent from a delta checkpoint are resolved from its base */
+
+  if (cs_restart_check_section(r, "s_const", CS_MESH_LOCATION_CELLS,
+                               1, CS_TYPE_cs_real_t) != CS_RESTART_SUCCESS)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s/main.csc: section \"s_const\" not found.", path);
+
+  int retval[2];
+  retval[0] = cs_restart_read_section(r, "s_var", CS_MESH_LOCATION_CELLS,
+                                      1, CS_TYPE_cs_real_t, s_var);
+  retval[1] = cs_restart_read_section(r, "s_const", CS_MESH_LOCATION_CELLS,
+                                      1, CS_TYPE_cs_real_t, s_const);
+
+  cs_restart_destroy(&r);
+
+  if (retval[0] != CS_RESTART_SUCCESS || retval[1] != CS_RESTART_SUCCESS)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s/main.csc: error reading sections (%d, %d).",
+              path, retval[0], retval[1]);
+
+  cs_lnum_t n_diff = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (   fabs(s_var[c_id] - s_var_ref[c_id]) > 0
+        || fabs(s_const[c_id] - s_const_ref[c_id]) > 0)
+      n_diff++;
+  }
+
+  if (n_diff > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s/main.csc: %ld values differ from checkpoint %d.",
+              path, (long)n_diff, ckpt_id);
+
+  BFT_FREE(s_const_ref);
+  BFT_FREE(s_var_ref);
+  BFT_FREE(s_const);
+  BFT_FREE(s_var);
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Main program to check incremental checkpoint/restart
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+#if defined(HAVE_MPI)
+  MPI_Init(&argc, &argv);
+  cs_glob_mpi_comm = MPI_COMM_WORLD;
+  MPI_Comm_rank(cs_glob_mpi_comm, &cs_glob_rank_id);
+  MPI_Comm_size(cs_glob_mpi_comm, &cs_glob_n_ranks);
+  if (cs_glob_n_ranks < 2)
+    cs_glob_rank_id = -1;
+#else
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  _build_mesh();
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  cs_real_t *s_var, *s_const;
+  BFT_MALLOC(s_var, n_cells, cs_real_t);
+  BFT_MALLOC(s_const, n_cells, cs_real_t);
+
+  /* Write a full checkpoint followed by delta checkpoints;
+     previous checkpoints are moved to "previous_dump_<n>" */
+
+  cs_restart_checkpoint_set_incremental(_N_CHECKPOINTS);
+  cs_restart_set_n_max_checkpoints(_N_CHECKPOINTS);
+
+  for (int ckpt_id = 0; ckpt_id < _N_CHECKPOINTS; ckpt_id++) {
+
+    _checkpoint_values(ckpt_id, s_var, s_const);
+
+    cs_restart_t *r = cs_restart_create("main.csc", NULL,
+                                        CS_RESTART_MODE_WRITE);
+
+    cs_restart_write_section(r, "s_var", CS_MESH_LOCATION_CELLS,
+                             1, CS_TYPE_cs_real_t, s_var);
+    cs_restart_write_section(r, "s_const", CS_MESH_LOCATION_CELLS,
+                             1, CS_TYPE_cs_real_t, s_const);
+
+    cs_restart_destroy(&r);
+
+  }
+
+  cs_restart_checkpoint_wait();
+
+  BFT_FREE(s_const);
+  BFT_FREE(s_var);
+
+  /* Restart from the last (delta) checkpoint, and from moved ones;
+     only the first one is a full checkpoint */
+
+  _check_checkpoint("checkpoint", _N_CHECKPOINTS - 1, true);
+
+  for (int ckpt_id = 0; ckpt_id < _N_CHECKPOINTS - 1; ckpt_id++) {
+    char path[64];
+    snprintf(path, 63, "checkpoint/previous_dump_%04d", ckpt_id);
+    path[63] = '\0';
+    _check_checkpoint(path, ckpt_id, (ckpt_id > 0));
+  }
+
+  cs_restart_multiwriters_destroy_all();
+
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  bft_mem_end();
+
+  if (cs_glob_rank_id < 1)
+    printf(" --> Incremental checkpoint tests (Done)\n");
+
+#if defined(HAVE_MPI)
+  MPI_Finalize();
+#endif
+
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
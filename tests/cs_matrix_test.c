@@ -520,6 +520,212 @@ _free_base_data(void)
   BFT_FREE(_edges);
 }
 
+/*----------------------------------------------------------------------------
+ * Check a matrix.vector product result against a reference.
+ *
+ * parameters:
+ *   name   <-- name of tested variant, for messages
+ *   n_rows <-- number of local rows
+ *   y_ref  <-- reference result
+ *   y      <-- result to check
+ *   rtol   <-- tolerance, relative to the maximum reference value
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_spmv(const char       *name,
+            cs_lnum_t         n_rows,
+            const cs_real_t   y_ref[],
+            const cs_real_t   y[],
+            double            rtol)
+{
+  double d_max = 0, y_max = 0;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    d_max = CS_MAX(d_max, fabs(y[i] - y_ref[i]));
+    y_max = CS_MAX(y_max, fabs(y_ref[i]));
+  }
+
+  if (d_max > rtol*y_max)
+    bft_error(__FILE__, __LINE__, 0,
+              "SpMV check failed for %s:\n"
+              "  max. difference %g > %g * max. reference value %g",
+              name, d_max, rtol, y_max);
+}
+
+/*----------------------------------------------------------------------------
+ * Check row values returned by cs_matrix_get_row against a reference.
+ *
+ * Rows are compared through their value sums, so that the position
+ * of the diagonal in the row does not matter.
+ *
+ * parameters:
+ *   name   <-- name of tested variant, for messages
+ *   m_ref  <-- reference matrix
+ *   m      <-- matrix to check
+ *   rtol   <-- relative tolerance
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_rows(const char         *name,
+            const cs_matrix_t  *m_ref,
+            const cs_matrix_t  *m,
+            double              rtol)
+{
+  cs_matrix_row_info_t r_ref, r;
+
+  cs_matrix_row_init(&r_ref);
+  cs_matrix_row_init(&r);
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(m);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_matrix_get_row(m_ref, i, &r_ref);
+    cs_matrix_get_row(m, i, &r);
+    double s_ref = 0, s = 0, a_ref = 0;
+    for (cs_lnum_t j = 0; j < r_ref.row_size; j++) {
+      s_ref += r_ref.vals[j];
+      a_ref += fabs(r_ref.vals[j]);
+    }
+    for (cs_lnum_t j = 0; j < r.row_size; j++)
+      s += r.vals[j];
+    if (fabs(s - s_ref) > rtol*a_ref)
+      bft_error(__FILE__, __LINE__, 0,
+                "Row check failed for %s, row %d:\n"
+                "  sum of values %g instead of %g",
+                name, (int)i, s, s_ref);
+  }
+
+  cs_matrix_row_finalize(&r_ref);
+  cs_matrix_row_finalize(&r);
+}
+
+/*----------------------------------------------------------------------------
+ * Compare fixed block size matrix.vector products with the "generic"
+ * (size-independent) variants, for diagonal-block and full-block matrices.
+ *
+ * A local matrix is built on a simple graph, so that each rank checks
+ * the kernels independently.
+ *
+ * parameters:
+ *   m_type  <-- matrix type (CS_MATRIX_NATIVE or CS_MATRIX_MSR)
+ *   b_size  <-- block size
+ *   full_b  <-- use full (extra-diagonal) blocks if true
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_block_spmv(cs_matrix_type_t  m_type,
+                  cs_lnum_t         b_size,
+                  bool              full_b)
+{
+  const cs_lnum_t n_rows = 23;
+  const cs_lnum_t n_edges = 2*n_rows - 4;
+
+  cs_lnum_t db_size[4] = {b_size, b_size, b_size, b_size*b_size};
+  cs_lnum_t eb_size[4] = {1, 1, 1, 1};
+  if (full_b) {
+    for (int i = 0; i < 4; i++)
+      eb_size[i] = db_size[i];
+  }
+
+  /* Chain graph with additional connections to rows at distance 3 */
+
+  cs_lnum_2_t *edges;
+  BFT_MALLOC(edges, n_edges, cs_lnum_2_t);
+
+  cs_lnum_t e_id = 0;
+  for (cs_lnum_t i = 0; i < n_rows - 1; i++) {
+    edges[e_id][0] = i; edges[e_id][1] = i+1; e_id++;
+    if (i < n_rows - 3) {
+      edges[e_id][0] = i+3; edges[e_id][1] = i; e_id++;
+    }
+  }
+  assert(e_id == n_edges);
+
+  const cs_lnum_t n_vals = n_rows*b_size;
+
+  cs_real_t *da, *xa, *x, *y_ref, *y;
+  BFT_MALLOC(da, n_rows*db_size[3], cs_real_t);
+  BFT_MALLOC(xa, 2*n_edges*eb_size[3], cs_real_t);
+  BFT_MALLOC(x, n_vals, cs_real_t);
+  BFT_MALLOC(y_ref, n_vals, cs_real_t);
+  BFT_MALLOC(y, n_vals, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows*db_size[3]; i++)
+    da[i] = 1. + 0.5*sin(0.7*i);
+  for (cs_lnum_t i = 0; i < 2*n_edges*eb_size[3]; i++)
+    xa[i] = -0.1*cos(1.3*i);
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    x[i] = 1. + sin(0.37*i);
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(m_type,
+                                 true,
+                                 n_rows,
+                                 n_rows,
+                                 n_edges,
+                                 (const cs_lnum_2_t *)edges,
+                                 NULL,
+                                 NULL);
+
+  cs_matrix_t *m = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(m,
+                             false,
+                             db_size,
+                             (full_b) ? eb_size : NULL,
+                             n_edges,
+                             (const cs_lnum_2_t *)edges,
+                             da,
+                             xa);
+
+  cs_matrix_fill_type_t fill_type = cs_matrix_get_fill_type(false,
+                                                            db_size,
+                                                            eb_size);
+
+  char name[64];
+  snprintf(name, 63, "%s, %s, %d", cs_matrix_type_name[m_type],
+           cs_matrix_fill_type_name[fill_type], (int)b_size);
+  name[63] = '\0';
+
+  /* With and without diagonal */
+
+  for (int ed_flag = 0; ed_flag < 2; ed_flag++) {
+
+    for (int v_id = 0; v_id < 2; v_id++) {
+
+      cs_matrix_variant_t *mv = cs_matrix_variant_create(m);
+      cs_matrix_variant_set_func(mv,
+                                 NULL,
+                                 fill_type,
+                                 2,
+                                 (v_id == 0) ? "generic" : "default");
+      cs_matrix_variant_apply(m, mv);
+      cs_matrix_variant_destroy(&mv);
+
+      cs_real_t *_y = (v_id == 0) ? y_ref : y;
+      if (ed_flag == 0)
+        cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m, x, _y);
+      else
+        cs_matrix_exdiag_vector_multiply(CS_HALO_ROTATION_COPY, m, x, _y);
+
+    }
+
+    _check_spmv(name, n_vals, y_ref, y, 1e-14);
+
+  }
+
+  cs_matrix_release_coefficients(m);
+  cs_matrix_destroy(&m);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(y);
+  BFT_FREE(y_ref);
+  BFT_FREE(x);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+}
+
 /*----------------------------------------------------------------------------*/
 
 int
@@ -565,6 +771,14 @@ main (int argc, char *argv[])
 
   _base_data(cs_glob_rank_id, cs_glob_n_ranks);
 
+  /* Check fixed block size matrix.vector products */
+
+  for (cs_lnum_t b_size = 2; b_size < 7; b_size++) {
+    _check_block_spmv(CS_MATRIX_NATIVE, b_size, false);
+    _check_block_spmv(CS_MATRIX_MSR, b_size, false);
+    _check_block_spmv(CS_MATRIX_NATIVE, b_size, true);
+  }
+
   /* Loop on assembler external/internal diagonal */
 
   for (int id_ie = 0; id_ie < 2; id_ie++) {
@@ -625,27 +839,32 @@ main (int argc, char *argv[])
 #endif
 
     /* Create associated structures and matrices
-       (2 matrices are created simultaneously, to exercice
+       (3 matrices are created simultaneously, to exercice
        the const/shareable aspect of the assembler) */
 
     cs_matrix_structure_t  *ms_0
       = cs_matrix_structure_create_from_assembler(CS_MATRIX_CSR, ma);
     cs_matrix_structure_t  *ms_1
       = cs_matrix_structure_create_from_assembler(CS_MATRIX_MSR, ma);
+    cs_matrix_structure_t  *ms_2
+      = cs_matrix_structure_create_from_assembler(CS_MATRIX_SELL, ma);
 
     cs_matrix_t  *m_0 = cs_matrix_create(ms_0);
     cs_matrix_t  *m_1 = cs_matrix_create(ms_1);
+    cs_matrix_t  *m_2 = cs_matrix_create(ms_2);
 
     /* Now prepare to add values */
 
-    for (int mav_id = 0; mav_id < 2; mav_id++) {
+    for (int mav_id = 0; mav_id < 3; mav_id++) {
 
       cs_matrix_assembler_values_t *mav = NULL;
 
       if (mav_id == 0)
         mav = cs_matrix_assembler_values_init(m_0, NULL, NULL);
-      else
+      else if (mav_id == 1)
         mav = cs_matrix_assembler_values_init(m_1, NULL, NULL);
+      else
+        mav = cs_matrix_assembler_values_init(m_2, NULL, NULL);
 
       /* Same ids required as for assembler (at least, no additional ids),
          so loop in a similar manner for safety, but with different
@@ -703,32 +922,101 @@ main (int argc, char *argv[])
     cs_lnum_t n_rows = cs_matrix_get_n_rows(m_0);
     cs_lnum_t n_cols = cs_matrix_get_n_columns(m_0);
 
-    cs_real_t *x, *y_0, *y_1;
+    cs_real_t *x, *y_0, *y_1, *y_2;
     BFT_MALLOC(x, n_cols, cs_real_t);
     BFT_MALLOC(y_0, n_cols, cs_real_t);
     BFT_MALLOC(y_1, n_cols, cs_real_t);
+    BFT_MALLOC(y_2, n_cols, cs_real_t);
     for (cs_lnum_t i = 0; i < n_rows; i++)
       x[i] = (i+1)*0.5;
 
     cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_0, x, y_0);
     cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_1, x, y_1);
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_2, x, y_2);
 
     bft_printf("\nSpMV pass %d\n", id_ie);
     for (cs_lnum_t i = 0; i < n_rows; i++)
-      bft_printf("%d: %f %f\n", i, y_0[i], y_1[i]);
+      bft_printf("%d: %f %f %f\n", i, y_0[i], y_1[i], y_2[i]);
+
+    _check_spmv("MSR", n_rows, y_0, y_1, 1e-12);
+    _check_spmv("SELL", n_rows, y_0, y_2, 1e-12);
+
+    _check_rows("MSR", m_0, m_1, 1e-12);
+    _check_rows("SELL", m_0, m_2, 1e-12);
+
+    /* Test SpMV with overlapped halo synchronization (identical results) */
+
+    cs_matrix_set_halo_overlap(true);
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_1, x, y_2);
+    cs_matrix_set_halo_overlap(false);
+
+    _check_spmv("MSR, halo overlap", n_rows, y_1, y_2, 0.);
+
+    /* Test MSR export of SELL matrix */
+
+    {
+      const cs_lnum_t *row_index_1, *row_index_2;
+      const cs_real_t *x_val_1, *x_val_2;
+      cs_matrix_get_msr_arrays(m_1, &row_index_1, NULL, NULL, &x_val_1);
+      cs_matrix_get_msr_arrays(m_2, &row_index_2, NULL, NULL, &x_val_2);
+      for (cs_lnum_t i = 0; i < row_index_1[n_rows]; i++) {
+        if (fabs(x_val_2[i] - x_val_1[i]) > 0)
+          bft_error(__FILE__, __LINE__, 0,
+                    "MSR export of SELL matrix differs at entry %d:\n"
+                    "  %g instead of %g",
+                    (int)i, x_val_2[i], x_val_1[i]);
+      }
+    }
+
+    /* Test local restriction of MSR and SELL matrices */
+
+    {
+      cs_matrix_t  *m_1r = cs_matrix_create_by_local_restrict(m_1);
+      cs_matrix_t  *m_2r = cs_matrix_create_by_local_restrict(m_2);
+
+      cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_1r, x, y_1);
+      cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_2r, x, y_2);
+
+      _check_spmv("SELL, local restriction", n_rows, y_1, y_2, 1e-12);
+
+      cs_matrix_destroy(&m_1r);
+      cs_matrix_destroy(&m_2r);
+    }
+
+    /* Test SpMV with single precision extradiagonal coefficients */
+
+    if (cs_matrix_reduce_precision(m_1)) {
+
+      cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_1, x, y_1);
+
+      bft_printf("\nSpMV pass %d (reduced precision)\n", id_ie);
+      for (cs_lnum_t i = 0; i < n_rows; i++)
+        bft_printf("%d: %f %f\n", i, y_0[i], y_1[i]);
+
+      /* Single precision extradiagonal terms have a relative rounding
+         error of about 6e-8, so allow for accumulation over each row */
+
+      _check_spmv("MSR, reduced precision", n_rows, y_0, y_1, 1e-5);
+      _check_rows("MSR, reduced precision", m_0, m_1, 1e-5);
+
+    }
 
     BFT_FREE(x);
     BFT_FREE(y_0);
     BFT_FREE(y_1);
+    BFT_FREE(y_2);
 
     cs_matrix_release_coefficients(m_0);
     cs_matrix_release_coefficients(m_1);
+    cs_matrix_release_coefficients(m_2);
 
     cs_matrix_destroy(&m_0);
     cs_matrix_destroy(&m_1);
+    cs_matrix_destroy(&m_2);
 
     cs_matrix_structure_destroy(&ms_0);
     cs_matrix_structure_destroy(&ms_1);
+    cs_matrix_structure_destroy(&ms_2);
 
     cs_matrix_assembler_destroy(&ma);
   }